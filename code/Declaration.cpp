@@ -87,9 +87,7 @@ gendoc::codedom::CppObject* Declaration::Parse(const char32_t* start, const char
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::codedom::CppObject* result = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(value.get());
-    stack.pop();
+    gendoc::codedom::CppObject* result = stack.Pop<gendoc::codedom::CppObject*>();
     return result;
 }
 
@@ -103,15 +101,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -159,9 +156,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNamespaceAliasDefinition_value = std::move(stack.top());
-            context->fromNamespaceAliasDefinition = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>*>(fromNamespaceAliasDefinition_value.get());
-            stack.pop();
+            context->fromNamespaceAliasDefinition = stack.Pop<gendoc::codedom::UsingObject*>();
         }
     }
     void PostUsingDirective(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -169,9 +164,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDirective_value = std::move(stack.top());
-            context->fromUsingDirective = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>*>(fromUsingDirective_value.get());
-            stack.pop();
+            context->fromUsingDirective = stack.Pop<gendoc::codedom::UsingObject*>();
         }
     }
     void PostUsingDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -179,9 +172,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDeclaration_value = std::move(stack.top());
-            context->fromUsingDeclaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>*>(fromUsingDeclaration_value.get());
-            stack.pop();
+            context->fromUsingDeclaration = stack.Pop<gendoc::codedom::UsingObject*>();
         }
     }
     void PostSimpleDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -189,9 +180,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSimpleDeclaration_value = std::move(stack.top());
-            context->fromSimpleDeclaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::SimpleDeclaration*>*>(fromSimpleDeclaration_value.get());
-            stack.pop();
+            context->fromSimpleDeclaration = stack.Pop<gendoc::codedom::SimpleDeclaration*>();
         }
     }
 private:
@@ -217,15 +206,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::SimpleDeclaration*>(context->value)));
+            stack.Push<gendoc::codedom::SimpleDeclaration*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -260,16 +248,14 @@ public:
     void PreDeclSpecifierSeq(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::SimpleDeclaration*>(context->sd.get())));
+        stack.Push<gendoc::codedom::SimpleDeclaration*>(context->sd.get());
     }
     void PostInitDeclaratorList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitDeclaratorList_value = std::move(stack.top());
-            context->fromInitDeclaratorList = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::InitDeclaratorList*>*>(fromInitDeclaratorList_value.get());
-            stack.pop();
+            context->fromInitDeclaratorList = stack.Pop<gendoc::codedom::InitDeclaratorList*>();
         }
     }
 private:
@@ -292,11 +278,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> declaration_value = std::move(stack.top());
-        context->declaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::SimpleDeclaration*>*>(declaration_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->declaration = stack.Pop<gendoc::codedom::SimpleDeclaration*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -328,9 +311,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclSpecifier_value = std::move(stack.top());
-            context->fromDeclSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::DeclSpecifier*>*>(fromDeclSpecifier_value.get());
-            stack.pop();
+            context->fromDeclSpecifier = stack.Pop<gendoc::codedom::DeclSpecifier*>();
         }
     }
     void PostTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -338,9 +319,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = stack.Pop<gendoc::codedom::TypeName*>();
         }
     }
 private:
@@ -363,15 +342,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::DeclSpecifier*>(context->value)));
+            stack.Push<gendoc::codedom::DeclSpecifier*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -410,9 +388,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStorageClassSpecifier_value = std::move(stack.top());
-            context->fromStorageClassSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::StorageClassSpecifier*>*>(fromStorageClassSpecifier_value.get());
-            stack.pop();
+            context->fromStorageClassSpecifier = stack.Pop<gendoc::codedom::StorageClassSpecifier*>();
         }
     }
     void PostTypeSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -420,9 +396,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeSpecifier_value = std::move(stack.top());
-            context->fromTypeSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromTypeSpecifier_value.get());
-            stack.pop();
+            context->fromTypeSpecifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
     void PostTypedef(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -430,9 +404,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypedef_value = std::move(stack.top());
-            context->fromTypedef = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::DeclSpecifier*>*>(fromTypedef_value.get());
-            stack.pop();
+            context->fromTypedef = stack.Pop<gendoc::codedom::DeclSpecifier*>();
         }
     }
 private:
@@ -456,15 +428,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::StorageClassSpecifier*>(context->value)));
+            stack.Push<gendoc::codedom::StorageClassSpecifier*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -496,15 +467,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>(context->value)));
+            stack.Push<gendoc::codedom::TypeSpecifier*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -534,9 +504,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSimpleTypeSpecifier_value = std::move(stack.top());
-            context->fromSimpleTypeSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromSimpleTypeSpecifier_value.get());
-            stack.pop();
+            context->fromSimpleTypeSpecifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
     void PostCVQualifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -544,9 +512,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCVQualifier_value = std::move(stack.top());
-            context->fromCVQualifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromCVQualifier_value.get());
-            stack.pop();
+            context->fromCVQualifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
 private:
@@ -569,15 +535,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>(context->value)));
+            stack.Push<gendoc::codedom::TypeSpecifier*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -609,15 +574,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>(context->value)));
+            stack.Push<gendoc::codedom::TypeName*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -647,15 +611,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = stack.Pop<std::u32string>();
         }
     }
     void PreTemplateArgumentList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>(context->value)));
+        stack.Push<gendoc::codedom::TypeName*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -676,11 +638,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> typeName_value = std::move(stack.top());
-        context->typeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(typeName_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->typeName = stack.Pop<gendoc::codedom::TypeName*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -703,9 +662,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTemplateArgument_value = std::move(stack.top());
-            context->fromTemplateArgument = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromTemplateArgument_value.get());
-            stack.pop();
+            context->fromTemplateArgument = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -727,15 +684,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -765,9 +721,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostAssignmentExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -775,9 +729,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -800,15 +752,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::DeclSpecifier*>(context->value)));
+            stack.Push<gendoc::codedom::DeclSpecifier*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -840,15 +791,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>(context->value)));
+            stack.Push<gendoc::codedom::TypeSpecifier*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -887,15 +837,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>(context->value)));
+            stack.Push<gendoc::codedom::UsingObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -918,9 +867,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
     void PostQualifiedId(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -928,9 +875,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -953,15 +898,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>(context->value)));
+            stack.Push<gendoc::codedom::UsingObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -982,9 +926,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1006,15 +948,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>(context->value)));
+            stack.Push<gendoc::codedom::UsingObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1035,9 +976,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedId_value = std::move(stack.top());
-            context->fromQualifiedId = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQualifiedId_value.get());
-            stack.pop();
+            context->fromQualifiedId = stack.Pop<std::u32string>();
         }
     }
 private:
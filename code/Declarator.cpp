@@ -72,9 +72,7 @@ gendoc::codedom::InitDeclaratorList* Declarator::Parse(const char32_t* start, co
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::codedom::InitDeclaratorList* result = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::InitDeclaratorList*>*>(value.get());
-    stack.pop();
+    gendoc::codedom::InitDeclaratorList* result = stack.Pop<gendoc::codedom::InitDeclaratorList*>();
     return result;
 }
 
@@ -89,15 +87,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::InitDeclaratorList*>(context->value)));
+            stack.Push<gendoc::codedom::InitDeclaratorList*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -132,9 +129,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitDeclarator_value = std::move(stack.top());
-            context->fromInitDeclarator = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::InitDeclarator*>*>(fromInitDeclarator_value.get());
-            stack.pop();
+            context->fromInitDeclarator = stack.Pop<gendoc::codedom::InitDeclarator*>();
         }
     }
 private:
@@ -157,15 +152,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::InitDeclarator*>(context->value)));
+            stack.Push<gendoc::codedom::InitDeclarator*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -188,9 +182,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
     void PostInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -198,9 +190,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitializer_value = std::move(stack.top());
-            context->fromInitializer = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Initializer*>*>(fromInitializer_value.get());
-            stack.pop();
+            context->fromInitializer = stack.Pop<gendoc::codedom::Initializer*>();
         }
     }
 private:
@@ -223,15 +213,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -253,9 +242,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -277,8 +264,7 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -304,9 +290,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -314,9 +298,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -339,8 +321,7 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -372,9 +353,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdExpression_value = std::move(stack.top());
-            context->fromIdExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::IdExpr*>*>(fromIdExpression_value.get());
-            stack.pop();
+            context->fromIdExpression = stack.Pop<gendoc::codedom::IdExpr*>();
         }
     }
     void PostTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -382,9 +361,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = stack.Pop<gendoc::codedom::TypeName*>();
         }
     }
 private:
@@ -408,15 +385,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>(context->value)));
+            stack.Push<gendoc::codedom::TypeId*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -460,16 +436,14 @@ public:
     void PreTypeSpecifierSeq(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>(context->ti.get())));
+        stack.Push<gendoc::codedom::TypeId*>(context->ti.get());
     }
     void PostTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = stack.Pop<gendoc::codedom::TypeName*>();
         }
     }
     void PostAbstractDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -477,9 +451,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -504,15 +476,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Type*>(context->value)));
+            stack.Push<gendoc::codedom::Type*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -556,9 +527,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeSpecifier_value = std::move(stack.top());
-            context->fromTypeSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromTypeSpecifier_value.get());
-            stack.pop();
+            context->fromTypeSpecifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
     void PostTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -566,9 +535,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = stack.Pop<gendoc::codedom::TypeName*>();
         }
     }
 private:
@@ -592,11 +559,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> typeId_value = std::move(stack.top());
-        context->typeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(typeId_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->typeId = stack.Pop<gendoc::codedom::TypeId*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -619,9 +583,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeSpecifier_value = std::move(stack.top());
-            context->fromTypeSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromTypeSpecifier_value.get());
-            stack.pop();
+            context->fromTypeSpecifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
 private:
@@ -643,15 +605,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -673,9 +634,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -697,8 +656,7 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -723,9 +681,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostAbstractDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -733,9 +689,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -758,8 +712,7 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -782,9 +735,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCVQualifier_value = std::move(stack.top());
-            context->fromCVQualifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromCVQualifier_value.get());
-            stack.pop();
+            context->fromCVQualifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
 private:
@@ -806,15 +757,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Initializer*>(context->value)));
+            stack.Push<gendoc::codedom::Initializer*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -844,9 +794,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitializerClause_value = std::move(stack.top());
-            context->fromInitializerClause = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::AssignInit*>*>(fromInitializerClause_value.get());
-            stack.pop();
+            context->fromInitializerClause = stack.Pop<gendoc::codedom::AssignInit*>();
         }
     }
     void PostExpressionList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -854,9 +802,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
 private:
@@ -879,15 +825,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::AssignInit*>(context->value)));
+            stack.Push<gendoc::codedom::AssignInit*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -924,15 +869,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PreInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::AssignInit*>(context->value)));
+        stack.Push<gendoc::codedom::AssignInit*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -953,11 +896,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> init_value = std::move(stack.top());
-        context->init = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::AssignInit*>*>(init_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->init = stack.Pop<gendoc::codedom::AssignInit*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -980,9 +920,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitializerClause_value = std::move(stack.top());
-            context->fromInitializerClause = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::AssignInit*>*>(fromInitializerClause_value.get());
-            stack.pop();
+            context->fromInitializerClause = stack.Pop<gendoc::codedom::AssignInit*>();
         }
     }
 private:
@@ -74,9 +74,7 @@ gendoc::codedom::CppObject* Expression::Parse(const char32_t* start, const char3
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::codedom::CppObject* result = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(value.get());
-    stack.pop();
+    gendoc::codedom::CppObject* result = stack.Pop<gendoc::codedom::CppObject*>();
     return result;
 }
 
@@ -90,15 +88,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -128,9 +125,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -138,9 +133,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -163,15 +156,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -192,9 +184,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -217,15 +207,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -275,9 +264,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLogicalOrExpression_value = std::move(stack.top());
-            context->fromLogicalOrExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromLogicalOrExpression_value.get());
-            stack.pop();
+            context->fromLogicalOrExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostAssingmentOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -285,9 +272,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssingmentOp_value = std::move(stack.top());
-            context->fromAssingmentOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromAssingmentOp_value.get());
-            stack.pop();
+            context->fromAssingmentOp = stack.Pop<Operator>();
         }
     }
     void PostAssignmentExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -295,9 +280,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostConditionalExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -305,9 +288,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConditionalExpression_value = std::move(stack.top());
-            context->fromConditionalExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromConditionalExpression_value.get());
-            stack.pop();
+            context->fromConditionalExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostThrowExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -315,9 +296,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromThrowExpression_value = std::move(stack.top());
-            context->fromThrowExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromThrowExpression_value.get());
-            stack.pop();
+            context->fromThrowExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -344,15 +323,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -384,15 +362,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -413,9 +390,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -437,15 +412,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -477,9 +451,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -487,9 +459,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostAssignmentExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -497,9 +467,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -523,15 +491,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -561,9 +528,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -571,9 +536,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -596,15 +559,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -634,9 +596,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -644,9 +604,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -669,15 +627,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -707,9 +664,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -717,9 +672,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -742,15 +695,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -780,9 +732,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -790,9 +740,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -815,15 +763,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -853,9 +800,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -863,9 +808,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -888,15 +831,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -928,9 +870,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostEqOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -938,9 +878,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEqOp_value = std::move(stack.top());
-            context->fromEqOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromEqOp_value.get());
-            stack.pop();
+            context->fromEqOp = stack.Pop<Operator>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -948,9 +886,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -974,15 +910,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1021,15 +956,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1061,9 +995,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostRelOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1071,9 +1003,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRelOp_value = std::move(stack.top());
-            context->fromRelOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromRelOp_value.get());
-            stack.pop();
+            context->fromRelOp = stack.Pop<Operator>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1081,9 +1011,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1107,15 +1035,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1168,15 +1095,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1208,9 +1134,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostShiftOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1218,9 +1142,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromShiftOp_value = std::move(stack.top());
-            context->fromShiftOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromShiftOp_value.get());
-            stack.pop();
+            context->fromShiftOp = stack.Pop<Operator>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1228,9 +1150,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1254,15 +1174,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1301,15 +1220,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1341,9 +1259,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostAddOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1351,9 +1267,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAddOp_value = std::move(stack.top());
-            context->fromAddOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromAddOp_value.get());
-            stack.pop();
+            context->fromAddOp = stack.Pop<Operator>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1361,9 +1275,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1387,15 +1299,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1434,15 +1345,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1474,9 +1384,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostMulOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1484,9 +1392,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromMulOp_value = std::move(stack.top());
-            context->fromMulOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromMulOp_value.get());
-            stack.pop();
+            context->fromMulOp = stack.Pop<Operator>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1494,9 +1400,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1520,15 +1424,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1574,15 +1477,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1614,9 +1516,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostPmOp(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1624,9 +1524,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPmOp_value = std::move(stack.top());
-            context->fromPmOp = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromPmOp_value.get());
-            stack.pop();
+            context->fromPmOp = stack.Pop<Operator>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1634,9 +1532,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1660,15 +1556,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1709,15 +1604,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1763,9 +1657,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostCastExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1773,9 +1665,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCastExpression_value = std::move(stack.top());
-            context->fromCastExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCastExpression_value.get());
-            stack.pop();
+            context->fromCastExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostUnaryExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1783,9 +1673,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUnaryExpression_value = std::move(stack.top());
-            context->fromUnaryExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromUnaryExpression_value.get());
-            stack.pop();
+            context->fromUnaryExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1812,15 +1700,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1922,9 +1809,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPostfixExpression_value = std::move(stack.top());
-            context->fromPostfixExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromPostfixExpression_value.get());
-            stack.pop();
+            context->fromPostfixExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostPostCastExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1932,9 +1817,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPostCastExpression_value = std::move(stack.top());
-            context->fromPostCastExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromPostCastExpression_value.get());
-            stack.pop();
+            context->fromPostCastExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Poste1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1942,9 +1825,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frome1_value = std::move(stack.top());
-            context->frome1 = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(frome1_value.get());
-            stack.pop();
+            context->frome1 = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Poste2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1952,9 +1833,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frome2_value = std::move(stack.top());
-            context->frome2 = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(frome2_value.get());
-            stack.pop();
+            context->frome2 = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostUnaryOperator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1962,9 +1841,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUnaryOperator_value = std::move(stack.top());
-            context->fromUnaryOperator = *static_cast<gendoc::parsing::ValueObject<Operator>*>(fromUnaryOperator_value.get());
-            stack.pop();
+            context->fromUnaryOperator = stack.Pop<Operator>();
         }
     }
     void PostCastExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1972,9 +1849,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCastExpression_value = std::move(stack.top());
-            context->fromCastExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCastExpression_value.get());
-            stack.pop();
+            context->fromCastExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostTypeId(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1982,9 +1857,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void Poste3(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1992,9 +1865,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frome3_value = std::move(stack.top());
-            context->frome3 = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(frome3_value.get());
-            stack.pop();
+            context->frome3 = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostNewExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2002,9 +1873,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNewExpression_value = std::move(stack.top());
-            context->fromNewExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromNewExpression_value.get());
-            stack.pop();
+            context->fromNewExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostDeleteExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2012,9 +1881,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeleteExpression_value = std::move(stack.top());
-            context->fromDeleteExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromDeleteExpression_value.get());
-            stack.pop();
+            context->fromDeleteExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -2046,15 +1913,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Operator>(context->value)));
+            stack.Push<Operator>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2124,15 +1990,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2182,9 +2047,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNewPlacement_value = std::move(stack.top());
-            context->fromNewPlacement = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromNewPlacement_value.get());
-            stack.pop();
+            context->fromNewPlacement = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
     void PostNewTypeId(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2192,9 +2055,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNewTypeId_value = std::move(stack.top());
-            context->fromNewTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromNewTypeId_value.get());
-            stack.pop();
+            context->fromNewTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostTypeId(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2202,9 +2063,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostNewInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2212,9 +2071,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNewInitializer_value = std::move(stack.top());
-            context->fromNewInitializer = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromNewInitializer_value.get());
-            stack.pop();
+            context->fromNewInitializer = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
 private:
@@ -2243,15 +2100,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>(context->value)));
+            stack.Push<gendoc::codedom::TypeId*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2295,16 +2151,14 @@ public:
     void PreTypeSpecifierSeq(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>(context->ti.get())));
+        stack.Push<gendoc::codedom::TypeId*>(context->ti.get());
     }
     void PostTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = stack.Pop<gendoc::codedom::TypeName*>();
         }
     }
     void PostNewDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2312,9 +2166,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNewDeclarator_value = std::move(stack.top());
-            context->fromNewDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromNewDeclarator_value.get());
-            stack.pop();
+            context->fromNewDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2338,15 +2190,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2368,9 +2219,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNewDeclarator_value = std::move(stack.top());
-            context->fromNewDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromNewDeclarator_value.get());
-            stack.pop();
+            context->fromNewDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2392,8 +2241,7 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2425,9 +2273,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostConstantExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2435,9 +2281,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -2460,15 +2304,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>(context->value)));
+            stack.Push<std::vector<gendoc::codedom::CppObject*>>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2489,9 +2332,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
 private:
@@ -2513,15 +2354,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>(context->value)));
+            stack.Push<std::vector<gendoc::codedom::CppObject*>>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2542,9 +2382,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
 private:
@@ -2568,15 +2406,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2611,9 +2448,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCastExpression_value = std::move(stack.top());
-            context->fromCastExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCastExpression_value.get());
-            stack.pop();
+            context->fromCastExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -2638,15 +2473,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2735,9 +2569,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPrimaryExpression_value = std::move(stack.top());
-            context->fromPrimaryExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromPrimaryExpression_value.get());
-            stack.pop();
+            context->fromPrimaryExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postindex(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2745,9 +2577,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromindex_value = std::move(stack.top());
-            context->fromindex = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromindex_value.get());
-            stack.pop();
+            context->fromindex = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postinvoke(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2755,9 +2585,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frominvoke_value = std::move(stack.top());
-            context->frominvoke = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(frominvoke_value.get());
-            stack.pop();
+            context->frominvoke = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
     void Postmember(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2765,9 +2593,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frommember_value = std::move(stack.top());
-            context->frommember = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::IdExpr*>*>(frommember_value.get());
-            stack.pop();
+            context->frommember = stack.Pop<gendoc::codedom::IdExpr*>();
         }
     }
     void Postptrmember(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2775,9 +2601,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromptrmember_value = std::move(stack.top());
-            context->fromptrmember = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::IdExpr*>*>(fromptrmember_value.get());
-            stack.pop();
+            context->fromptrmember = stack.Pop<gendoc::codedom::IdExpr*>();
         }
     }
     void PostTypeSpecifierOrTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2785,9 +2609,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeSpecifierOrTypeName_value = std::move(stack.top());
-            context->fromTypeSpecifierOrTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromTypeSpecifierOrTypeName_value.get());
-            stack.pop();
+            context->fromTypeSpecifierOrTypeName = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PosttypeConstruction(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2795,9 +2617,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromtypeConstruction_value = std::move(stack.top());
-            context->fromtypeConstruction = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromtypeConstruction_value.get());
-            stack.pop();
+            context->fromtypeConstruction = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
 private:
@@ -2826,15 +2646,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2864,9 +2683,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSimpleTypeSpecifier_value = std::move(stack.top());
-            context->fromSimpleTypeSpecifier = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeSpecifier*>*>(fromSimpleTypeSpecifier_value.get());
-            stack.pop();
+            context->fromSimpleTypeSpecifier = stack.Pop<gendoc::codedom::TypeSpecifier*>();
         }
     }
     void PostTypeName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2874,9 +2691,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeName_value = std::move(stack.top());
-            context->fromTypeName = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeName*>*>(fromTypeName_value.get());
-            stack.pop();
+            context->fromTypeName = stack.Pop<gendoc::codedom::TypeName*>();
         }
     }
 private:
@@ -2899,15 +2714,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2972,9 +2786,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromdct_value = std::move(stack.top());
-            context->fromdct = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromdct_value.get());
-            stack.pop();
+            context->fromdct = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void Postdce(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2982,9 +2794,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromdce_value = std::move(stack.top());
-            context->fromdce = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromdce_value.get());
-            stack.pop();
+            context->fromdce = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postsct(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2992,9 +2802,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromsct_value = std::move(stack.top());
-            context->fromsct = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromsct_value.get());
-            stack.pop();
+            context->fromsct = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void Postsce(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3002,9 +2810,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromsce_value = std::move(stack.top());
-            context->fromsce = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromsce_value.get());
-            stack.pop();
+            context->fromsce = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postrct(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3012,9 +2818,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromrct_value = std::move(stack.top());
-            context->fromrct = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromrct_value.get());
-            stack.pop();
+            context->fromrct = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void Postrce(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3022,9 +2826,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromrce_value = std::move(stack.top());
-            context->fromrce = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromrce_value.get());
-            stack.pop();
+            context->fromrce = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Postcct(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3032,9 +2834,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromcct_value = std::move(stack.top());
-            context->fromcct = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromcct_value.get());
-            stack.pop();
+            context->fromcct = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void Postcce(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3042,9 +2842,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromcce_value = std::move(stack.top());
-            context->fromcce = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromcce_value.get());
-            stack.pop();
+            context->fromcce = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PosttypeidExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3052,9 +2850,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromtypeidExpr_value = std::move(stack.top());
-            context->fromtypeidExpr = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromtypeidExpr_value.get());
-            stack.pop();
+            context->fromtypeidExpr = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -3084,15 +2880,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>(context->value)));
+            stack.Push<std::vector<gendoc::codedom::CppObject*>>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3113,9 +2908,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -3138,15 +2931,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3199,9 +2991,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLiteral_value = std::move(stack.top());
-            context->fromLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromLiteral_value.get());
-            stack.pop();
+            context->fromLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
     void PostExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3209,9 +2999,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostIdExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3219,9 +3007,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdExpression_value = std::move(stack.top());
-            context->fromIdExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::IdExpr*>*>(fromIdExpression_value.get());
-            stack.pop();
+            context->fromIdExpression = stack.Pop<gendoc::codedom::IdExpr*>();
         }
     }
 private:
@@ -3246,15 +3032,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::IdExpr*>(context->value)));
+            stack.Push<gendoc::codedom::IdExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3291,9 +3076,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromid1_value = std::move(stack.top());
-            context->fromid1 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromid1_value.get());
-            stack.pop();
+            context->fromid1 = stack.Pop<std::u32string>();
         }
     }
     void Postid2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -3301,9 +3084,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromid2_value = std::move(stack.top());
-            context->fromid2 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromid2_value.get());
-            stack.pop();
+            context->fromid2 = stack.Pop<std::u32string>();
         }
     }
 private:
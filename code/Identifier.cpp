@@ -67,9 +67,7 @@ std::u32string Identifier::Parse(const char32_t* start, const char32_t* end, int
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    std::u32string result = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(value.get());
-    stack.pop();
+    std::u32string result = stack.Pop<std::u32string>();
     return result;
 }
 
@@ -83,15 +81,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -112,9 +109,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromidentifier_value = std::move(stack.top());
-            context->fromidentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromidentifier_value.get());
-            stack.pop();
+            context->fromidentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -136,15 +131,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -165,9 +159,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
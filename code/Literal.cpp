@@ -67,9 +67,7 @@ gendoc::codedom::Literal* Literal::Parse(const char32_t* start, const char32_t*
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::codedom::Literal* result = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(value.get());
-    stack.pop();
+    gendoc::codedom::Literal* result = stack.Pop<gendoc::codedom::Literal*>();
     return result;
 }
 
@@ -83,15 +81,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -157,9 +154,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIntegerLiteral_value = std::move(stack.top());
-            context->fromIntegerLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromIntegerLiteral_value.get());
-            stack.pop();
+            context->fromIntegerLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
     void PostCharacterLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -167,9 +162,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCharacterLiteral_value = std::move(stack.top());
-            context->fromCharacterLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromCharacterLiteral_value.get());
-            stack.pop();
+            context->fromCharacterLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
     void PostFloatingLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -177,9 +170,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFloatingLiteral_value = std::move(stack.top());
-            context->fromFloatingLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromFloatingLiteral_value.get());
-            stack.pop();
+            context->fromFloatingLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
     void PostStringLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -187,9 +178,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStringLiteral_value = std::move(stack.top());
-            context->fromStringLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromStringLiteral_value.get());
-            stack.pop();
+            context->fromStringLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
     void PostBooleanLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -197,9 +186,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBooleanLiteral_value = std::move(stack.top());
-            context->fromBooleanLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromBooleanLiteral_value.get());
-            stack.pop();
+            context->fromBooleanLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
     void PostPointerLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -207,9 +194,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPointerLiteral_value = std::move(stack.top());
-            context->fromPointerLiteral = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Literal*>*>(fromPointerLiteral_value.get());
-            stack.pop();
+            context->fromPointerLiteral = stack.Pop<gendoc::codedom::Literal*>();
         }
     }
 private:
@@ -236,15 +221,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -290,15 +274,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -344,15 +327,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -384,15 +366,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -431,15 +412,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -471,15 +451,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -518,15 +497,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Literal*>(context->value)));
+            stack.Push<gendoc::codedom::Literal*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -72,9 +72,7 @@ gendoc::codedom::CompoundStatement* Statement::Parse(const char32_t* start, cons
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::codedom::CompoundStatement* result = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>*>(value.get());
-    stack.pop();
+    gendoc::codedom::CompoundStatement* result = stack.Pop<gendoc::codedom::CompoundStatement*>();
     return result;
 }
 
@@ -88,15 +86,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -189,9 +186,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLabeledStatement_value = std::move(stack.top());
-            context->fromLabeledStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromLabeledStatement_value.get());
-            stack.pop();
+            context->fromLabeledStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostEmptyStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -199,9 +194,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEmptyStatement_value = std::move(stack.top());
-            context->fromEmptyStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromEmptyStatement_value.get());
-            stack.pop();
+            context->fromEmptyStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostCompoundStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -209,9 +202,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCompoundStatement_value = std::move(stack.top());
-            context->fromCompoundStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>*>(fromCompoundStatement_value.get());
-            stack.pop();
+            context->fromCompoundStatement = stack.Pop<gendoc::codedom::CompoundStatement*>();
         }
     }
     void PostSelectionStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -219,9 +210,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSelectionStatement_value = std::move(stack.top());
-            context->fromSelectionStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromSelectionStatement_value.get());
-            stack.pop();
+            context->fromSelectionStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostIterationStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -229,9 +218,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIterationStatement_value = std::move(stack.top());
-            context->fromIterationStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromIterationStatement_value.get());
-            stack.pop();
+            context->fromIterationStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostJumpStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -239,9 +226,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromJumpStatement_value = std::move(stack.top());
-            context->fromJumpStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromJumpStatement_value.get());
-            stack.pop();
+            context->fromJumpStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostDeclarationStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -249,9 +234,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarationStatement_value = std::move(stack.top());
-            context->fromDeclarationStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromDeclarationStatement_value.get());
-            stack.pop();
+            context->fromDeclarationStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostTryStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -259,9 +242,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTryStatement_value = std::move(stack.top());
-            context->fromTryStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TryStatement*>*>(fromTryStatement_value.get());
-            stack.pop();
+            context->fromTryStatement = stack.Pop<gendoc::codedom::TryStatement*>();
         }
     }
     void PostExpressionStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -269,9 +250,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionStatement_value = std::move(stack.top());
-            context->fromExpressionStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromExpressionStatement_value.get());
-            stack.pop();
+            context->fromExpressionStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -301,15 +280,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -352,9 +330,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLabel_value = std::move(stack.top());
-            context->fromLabel = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromLabel_value.get());
-            stack.pop();
+            context->fromLabel = stack.Pop<std::u32string>();
         }
     }
     void Posts1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -362,9 +338,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms1_value = std::move(stack.top());
-            context->froms1 = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(froms1_value.get());
-            stack.pop();
+            context->froms1 = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostConstantExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -372,9 +346,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void Posts2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -382,9 +354,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms2_value = std::move(stack.top());
-            context->froms2 = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(froms2_value.get());
-            stack.pop();
+            context->froms2 = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void Posts3(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -392,9 +362,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms3_value = std::move(stack.top());
-            context->froms3 = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(froms3_value.get());
-            stack.pop();
+            context->froms3 = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -420,15 +388,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -449,9 +416,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -473,15 +438,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -513,15 +477,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -542,9 +505,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -567,15 +528,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>(context->value)));
+            stack.Push<gendoc::codedom::CompoundStatement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -610,9 +570,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -635,15 +593,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -673,9 +630,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIfStatement_value = std::move(stack.top());
-            context->fromIfStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromIfStatement_value.get());
-            stack.pop();
+            context->fromIfStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostSwitchStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -683,9 +638,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSwitchStatement_value = std::move(stack.top());
-            context->fromSwitchStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromSwitchStatement_value.get());
-            stack.pop();
+            context->fromSwitchStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -708,15 +661,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -741,9 +693,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostthenStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -751,9 +701,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromthenStatement_value = std::move(stack.top());
-            context->fromthenStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromthenStatement_value.get());
-            stack.pop();
+            context->fromthenStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostelseStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -761,9 +709,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromelseStatement_value = std::move(stack.top());
-            context->fromelseStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromelseStatement_value.get());
-            stack.pop();
+            context->fromelseStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -787,15 +733,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -818,9 +763,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -828,9 +771,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -853,15 +794,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -900,9 +840,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromWhileStatement_value = std::move(stack.top());
-            context->fromWhileStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromWhileStatement_value.get());
-            stack.pop();
+            context->fromWhileStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostDoStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -910,9 +848,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDoStatement_value = std::move(stack.top());
-            context->fromDoStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromDoStatement_value.get());
-            stack.pop();
+            context->fromDoStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostForStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -920,9 +856,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromForStatement_value = std::move(stack.top());
-            context->fromForStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromForStatement_value.get());
-            stack.pop();
+            context->fromForStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -946,15 +880,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -977,9 +910,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -987,9 +918,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -1012,15 +941,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1043,9 +971,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1053,9 +979,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1078,15 +1002,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1113,9 +1036,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromForInitStatement_value = std::move(stack.top());
-            context->fromForInitStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromForInitStatement_value.get());
-            stack.pop();
+            context->fromForInitStatement = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostCondition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1123,9 +1044,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCondition_value = std::move(stack.top());
-            context->fromCondition = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromCondition_value.get());
-            stack.pop();
+            context->fromCondition = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1133,9 +1052,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1143,9 +1060,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStatement_value = std::move(stack.top());
-            context->fromStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromStatement_value.get());
-            stack.pop();
+            context->fromStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -1170,15 +1085,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1217,9 +1131,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEmptyStatement_value = std::move(stack.top());
-            context->fromEmptyStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromEmptyStatement_value.get());
-            stack.pop();
+            context->fromEmptyStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostExpressionStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1227,9 +1139,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionStatement_value = std::move(stack.top());
-            context->fromExpressionStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromExpressionStatement_value.get());
-            stack.pop();
+            context->fromExpressionStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostSimpleDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1237,9 +1147,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSimpleDeclaration_value = std::move(stack.top());
-            context->fromSimpleDeclaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::SimpleDeclaration*>*>(fromSimpleDeclaration_value.get());
-            stack.pop();
+            context->fromSimpleDeclaration = stack.Pop<gendoc::codedom::SimpleDeclaration*>();
         }
     }
 private:
@@ -1263,15 +1171,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1319,9 +1226,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBreakStatement_value = std::move(stack.top());
-            context->fromBreakStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromBreakStatement_value.get());
-            stack.pop();
+            context->fromBreakStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostContinueStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1329,9 +1234,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromContinueStatement_value = std::move(stack.top());
-            context->fromContinueStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromContinueStatement_value.get());
-            stack.pop();
+            context->fromContinueStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostReturnStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1339,9 +1242,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromReturnStatement_value = std::move(stack.top());
-            context->fromReturnStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromReturnStatement_value.get());
-            stack.pop();
+            context->fromReturnStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
     void PostGotoStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1349,9 +1250,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGotoStatement_value = std::move(stack.top());
-            context->fromGotoStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Statement*>*>(fromGotoStatement_value.get());
-            stack.pop();
+            context->fromGotoStatement = stack.Pop<gendoc::codedom::Statement*>();
         }
     }
 private:
@@ -1376,15 +1275,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1416,15 +1314,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1456,15 +1353,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1485,9 +1381,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1509,15 +1403,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1538,9 +1431,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGotoTarget_value = std::move(stack.top());
-            context->fromGotoTarget = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromGotoTarget_value.get());
-            stack.pop();
+            context->fromGotoTarget = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1562,15 +1453,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1591,9 +1481,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1615,15 +1503,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Statement*>(context->value)));
+            stack.Push<gendoc::codedom::Statement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1644,9 +1531,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBlockDeclaration_value = std::move(stack.top());
-            context->fromBlockDeclaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromBlockDeclaration_value.get());
-            stack.pop();
+            context->fromBlockDeclaration = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1669,15 +1554,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>(context->value)));
+            stack.Push<gendoc::codedom::CppObject*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1718,9 +1602,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1728,9 +1610,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
     void PostAssignmentExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1738,9 +1618,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
     void PostExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1748,9 +1626,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpression_value = std::move(stack.top());
-            context->fromExpression = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CppObject*>*>(fromExpression_value.get());
-            stack.pop();
+            context->fromExpression = stack.Pop<gendoc::codedom::CppObject*>();
         }
     }
 private:
@@ -1776,15 +1652,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TryStatement*>(context->value)));
+            stack.Push<gendoc::codedom::TryStatement*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1807,15 +1682,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCompoundStatement_value = std::move(stack.top());
-            context->fromCompoundStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>*>(fromCompoundStatement_value.get());
-            stack.pop();
+            context->fromCompoundStatement = stack.Pop<gendoc::codedom::CompoundStatement*>();
         }
     }
     void PreHandlerSeq(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<TryStatement*>(context->value)));
+        stack.Push<TryStatement*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1836,11 +1709,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> st_value = std::move(stack.top());
-        context->st = *static_cast<gendoc::parsing::ValueObject<TryStatement*>*>(st_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->st = stack.Pop<TryStatement*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1865,15 +1735,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHandler_value = std::move(stack.top());
-            context->fromHandler = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::Handler*>*>(fromHandler_value.get());
-            stack.pop();
+            context->fromHandler = stack.Pop<gendoc::codedom::Handler*>();
         }
     }
     void PreHandlerSeq(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<TryStatement*>(context->st)));
+        stack.Push<TryStatement*>(context->st);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1894,15 +1762,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::Handler*>(context->value)));
+            stack.Push<gendoc::codedom::Handler*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1925,9 +1792,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExceptionDeclaration_value = std::move(stack.top());
-            context->fromExceptionDeclaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::ExceptionDeclaration*>*>(fromExceptionDeclaration_value.get());
-            stack.pop();
+            context->fromExceptionDeclaration = stack.Pop<gendoc::codedom::ExceptionDeclaration*>();
         }
     }
     void PostCompoundStatement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1935,9 +1800,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCompoundStatement_value = std::move(stack.top());
-            context->fromCompoundStatement = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>*>(fromCompoundStatement_value.get());
-            stack.pop();
+            context->fromCompoundStatement = stack.Pop<gendoc::codedom::CompoundStatement*>();
         }
     }
 private:
@@ -1961,15 +1824,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::ExceptionDeclaration*>(context->value)));
+            stack.Push<gendoc::codedom::ExceptionDeclaration*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2020,16 +1882,14 @@ public:
     void PreTypeSpecifierSeq(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>(context->ed->GetTypeId())));
+        stack.Push<gendoc::codedom::TypeId*>(context->ed->GetTypeId());
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
     void PostAbstractDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2037,9 +1897,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbstractDeclarator_value = std::move(stack.top());
-            context->fromAbstractDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromAbstractDeclarator_value.get());
-            stack.pop();
+            context->fromAbstractDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
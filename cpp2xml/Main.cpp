@@ -71,7 +71,7 @@ void GenerateXmlSolution(const std::string& solutionFilePath, const std::string&
         solutionGrammar = gendoc::cppparser::Solution::Create();
     }
     MappedInputFile solutionFile(solutionFilePath);
-    std::u32string solutionText = ToUtf32(std::string(solutionFile.Begin(), solutionFile.End()));
+    std::u32string solutionText = ToUtf32(solutionFile.Begin(), solutionFile.End());
     std::unique_ptr<gendoc::cppast::Solution> solution(solutionGrammar->Parse(solutionText.c_str(), solutionText.c_str() + solutionText.length(), 0, solutionFilePath));
     Document solutionDoc;
     std::unique_ptr<Element> solutionElement(new Element(U"solution"));
@@ -261,9 +261,10 @@ std::unique_ptr<SourceFileNode> ParseSourceFile(const std::string& sourceFilePat
     if (boost::filesystem::file_size(sourceFilePath) > 0)
     {
         MappedInputFile sourceFile(sourceFilePath);
-        sourceFileContent = ToUtf32(std::string(sourceFile.Begin(), sourceFile.End()));
+        sourceFileContent = ToUtf32(sourceFile.Begin(), sourceFile.End());
     }
     std::unique_ptr<SourceFileNode> sourceFileNode(new SourceFileNode(Span(), sourceFilePath, relativeSourceFilePath, projectName));
+    NodeArenaScope arenaScope(sourceFileNode->Arena());
     includeDirectiveGrammar->Parse(sourceFileContent.c_str(), sourceFileContent.c_str() + sourceFileContent.length(), sourceFileIndex, sourceFilePath, sourceFileNode.get());
     cppSourceFileGrammar->Parse(sourceFileContent.c_str(), sourceFileContent.c_str() + sourceFileContent.length(), sourceFileIndex, sourceFilePath, sourceFileNode.get());
     sourceFileNode->SetSourceFileIndex(sourceFileIndex);
@@ -316,7 +317,7 @@ void CountLines(const std::vector<std::string>& sourceFilePaths, int& projectLin
     for (const std::string& sourceFilePath : sourceFilePaths)
     {
         MappedInputFile sourceFile(sourceFilePath);
-        std::u32string sourceFileContent = ToUtf32(std::string(sourceFile.Begin(), sourceFile.End()));
+        std::u32string sourceFileContent = ToUtf32(sourceFile.Begin(), sourceFile.End());
         int lines = sourceLinesGrammar->Parse(sourceFileContent.c_str(), sourceFileContent.c_str() + sourceFileContent.length(), 0, sourceFilePath);
         projectLineCount += lines;
         totalLineCount += lines;
@@ -341,7 +341,8 @@ void ThisNode::Accept(Visitor& visitor)
     visitor.Visit(*this);
 }
 
-IdentifierNode::IdentifierNode(const Span& span_, const std::u32string& identifier_) : Node(span_), identifier(identifier_)
+IdentifierNode::IdentifierNode(const Span& span_, const std::u32string& identifier_) : Node(span_), identifier(identifier_), 
+    identifierAtom(gendoc::util::MakeAtom(identifier_))
 {
 }
 
@@ -6,6 +6,7 @@
 #ifndef GENDOC_CPPAST_EXPRESSION_INCLUDED
 #define GENDOC_CPPAST_EXPRESSION_INCLUDED
 #include <gendoc/cppast/SimpleType.hpp>
+#include <gendoc/util/Atom.hpp>
 
 namespace gendoc { namespace cppast {
 
@@ -306,8 +307,10 @@ public:
     void Accept(Visitor& visitor) override;
     bool IsIdentifierNode() const override { return true; }
     const std::u32string& Identifier() const { return identifier; }
+    gendoc::util::Atom IdentifierAtom() const { return identifierAtom; }
 private:
     std::u32string identifier;
+    gendoc::util::Atom identifierAtom;
 };
 
 class OperatorFunctionIdNode : public IdentifierNode
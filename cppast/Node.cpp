@@ -4,9 +4,82 @@
 // =================================
 
 #include <gendoc/cppast/Node.hpp>
+#include <cstdlib>
+#include <new>
 
 namespace gendoc { namespace cppast {
 
+const size_t nodeArenaBlockSize = 64 * 1024;
+const size_t nodeHeaderSize = alignof(std::max_align_t);
+
+NodeArena::NodeArena() : pos(nullptr), end(nullptr)
+{
+}
+
+void* NodeArena::Allocate(size_t size)
+{
+    size = (size + nodeHeaderSize - 1) & ~(nodeHeaderSize - 1);
+    if (size > nodeArenaBlockSize / 4)
+    {
+        blocks.push_back(std::vector<char>(size));
+        return blocks.back().data();
+    }
+    if (static_cast<size_t>(end - pos) < size)
+    {
+        blocks.push_back(std::vector<char>(nodeArenaBlockSize));
+        pos = blocks.back().data();
+        end = pos + nodeArenaBlockSize;
+    }
+    void* mem = pos;
+    pos = pos + size;
+    return mem;
+}
+
+thread_local NodeArena* currentArena = nullptr;
+
+NodeArenaScope::NodeArenaScope(NodeArena* arena) : prevArena(currentArena)
+{
+    currentArena = arena;
+}
+
+NodeArenaScope::~NodeArenaScope()
+{
+    currentArena = prevArena;
+}
+
+// Each node is preceded by a header that records the arena it was allocated from, or null for nodes allocated from the heap.
+// Deleting an arena node only runs its destructor; the memory is released with the arena.
+
+void* Node::operator new(size_t size)
+{
+    NodeArena* arena = currentArena;
+    char* mem = nullptr;
+    if (arena)
+    {
+        mem = static_cast<char*>(arena->Allocate(nodeHeaderSize + size));
+    }
+    else
+    {
+        mem = static_cast<char*>(std::malloc(nodeHeaderSize + size));
+        if (!mem)
+        {
+            throw std::bad_alloc();
+        }
+    }
+    *reinterpret_cast<NodeArena**>(mem) = arena;
+    return mem + nodeHeaderSize;
+}
+
+void Node::operator delete(void* ptr)
+{
+    if (!ptr) return;
+    char* mem = static_cast<char*>(ptr) - nodeHeaderSize;
+    if (!*reinterpret_cast<NodeArena**>(mem))
+    {
+        std::free(mem);
+    }
+}
+
 Node::Node(const Span& span_) : span(span_)
 {
 }
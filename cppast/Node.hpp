@@ -7,6 +7,8 @@
 #define GENDOC_CPPAST_NODE_INCLUDED
 #include <gendoc/parsing/Scanner.hpp>
 #include <memory>
+#include <vector>
+#include <cstddef>
 
 namespace gendoc { namespace cppast {
 
@@ -14,9 +16,41 @@ using gendoc::parsing::Span;
 
 class Visitor;
 
+// Owns the memory of the nodes of one source file. Nodes are allocated one after another from large blocks,
+// and the blocks are freed together when the arena is destroyed.
+// Memory of nodes that the parser deletes when it backtracks is not reused: it stays allocated until the arena is destroyed.
+
+class NodeArena
+{
+public:
+    NodeArena();
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+    void* Allocate(size_t size);
+private:
+    std::vector<std::vector<char>> blocks;
+    char* pos;
+    char* end;
+};
+
+// While a scope is alive, nodes created by the current thread are allocated from its arena.
+
+class NodeArenaScope
+{
+public:
+    NodeArenaScope(NodeArena* arena);
+    NodeArenaScope(const NodeArenaScope&) = delete;
+    NodeArenaScope& operator=(const NodeArenaScope&) = delete;
+    ~NodeArenaScope();
+private:
+    NodeArena* prevArena;
+};
+
 class Node
 {
 public:
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
     Node(const Span& span_);
     virtual ~Node();
     virtual void Accept(Visitor& visitor) = 0;
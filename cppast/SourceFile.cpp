@@ -33,7 +33,7 @@ void IncludeDirectiveSequenceNode::Accept(Visitor& visitor)
 
 SourceFileNode::SourceFileNode(const Span& span_, const std::string& sourceFilePath_, const std::string& relativeSourceFilePath_, const std::u32string& projectName_) :
     Node(span_), globalNs(new NamespaceNode(span_)), sourceFilePath(sourceFilePath_), relativeSourceFilePath(relativeSourceFilePath_), projectName(projectName_), 
-    sourceFileIndex(-1), processed(false)
+    sourceFileIndex(-1), arena(new NodeArena()), processed(false)
 {
     std::string fileName = relativeSourceFilePath;
     for (char& c : fileName)
@@ -89,6 +89,38 @@ void SourceFileNode::ComputeLineStarts(const std::u32string& sourceFileContent)
     }
 }
 
+void SourceFileNode::SetContent(std::u32string&& content_)
+{
+    content = std::move(content_);
+    ComputeLineStarts(content);
+}
+
+const char32_t* SourceFileNode::LineStart(int lineNumber) const
+{
+    return content.c_str() + lineStarts[lineNumber - 1];
+}
+
+// Returns the end of the given line excluding the terminating newline and a carriage return preceding it.
+
+const char32_t* SourceFileNode::LineEnd(int lineNumber) const
+{
+    const char32_t* start = LineStart(lineNumber);
+    const char32_t* end = content.c_str() + content.length();
+    if (lineNumber < int(lineStarts.size()))
+    {
+        end = content.c_str() + lineStarts[lineNumber];
+    }
+    if (end != start && end[-1] == U'\n')
+    {
+        --end;
+    }
+    if (end != start && end[-1] == U'\r')
+    {
+        --end;
+    }
+    return end;
+}
+
 SourceFileSequenceNode::SourceFileSequenceNode(const Span& span_, Node* left_, Node* right_) : BinaryNode(span_, left_, right_)
 {
 }
@@ -52,8 +52,14 @@ public:
     const std::vector<Node*>& UsingDirectivesAndDeclarations() const { return usingDirectivesAndDeclarations; }
     bool Processed() const { return processed; }
     void SetProcessed() { processed = true; }
+    void SetContent(std::u32string&& content_);
+    const std::u32string& Content() const { return content; }
     void ComputeLineStarts(const std::u32string& sourceFileContent);
     std::vector<int>* LineStarts() { return &lineStarts; }
+    int NumLines() const { return int(lineStarts.size()); }
+    const char32_t* LineStart(int lineNumber) const;
+    const char32_t* LineEnd(int lineNumber) const;
+    NodeArena* Arena() { return arena.get(); }
 private:
     std::string sourceFilePath;
     std::string relativeSourceFilePath;
@@ -61,10 +67,12 @@ private:
     std::string htmlSourceFilePath;
     std::u32string id;
     int sourceFileIndex;
+    std::unique_ptr<NodeArena> arena;
     std::unique_ptr<Node> includeDirectives;
     std::unique_ptr<NamespaceNode> globalNs;
     std::vector<Node*> usingDirectivesAndDeclarations;
     bool processed;
+    std::u32string content;
     std::vector<int> lineStarts;
 };
 
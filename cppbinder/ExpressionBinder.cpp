@@ -303,8 +303,7 @@ void ExpressionBinder::Visit(InvokeExpressionNode& invokeExpressionNode)
         {
             symbolTable.MapNode(&invokeExpressionNode, functionSymbol);
             symbols.push_back(functionSymbol);
-            currentFunction->AddToCalls(functionSymbol);
-            functionSymbol->AddToCalledBy(currentFunction);
+            symbolTable.AddCall(currentFunction, functionSymbol);
         }
     }
 }
@@ -443,12 +442,12 @@ void ExpressionBinder::Visit(NestedIdNode& nestedIdNode)
 
 void ExpressionBinder::Visit(IdentifierNode& identifierNode)
 {
-    Symbol* symbol = containerScope->Lookup(identifierNode.Identifier(), ScopeLookup::this_and_bases_and_parent);
+    Symbol* symbol = containerScope->Lookup(identifierNode.IdentifierAtom(), ScopeLookup::this_and_bases_and_parent);
     if (!symbol)
     {
         for (const std::unique_ptr<FileScope>& fileScope : boundSourceFile->FileScopes())
         {
-            symbol = fileScope->Lookup(identifierNode.Identifier());
+            symbol = fileScope->Lookup(identifierNode.IdentifierAtom());
             if (symbol)
             {
                 break;
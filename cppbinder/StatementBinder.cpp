@@ -6,9 +6,13 @@
 #include <gendoc/cppbinder/StatementBinder.hpp>
 #include <gendoc/cppbinder/ExpressionBinder.hpp>
 #include <gendoc/cppast/SourceFile.hpp>
+#include <gendoc/util/Parallel.hpp>
+#include <algorithm>
 
 namespace gendoc { namespace cppbinder {
 
+using namespace gendoc::util;
+
 StatementBinder::StatementBinder(SymbolTable& symbolTable_, const std::unordered_map<SourceFileNode*, BoundSourceFile*>& sourceFileMap_) : 
     symbolTable(symbolTable_), sourceFileMap(sourceFileMap_), currentSourceFile(nullptr), containerScope(nullptr), currentFunction(nullptr)
 {
@@ -280,4 +284,77 @@ void StatementBinder::Visit(HandlerSequenceNode& handlerSequenceNode)
     handlerSequenceNode.Right()->Accept(*this);
 }
 
+class SourceFileCollector : public gendoc::cppast::Visitor
+{
+public:
+    void Visit(SourceFileNode& sourceFileNode) override;
+    void Visit(SourceFileSequenceNode& sourceFileSequenceNode) override;
+    std::vector<SourceFileNode*>& SourceFiles() { return sourceFiles; }
+private:
+    std::vector<SourceFileNode*> sourceFiles;
+};
+
+void SourceFileCollector::Visit(SourceFileNode& sourceFileNode)
+{
+    sourceFiles.push_back(&sourceFileNode);
+}
+
+void SourceFileCollector::Visit(SourceFileSequenceNode& sourceFileSequenceNode)
+{
+    sourceFileSequenceNode.Left()->Accept(*this);
+    sourceFileSequenceNode.Right()->Accept(*this);
+}
+
+class SourceFileStatementBinder : public ParallelWork
+{
+public:
+    SourceFileStatementBinder(SymbolTable& symbolTable_, const std::unordered_map<SourceFileNode*, BoundSourceFile*>& sourceFileMap_, 
+        const std::vector<SourceFileNode*>& sourceFiles_, std::vector<std::unique_ptr<BindingBuffer>>& bindingBuffers_);
+    void Run(int itemIndex, int threadIndex) override;
+private:
+    SymbolTable& symbolTable;
+    const std::unordered_map<SourceFileNode*, BoundSourceFile*>& sourceFileMap;
+    const std::vector<SourceFileNode*>& sourceFiles;
+    std::vector<std::unique_ptr<BindingBuffer>>& bindingBuffers;
+};
+
+SourceFileStatementBinder::SourceFileStatementBinder(SymbolTable& symbolTable_, const std::unordered_map<SourceFileNode*, BoundSourceFile*>& sourceFileMap_, 
+    const std::vector<SourceFileNode*>& sourceFiles_, std::vector<std::unique_ptr<BindingBuffer>>& bindingBuffers_) : 
+    symbolTable(symbolTable_), sourceFileMap(sourceFileMap_), sourceFiles(sourceFiles_), bindingBuffers(bindingBuffers_)
+{
+}
+
+void SourceFileStatementBinder::Run(int itemIndex, int threadIndex)
+{
+    BindingBufferScope bufferScope(bindingBuffers[itemIndex].get());
+    StatementBinder statementBinder(symbolTable, sourceFileMap);
+    sourceFiles[itemIndex]->Accept(statementBinder);
+}
+
+void BindStatements(Node* ast, SymbolTable& symbolTable, const std::unordered_map<SourceFileNode*, BoundSourceFile*>& sourceFileMap, int numJobs)
+{
+    SourceFileCollector collector;
+    ast->Accept(collector);
+    const std::vector<SourceFileNode*>& sourceFiles = collector.SourceFiles();
+    int numSourceFiles = int(sourceFiles.size());
+    int numThreads = std::min(numJobs, numSourceFiles);
+    if (numThreads <= 1)
+    {
+        StatementBinder statementBinder(symbolTable, sourceFileMap);
+        ast->Accept(statementBinder);
+        return;
+    }
+    std::vector<std::unique_ptr<BindingBuffer>> bindingBuffers;
+    for (int i = 0; i < numSourceFiles; ++i)
+    {
+        bindingBuffers.push_back(std::unique_ptr<BindingBuffer>(new BindingBuffer(i)));
+    }
+    SourceFileStatementBinder binder(symbolTable, sourceFileMap, sourceFiles, bindingBuffers);
+    ParallelFor(numSourceFiles, numThreads, binder);
+    for (const std::unique_ptr<BindingBuffer>& bindingBuffer : bindingBuffers)
+    {
+        symbolTable.ApplyBindingBuffer(*bindingBuffer);
+    }
+}
+
 } } // namespace gendoc::cppbinder
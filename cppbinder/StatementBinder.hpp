@@ -49,6 +49,11 @@ private:
     FunctionSymbol* currentFunction;
 };
 
+// Binds the function bodies of the source files of ast. If numJobs is greater than one, source files are bound by numJobs threads,
+// and the node mappings and function calls made for each source file are applied to the symbol table in source file order afterwards.
+
+void BindStatements(Node* ast, SymbolTable& symbolTable, const std::unordered_map<SourceFileNode*, BoundSourceFile*>& sourceFileMap, int numJobs);
+
 } } // namespace gendoc::cppbinder
 
 #endif // GENDOC_CPPBINDER_STATEMENT_BINDER_INCLUDED
@@ -184,12 +184,12 @@ void TypeResolver::Visit(IdentifierNode& identifierNode)
     Symbol* symbol = nullptr;
     if (parentResolved)
     {
-        symbol = currentContainerScope->Lookup(identifierNode.Identifier(), ScopeLookup::this_and_bases_and_parent);
+        symbol = currentContainerScope->Lookup(identifierNode.IdentifierAtom(), ScopeLookup::this_and_bases_and_parent);
         if (!symbol)
         {
             for (const std::unique_ptr<FileScope>& fileScope : boundSourceFile.FileScopes())
             {
-                symbol = fileScope->Lookup(identifierNode.Identifier());
+                symbol = fileScope->Lookup(identifierNode.IdentifierAtom());
                 if (symbol)
                 {
                     break;
@@ -226,12 +226,12 @@ void TypeResolver::Visit(TemplateIdNode& templateIdNode)
 {
     span = templateIdNode.GetSpan();
     AddBaseDerivation();
-    Symbol* symbol = currentContainerScope->Lookup(templateIdNode.Id()->Identifier(), ScopeLookup::this_and_bases_and_parent);
+    Symbol* symbol = currentContainerScope->Lookup(templateIdNode.Id()->IdentifierAtom(), ScopeLookup::this_and_bases_and_parent);
     if (!symbol)
     {
         for (const std::unique_ptr<FileScope>& fileScope : boundSourceFile.FileScopes())
         {
-            symbol = fileScope->Lookup(templateIdNode.Id()->Identifier());
+            symbol = fileScope->Lookup(templateIdNode.Id()->IdentifierAtom());
             if (symbol)
             {
                 break;
@@ -5,113 +5,159 @@
 
 #include <gendoc/cppbinder/VirtualBinder.hpp>
 #include <gendoc/cppsym/ParameterSymbol.hpp>
+#include <unordered_map>
 
 namespace gendoc { namespace cppbinder {
 
-bool Overrides(FunctionSymbol* derivedFun, FunctionSymbol* baseFun)
+// Finds the overrides of virtual functions. Functions are matched by a signature consisting of the function name and the ids of its parameter types.
+// Signatures, the transitive base classes of each class and the index of the virtual functions of each class by signature are computed once.
+
+class OverrideSetResolver
+{
+public:
+    void ResolveOverrideSets(ClassTypeSymbol* cls);
+private:
+    const std::u32string& GetSignature(FunctionSymbol* fun);
+    const std::vector<ClassTypeSymbol*>& GetBaseClasses(ClassTypeSymbol* cls);
+    const std::vector<FunctionSymbol*>* GetVirtualFunctions(ClassTypeSymbol* cls, const std::u32string& signature);
+    std::unordered_map<FunctionSymbol*, std::u32string> signatureMap;
+    std::unordered_map<ClassTypeSymbol*, std::vector<ClassTypeSymbol*>> baseClassMap;
+    std::unordered_map<ClassTypeSymbol*, std::unordered_map<std::u32string, std::vector<FunctionSymbol*>>> virtualFunctionMap;
+};
+
+const std::u32string& OverrideSetResolver::GetSignature(FunctionSymbol* fun)
 {
-    if (derivedFun == baseFun) return false;
-    if (derivedFun->Arity() != baseFun->Arity()) return false;
-    if (derivedFun->Name() != baseFun->Name()) return false;
-    int n = derivedFun->Arity();
-    for (int i = 0; i < n; ++i)
+    auto it = signatureMap.find(fun);
+    if (it != signatureMap.cend())
     {
-        ParameterSymbol* derivedParam = derivedFun->Parameters()[i];
-        ParameterSymbol* baseParam = baseFun->Parameters()[i];
-        TypeSymbol* derivedType = derivedParam->GetType();
-        TypeSymbol* baseType = baseParam->GetType();
-        if (derivedType->Id() != baseType->Id()) return false;
+        return it->second;
     }
-    return true;
+    std::u32string signature = fun->Name();
+    for (ParameterSymbol* parameter : fun->Parameters())
+    {
+        signature.append(1, ',').append(parameter->GetType()->Id());
+    }
+    return signatureMap[fun] = signature;
 }
 
-void ResolveOverrideSets(FunctionSymbol* derivedFun, ClassTypeSymbol* parentClass)
+// Returns the direct and indirect base classes of cls, each class once.
+
+const std::vector<ClassTypeSymbol*>& OverrideSetResolver::GetBaseClasses(ClassTypeSymbol* cls)
 {
-    for (TypeSymbol* baseClassType : parentClass->BaseClasses())
+    auto it = baseClassMap.find(cls);
+    if (it != baseClassMap.cend())
+    {
+        return it->second;
+    }
+    std::vector<ClassTypeSymbol*> baseClasses;
+    std::unordered_set<ClassTypeSymbol*> added;
+    for (TypeSymbol* baseClassType : cls->BaseClasses())
     {
         if (baseClassType->IsClassTypeSymbol())
         {
             ClassTypeSymbol* baseClass = static_cast<ClassTypeSymbol*>(baseClassType);
-            for (FunctionSymbol* baseFun : baseClass->VirtualFunctions())
+            if (added.insert(baseClass).second)
             {
-                if (Overrides(derivedFun, baseFun))
+                baseClasses.push_back(baseClass);
+            }
+            for (ClassTypeSymbol* indirectBaseClass : GetBaseClasses(baseClass))
+            {
+                if (added.insert(indirectBaseClass).second)
                 {
-                    derivedFun->AddOverridden(baseFun);
-                    baseFun->AddOverride(derivedFun);
+                    baseClasses.push_back(indirectBaseClass);
                 }
             }
-            ResolveOverrideSets(derivedFun, baseClass);
         }
     }
+    return baseClassMap[cls] = baseClasses;
 }
 
-void CollectPureVirtualFunctions(ClassTypeSymbol* cls, std::unordered_set<FunctionSymbol*>& pureVirtualFunctions)
+// Returns the virtual functions of cls having the given signature, or null if there are none.
+
+const std::vector<FunctionSymbol*>* OverrideSetResolver::GetVirtualFunctions(ClassTypeSymbol* cls, const std::u32string& signature)
 {
-    for (TypeSymbol* baseClassType : cls->BaseClasses())
+    auto it = virtualFunctionMap.find(cls);
+    if (it == virtualFunctionMap.cend())
     {
-        if (baseClassType->IsClassTypeSymbol())
+        std::unordered_map<std::u32string, std::vector<FunctionSymbol*>>& index = virtualFunctionMap[cls];
+        for (FunctionSymbol* virtualFun : cls->VirtualFunctions())
         {
-            ClassTypeSymbol* baseClass = static_cast<ClassTypeSymbol*>(baseClassType);
-            CollectPureVirtualFunctions(baseClass, pureVirtualFunctions);
+            index[GetSignature(virtualFun)].push_back(virtualFun);
         }
+        it = virtualFunctionMap.find(cls);
     }
-    for (FunctionSymbol* virtualFun : cls->VirtualFunctions())
+    auto sit = it->second.find(signature);
+    if (sit != it->second.cend())
     {
-        if (virtualFun->IsPureVirtual())
-        {
-            pureVirtualFunctions.insert(virtualFun);
-        }
+        return &sit->second;
     }
+    return nullptr;
 }
 
-void AddOverriddenPureVirtualFunctions(ClassTypeSymbol* cls, std::unordered_set<FunctionSymbol*>& pureVirtualFunctions, 
-    std::unordered_set<FunctionSymbol*>& overriddenPureVirtuals)
+void OverrideSetResolver::ResolveOverrideSets(ClassTypeSymbol* cls)
 {
-    for (TypeSymbol* baseClassType : cls->BaseClasses())
+    std::vector<ClassTypeSymbol*> hierarchy(1, cls);
+    const std::vector<ClassTypeSymbol*>& baseClasses = GetBaseClasses(cls);
+    hierarchy.insert(hierarchy.end(), baseClasses.begin(), baseClasses.end());
+    bool abstract = false;
+    for (ClassTypeSymbol* c : hierarchy)
     {
-        if (baseClassType->IsClassTypeSymbol())
+        for (FunctionSymbol* pureVirtualFun : c->VirtualFunctions())
         {
-            ClassTypeSymbol* baseClass = static_cast<ClassTypeSymbol*>(baseClassType);
-            AddOverriddenPureVirtualFunctions(baseClass, pureVirtualFunctions, overriddenPureVirtuals);
-        }
-    }
-    for (FunctionSymbol* pureVirtualFunction : pureVirtualFunctions)
-    {
-        for (FunctionSymbol* virtualFun : cls->VirtualFunctions())
-        {
-            if (Overrides(virtualFun, pureVirtualFunction))
+            if (!pureVirtualFun->IsPureVirtual()) continue;
+            const std::u32string& signature = GetSignature(pureVirtualFun);
+            bool overridden = false;
+            for (ClassTypeSymbol* d : hierarchy)
             {
-                overriddenPureVirtuals.insert(pureVirtualFunction);
+                const std::vector<FunctionSymbol*>* functions = GetVirtualFunctions(d, signature);
+                if (!functions) continue;
+                for (FunctionSymbol* virtualFun : *functions)
+                {
+                    if (virtualFun != pureVirtualFun)
+                    {
+                        overridden = true;
+                        break;
+                    }
+                }
+                if (overridden) break;
+            }
+            if (!overridden)
+            {
+                abstract = true;
+                break;
             }
         }
+        if (abstract) break;
     }
-}
-
-void ResolveOverrideSets(ClassTypeSymbol* cls)
-{
-    std::unordered_set<FunctionSymbol*> pureVirtualFunctions;
-    CollectPureVirtualFunctions(cls, pureVirtualFunctions);
-    std::unordered_set<FunctionSymbol*> overriddenPureVirtuals;
-    AddOverriddenPureVirtualFunctions(cls, pureVirtualFunctions, overriddenPureVirtuals);
-    for (FunctionSymbol* overriddenPureVirtual : overriddenPureVirtuals)
-    {
-        pureVirtualFunctions.erase(overriddenPureVirtual);
-    }
-    if (!pureVirtualFunctions.empty())
+    if (abstract)
     {
         cls->SetAbstract();
     }
     for (FunctionSymbol* derivedFun : cls->VirtualFunctions())
     {
-        ResolveOverrideSets(derivedFun, cls);
+        const std::u32string& signature = GetSignature(derivedFun);
+        for (ClassTypeSymbol* baseClass : baseClasses)
+        {
+            const std::vector<FunctionSymbol*>* baseFunctions = GetVirtualFunctions(baseClass, signature);
+            if (!baseFunctions) continue;
+            for (FunctionSymbol* baseFun : *baseFunctions)
+            {
+                if (baseFun != derivedFun)
+                {
+                    derivedFun->AddOverridden(baseFun);
+                    baseFun->AddOverride(derivedFun);
+                }
+            }
+        }
     }
 }
 
 void ResolveOverrideSets(const std::unordered_set<ClassTypeSymbol*>& classes)
 {
+    OverrideSetResolver resolver;
     for (ClassTypeSymbol* cls : classes)
     {
-        ResolveOverrideSets(cls);
+        resolver.ResolveOverrideSets(cls);
     }
 }
 
@@ -58,7 +58,7 @@ ClassNode* Class::Parse(const char32_t* start, const char32_t* end, int fileInde
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<ParsingContext*>(ctx)));
+    stack.Push<ParsingContext*>(ctx);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -76,9 +76,7 @@ ClassNode* Class::Parse(const char32_t* start, const char32_t* end, int fileInde
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    ClassNode* result = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(value.get());
-    stack.pop();
+    ClassNode* result = stack.Pop<ClassNode*>();
     return result;
 }
 
@@ -93,18 +91,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ClassNode*>(context->value)));
+            stack.Push<ClassNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -124,16 +119,14 @@ public:
     void PreClassSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassSpecifier_value = std::move(stack.top());
-            context->fromClassSpecifier = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(fromClassSpecifier_value.get());
-            stack.pop();
+            context->fromClassSpecifier = stack.Pop<ClassNode*>();
         }
     }
 private:
@@ -158,18 +151,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -200,24 +190,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassKey_value = std::move(stack.top());
-            context->fromClassKey = *static_cast<gendoc::parsing::ValueObject<ClassKey>*>(fromClassKey_value.get());
-            stack.pop();
+            context->fromClassKey = stack.Pop<ClassKey>();
         }
     }
     void PreClassName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassName_value = std::move(stack.top());
-            context->fromClassName = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromClassName_value.get());
-            stack.pop();
+            context->fromClassName = stack.Pop<Node*>();
         }
     }
 private:
@@ -244,18 +230,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ClassNode*>(context->value)));
+            stack.Push<ClassNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -298,23 +281,21 @@ public:
     void PreClassHead(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassHead(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassHead_value = std::move(stack.top());
-            context->fromClassHead = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(fromClassHead_value.get());
-            stack.pop();
+            context->fromClassHead = stack.Pop<ClassNode*>();
         }
     }
     void PreMemberSpecifications(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ClassNode*>(context->classNode.get())));
+        stack.Push<ParsingContext*>(context->ctx);
+        stack.Push<ClassNode*>(context->classNode.get());
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -338,14 +319,9 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> classNode_value = std::move(stack.top());
-        context->classNode = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(classNode_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->classNode = stack.Pop<ClassNode*>();
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -359,8 +335,8 @@ public:
     void PreMemberSpecification(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ClassNode*>(context->classNode)));
+        stack.Push<ParsingContext*>(context->ctx);
+        stack.Push<ClassNode*>(context->classNode);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -383,14 +359,9 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> classNode_value = std::move(stack.top());
-        context->classNode = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(classNode_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->classNode = stack.Pop<ClassNode*>();
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -435,39 +406,33 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAccessSpecifier_value = std::move(stack.top());
-            context->fromAccessSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromAccessSpecifier_value.get());
-            stack.pop();
+            context->fromAccessSpecifier = stack.Pop<Specifier>();
         }
     }
     void Prem1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postm1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromm1_value = std::move(stack.top());
-            context->fromm1 = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromm1_value.get());
-            stack.pop();
+            context->fromm1 = stack.Pop<Node*>();
         }
     }
     void Prem2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postm2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromm2_value = std::move(stack.top());
-            context->fromm2 = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromm2_value.get());
-            stack.pop();
+            context->fromm2 = stack.Pop<Node*>();
         }
     }
 private:
@@ -497,18 +462,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -662,219 +624,189 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclSpecifiers_value = std::move(stack.top());
-            context->fromDeclSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromDeclSpecifiers_value.get());
-            stack.pop();
+            context->fromDeclSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeExpr_value = std::move(stack.top());
-            context->fromTypeExpr = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTypeExpr_value.get());
-            stack.pop();
+            context->fromTypeExpr = stack.Pop<Node*>();
         }
     }
     void PreDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<Node*>();
         }
     }
     void PreVirtPureSpecifiers(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<bool>(IsFunctionDeclarator(context->declarator.get()))));
+        stack.Push<bool>(IsFunctionDeclarator(context->declarator.get()));
     }
     void PostVirtPureSpecifiers(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromVirtPureSpecifiers_value = std::move(stack.top());
-            context->fromVirtPureSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromVirtPureSpecifiers_value.get());
-            stack.pop();
+            context->fromVirtPureSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreBraceOrEqualInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBraceOrEqualInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBraceOrEqualInitializer_value = std::move(stack.top());
-            context->fromBraceOrEqualInitializer = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromBraceOrEqualInitializer_value.get());
-            stack.pop();
+            context->fromBraceOrEqualInitializer = stack.Pop<Node*>();
         }
     }
     void PreSpecialMemberFunctionDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostSpecialMemberFunctionDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSpecialMemberFunctionDeclaration_value = std::move(stack.top());
-            context->fromSpecialMemberFunctionDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromSpecialMemberFunctionDeclaration_value.get());
-            stack.pop();
+            context->fromSpecialMemberFunctionDeclaration = stack.Pop<Node*>();
         }
     }
     void PreFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionDefinition_value = std::move(stack.top());
-            context->fromFunctionDefinition = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromFunctionDefinition_value.get());
-            stack.pop();
+            context->fromFunctionDefinition = stack.Pop<Node*>();
         }
     }
     void PreSpecialMemberFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostSpecialMemberFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSpecialMemberFunctionDefinition_value = std::move(stack.top());
-            context->fromSpecialMemberFunctionDefinition = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromSpecialMemberFunctionDefinition_value.get());
-            stack.pop();
+            context->fromSpecialMemberFunctionDefinition = stack.Pop<Node*>();
         }
     }
     void PreUsingDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostUsingDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDeclaration_value = std::move(stack.top());
-            context->fromUsingDeclaration = *static_cast<gendoc::parsing::ValueObject<UsingDeclarationNode*>*>(fromUsingDeclaration_value.get());
-            stack.pop();
+            context->fromUsingDeclaration = stack.Pop<UsingDeclarationNode*>();
         }
     }
     void PreTypedefDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypedefDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypedefDeclaration_value = std::move(stack.top());
-            context->fromTypedefDeclaration = *static_cast<gendoc::parsing::ValueObject<TypedefNode*>*>(fromTypedefDeclaration_value.get());
-            stack.pop();
+            context->fromTypedefDeclaration = stack.Pop<TypedefNode*>();
         }
     }
     void PreTemplateDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTemplateDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTemplateDeclaration_value = std::move(stack.top());
-            context->fromTemplateDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTemplateDeclaration_value.get());
-            stack.pop();
+            context->fromTemplateDeclaration = stack.Pop<Node*>();
         }
     }
     void PreClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassDeclaration_value = std::move(stack.top());
-            context->fromClassDeclaration = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(fromClassDeclaration_value.get());
-            stack.pop();
+            context->fromClassDeclaration = stack.Pop<ClassNode*>();
         }
     }
     void PreEnumDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumDeclaration_value = std::move(stack.top());
-            context->fromEnumDeclaration = *static_cast<gendoc::parsing::ValueObject<EnumTypeNode*>*>(fromEnumDeclaration_value.get());
-            stack.pop();
+            context->fromEnumDeclaration = stack.Pop<EnumTypeNode*>();
         }
     }
     void PreAliasDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostAliasDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAliasDeclaration_value = std::move(stack.top());
-            context->fromAliasDeclaration = *static_cast<gendoc::parsing::ValueObject<AliasDeclarationNode*>*>(fromAliasDeclaration_value.get());
-            stack.pop();
+            context->fromAliasDeclaration = stack.Pop<AliasDeclarationNode*>();
         }
     }
     void PreForwardClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostForwardClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromForwardClassDeclaration_value = std::move(stack.top());
-            context->fromForwardClassDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromForwardClassDeclaration_value.get());
-            stack.pop();
+            context->fromForwardClassDeclaration = stack.Pop<Node*>();
         }
     }
 private:
@@ -916,18 +848,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -962,39 +891,33 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclSpecifiers_value = std::move(stack.top());
-            context->fromDeclSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromDeclSpecifiers_value.get());
-            stack.pop();
+            context->fromDeclSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<Node*>();
         }
     }
     void PreVirtPureSpecifiers(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<bool>(true)));
+        stack.Push<bool>(true);
     }
     void PostVirtPureSpecifiers(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromVirtPureSpecifiers_value = std::move(stack.top());
-            context->fromVirtPureSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromVirtPureSpecifiers_value.get());
-            stack.pop();
+            context->fromVirtPureSpecifiers = stack.Pop<Specifier>();
         }
     }
 private:
@@ -1022,18 +945,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ClassNode*>(context->value)));
+            stack.Push<ClassNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1069,24 +989,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassKey_value = std::move(stack.top());
-            context->fromClassKey = *static_cast<gendoc::parsing::ValueObject<ClassKey>*>(fromClassKey_value.get());
-            stack.pop();
+            context->fromClassKey = stack.Pop<ClassKey>();
         }
     }
     void PreClassName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassName_value = std::move(stack.top());
-            context->fromClassName = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromClassName_value.get());
-            stack.pop();
+            context->fromClassName = stack.Pop<Node*>();
         }
     }
     void PostClassVirtSpecifiers(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1094,24 +1010,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassVirtSpecifiers_value = std::move(stack.top());
-            context->fromClassVirtSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromClassVirtSpecifiers_value.get());
-            stack.pop();
+            context->fromClassVirtSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreBaseClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBaseClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBaseClause_value = std::move(stack.top());
-            context->fromBaseClause = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromBaseClause_value.get());
-            stack.pop();
+            context->fromBaseClause = stack.Pop<Node*>();
         }
     }
 private:
@@ -1138,15 +1050,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ClassKey>(context->value)));
+            stack.Push<ClassKey>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1193,18 +1104,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1224,16 +1132,14 @@ public:
     void PreQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedIdNode_value = std::move(stack.top());
-            context->fromQualifiedIdNode = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromQualifiedIdNode_value.get());
-            stack.pop();
+            context->fromQualifiedIdNode = stack.Pop<Node*>();
         }
     }
 private:
@@ -1256,15 +1162,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1285,9 +1190,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassVirtSpecifier_value = std::move(stack.top());
-            context->fromClassVirtSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromClassVirtSpecifier_value.get());
-            stack.pop();
+            context->fromClassVirtSpecifier = stack.Pop<Specifier>();
         }
     }
 private:
@@ -1309,15 +1212,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1357,18 +1259,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1388,16 +1287,14 @@ public:
     void PreBaseClassSpecifierList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBaseClassSpecifierList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBaseClassSpecifierList_value = std::move(stack.top());
-            context->fromBaseClassSpecifierList = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromBaseClassSpecifierList_value.get());
-            stack.pop();
+            context->fromBaseClassSpecifierList = stack.Pop<Node*>();
         }
     }
 private:
@@ -1423,18 +1320,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1473,31 +1367,27 @@ public:
     void Preb1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postb1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromb1_value = std::move(stack.top());
-            context->fromb1 = *static_cast<gendoc::parsing::ValueObject<BaseClassSpecifierNode*>*>(fromb1_value.get());
-            stack.pop();
+            context->fromb1 = stack.Pop<BaseClassSpecifierNode*>();
         }
     }
     void Preb2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postb2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromb2_value = std::move(stack.top());
-            context->fromb2 = *static_cast<gendoc::parsing::ValueObject<BaseClassSpecifierNode*>*>(fromb2_value.get());
-            stack.pop();
+            context->fromb2 = stack.Pop<BaseClassSpecifierNode*>();
         }
     }
 private:
@@ -1524,18 +1414,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<BaseClassSpecifierNode*>(context->value)));
+            stack.Push<BaseClassSpecifierNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1559,24 +1446,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBaseSpecifiers_value = std::move(stack.top());
-            context->fromBaseSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromBaseSpecifiers_value.get());
-            stack.pop();
+            context->fromBaseSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreClassName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassName_value = std::move(stack.top());
-            context->fromClassName = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromClassName_value.get());
-            stack.pop();
+            context->fromClassName = stack.Pop<Node*>();
         }
     }
 private:
@@ -1600,15 +1483,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1629,9 +1511,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBaseSpecifier_value = std::move(stack.top());
-            context->fromBaseSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromBaseSpecifier_value.get());
-            stack.pop();
+            context->fromBaseSpecifier = stack.Pop<Specifier>();
         }
     }
 private:
@@ -1653,15 +1533,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1689,9 +1568,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAccessSpecifier_value = std::move(stack.top());
-            context->fromAccessSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromAccessSpecifier_value.get());
-            stack.pop();
+            context->fromAccessSpecifier = stack.Pop<Specifier>();
         }
     }
 private:
@@ -1713,15 +1590,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1768,18 +1644,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> functionMember_value = std::move(stack.top());
-        context->functionMember = *static_cast<gendoc::parsing::ValueObject<bool>*>(functionMember_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->functionMember = stack.Pop<bool>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1809,31 +1682,27 @@ public:
     void PreVirtSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<bool>(context->functionMember)));
+        stack.Push<bool>(context->functionMember);
     }
     void PostVirtSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromVirtSpecifier_value = std::move(stack.top());
-            context->fromVirtSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromVirtSpecifier_value.get());
-            stack.pop();
+            context->fromVirtSpecifier = stack.Pop<Specifier>();
         }
     }
     void PrePureSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<bool>(context->functionMember)));
+        stack.Push<bool>(context->functionMember);
     }
     void PostPureSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPureSpecifier_value = std::move(stack.top());
-            context->fromPureSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromPureSpecifier_value.get());
-            stack.pop();
+            context->fromPureSpecifier = stack.Pop<Specifier>();
         }
     }
 private:
@@ -1858,18 +1727,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> functionMember_value = std::move(stack.top());
-        context->functionMember = *static_cast<gendoc::parsing::ValueObject<bool>*>(functionMember_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->functionMember = stack.Pop<bool>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1920,18 +1786,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> functionMember_value = std::move(stack.top());
-        context->functionMember = *static_cast<gendoc::parsing::ValueObject<bool>*>(functionMember_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->functionMember = stack.Pop<bool>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1969,18 +1832,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2039,54 +1899,46 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclSpecifiers_value = std::move(stack.top());
-            context->fromDeclSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromDeclSpecifiers_value.get());
-            stack.pop();
+            context->fromDeclSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<Node*>();
         }
     }
     void PreCtorInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostCtorInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCtorInitializer_value = std::move(stack.top());
-            context->fromCtorInitializer = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromCtorInitializer_value.get());
-            stack.pop();
+            context->fromCtorInitializer = stack.Pop<Node*>();
         }
     }
     void PreFunctionBody(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostFunctionBody(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionBody_value = std::move(stack.top());
-            context->fromFunctionBody = *static_cast<gendoc::parsing::ValueObject<CompoundStatementNode*>*>(fromFunctionBody_value.get());
-            stack.pop();
+            context->fromFunctionBody = stack.Pop<CompoundStatementNode*>();
         }
     }
 private:
@@ -2116,18 +1968,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2147,16 +1996,14 @@ public:
     void PreMemberInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostMemberInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromMemberInitializerList_value = std::move(stack.top());
-            context->fromMemberInitializerList = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromMemberInitializerList_value.get());
-            stack.pop();
+            context->fromMemberInitializerList = stack.Pop<Node*>();
         }
     }
 private:
@@ -2181,18 +2028,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2229,31 +2073,27 @@ public:
     void Preleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<MemberInitializerNode*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<MemberInitializerNode*>();
         }
     }
     void Preright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<MemberInitializerNode*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<MemberInitializerNode*>();
         }
     }
 private:
@@ -2281,18 +2121,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<MemberInitializerNode*>(context->value)));
+            stack.Push<MemberInitializerNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2349,61 +2186,53 @@ public:
     void Preid1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postid1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromid1_value = std::move(stack.top());
-            context->fromid1 = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromid1_value.get());
-            stack.pop();
+            context->fromid1 = stack.Pop<Node*>();
         }
     }
     void Preargs(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postargs(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromargs_value = std::move(stack.top());
-            context->fromargs = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromargs_value.get());
-            stack.pop();
+            context->fromargs = stack.Pop<Node*>();
         }
     }
     void Preid2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postid2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromid2_value = std::move(stack.top());
-            context->fromid2 = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromid2_value.get());
-            stack.pop();
+            context->fromid2 = stack.Pop<Node*>();
         }
     }
     void PreBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBracedInitializerList_value = std::move(stack.top());
-            context->fromBracedInitializerList = *static_cast<gendoc::parsing::ValueObject<BracedInitializerListNode*>*>(fromBracedInitializerList_value.get());
-            stack.pop();
+            context->fromBracedInitializerList = stack.Pop<BracedInitializerListNode*>();
         }
     }
 private:
@@ -2432,18 +2261,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2463,16 +2289,14 @@ public:
     void PreQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedIdNode_value = std::move(stack.top());
-            context->fromQualifiedIdNode = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromQualifiedIdNode_value.get());
-            stack.pop();
+            context->fromQualifiedIdNode = stack.Pop<Node*>();
         }
     }
 private:
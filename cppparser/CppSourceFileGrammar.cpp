@@ -50,7 +50,7 @@ void CppSourceFile::Parse(const char32_t* start, const char32_t* end, int fileIn
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<SourceFileNode*>(sourceFile)));
+    stack.Push<SourceFileNode*>(sourceFile);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -81,11 +81,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> sourceFile_value = std::move(stack.top());
-        context->sourceFile = *static_cast<gendoc::parsing::ValueObject<SourceFileNode*>*>(sourceFile_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->sourceFile = stack.Pop<SourceFileNode*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -106,8 +103,8 @@ public:
     void PreDeclarations(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<NamespaceNode*>(context->sourceFile->GlobalNs())));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(&context->ctx)));
+        stack.Push<NamespaceNode*>(context->sourceFile->GlobalNs());
+        stack.Push<ParsingContext*>(&context->ctx);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -129,14 +126,9 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> ns_value = std::move(stack.top());
-        context->ns = *static_cast<gendoc::parsing::ValueObject<NamespaceNode*>*>(ns_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
+        context->ns = stack.Pop<NamespaceNode*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -158,16 +150,14 @@ public:
     void PreDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclaration_value = std::move(stack.top());
-            context->fromDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromDeclaration_value.get());
-            stack.pop();
+            context->fromDeclaration = stack.Pop<Node*>();
         }
     }
 private:
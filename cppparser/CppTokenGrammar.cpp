@@ -50,7 +50,7 @@ void CppToken::Parse(const char32_t* start, const char32_t* end, int fileIndex,
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<SourceCodeWriter*>(writer)));
+    stack.Push<SourceCodeWriter*>(writer);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -80,11 +80,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> writer_value = std::move(stack.top());
-        context->writer = *static_cast<gendoc::parsing::ValueObject<SourceCodeWriter*>*>(writer_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->writer = stack.Pop<SourceCodeWriter*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -98,7 +95,7 @@ public:
     void PreSourceToken(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<SourceCodeWriter*>(context->writer)));
+        stack.Push<SourceCodeWriter*>(context->writer);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -118,11 +115,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> writer_value = std::move(stack.top());
-        context->writer = *static_cast<gendoc::parsing::ValueObject<SourceCodeWriter*>*>(writer_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->writer = stack.Pop<SourceCodeWriter*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -205,9 +199,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromidentifier_value = std::move(stack.top());
-            context->fromidentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromidentifier_value.get());
-            stack.pop();
+            context->fromidentifier = stack.Pop<std::u32string>();
         }
     }
     void Poststring(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -215,9 +207,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromstring_value = std::move(stack.top());
-            context->fromstring = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromstring_value.get());
-            stack.pop();
+            context->fromstring = stack.Pop<std::u32string>();
         }
     }
     void Postchar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -225,9 +215,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromchar_value = std::move(stack.top());
-            context->fromchar = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromchar_value.get());
-            stack.pop();
+            context->fromchar = stack.Pop<char32_t>();
         }
     }
 private:
@@ -56,7 +56,7 @@ Node* Declaration::Parse(const char32_t* start, const char32_t* end, int fileInd
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<ParsingContext*>(ctx)));
+    stack.Push<ParsingContext*>(ctx);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -74,9 +74,7 @@ Node* Declaration::Parse(const char32_t* start, const char32_t* end, int fileInd
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    Node* result = *static_cast<gendoc::parsing::ValueObject<Node*>*>(value.get());
-    stack.pop();
+    Node* result = stack.Pop<Node*>();
     return result;
 }
 
@@ -91,18 +89,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -212,151 +207,131 @@ public:
     void PreNamespaceDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostNamespaceDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNamespaceDefinition_value = std::move(stack.top());
-            context->fromNamespaceDefinition = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromNamespaceDefinition_value.get());
-            stack.pop();
+            context->fromNamespaceDefinition = stack.Pop<Node*>();
         }
     }
     void PreFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionDefinition_value = std::move(stack.top());
-            context->fromFunctionDefinition = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromFunctionDefinition_value.get());
-            stack.pop();
+            context->fromFunctionDefinition = stack.Pop<Node*>();
         }
     }
     void PreSpecialMemberFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostSpecialMemberFunctionDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSpecialMemberFunctionDefinition_value = std::move(stack.top());
-            context->fromSpecialMemberFunctionDefinition = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromSpecialMemberFunctionDefinition_value.get());
-            stack.pop();
+            context->fromSpecialMemberFunctionDefinition = stack.Pop<Node*>();
         }
     }
     void PreTemplateDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTemplateDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTemplateDeclaration_value = std::move(stack.top());
-            context->fromTemplateDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTemplateDeclaration_value.get());
-            stack.pop();
+            context->fromTemplateDeclaration = stack.Pop<Node*>();
         }
     }
     void PreExplicitInstantiation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostExplicitInstantiation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExplicitInstantiation_value = std::move(stack.top());
-            context->fromExplicitInstantiation = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromExplicitInstantiation_value.get());
-            stack.pop();
+            context->fromExplicitInstantiation = stack.Pop<Node*>();
         }
     }
     void PreExplicitSpecialization(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostExplicitSpecialization(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExplicitSpecialization_value = std::move(stack.top());
-            context->fromExplicitSpecialization = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromExplicitSpecialization_value.get());
-            stack.pop();
+            context->fromExplicitSpecialization = stack.Pop<Node*>();
         }
     }
     void PreClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClassDeclaration_value = std::move(stack.top());
-            context->fromClassDeclaration = *static_cast<gendoc::parsing::ValueObject<ClassNode*>*>(fromClassDeclaration_value.get());
-            stack.pop();
+            context->fromClassDeclaration = stack.Pop<ClassNode*>();
         }
     }
     void PreEnumDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumDeclaration_value = std::move(stack.top());
-            context->fromEnumDeclaration = *static_cast<gendoc::parsing::ValueObject<EnumTypeNode*>*>(fromEnumDeclaration_value.get());
-            stack.pop();
+            context->fromEnumDeclaration = stack.Pop<EnumTypeNode*>();
         }
     }
     void PreLinkageSpecification(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostLinkageSpecification(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLinkageSpecification_value = std::move(stack.top());
-            context->fromLinkageSpecification = *static_cast<gendoc::parsing::ValueObject<LinkageSpecificationNode*>*>(fromLinkageSpecification_value.get());
-            stack.pop();
+            context->fromLinkageSpecification = stack.Pop<LinkageSpecificationNode*>();
         }
     }
     void PreBlockDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBlockDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBlockDeclaration_value = std::move(stack.top());
-            context->fromBlockDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromBlockDeclaration_value.get());
-            stack.pop();
+            context->fromBlockDeclaration = stack.Pop<Node*>();
         }
     }
 private:
@@ -389,18 +364,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -430,31 +402,27 @@ public:
     void PreNamedNamespaceDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostNamedNamespaceDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNamedNamespaceDefinition_value = std::move(stack.top());
-            context->fromNamedNamespaceDefinition = *static_cast<gendoc::parsing::ValueObject<NamespaceNode*>*>(fromNamedNamespaceDefinition_value.get());
-            stack.pop();
+            context->fromNamedNamespaceDefinition = stack.Pop<NamespaceNode*>();
         }
     }
     void PreUnnamedNamespaceDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostUnnamedNamespaceDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUnnamedNamespaceDefinition_value = std::move(stack.top());
-            context->fromUnnamedNamespaceDefinition = *static_cast<gendoc::parsing::ValueObject<NamespaceNode*>*>(fromUnnamedNamespaceDefinition_value.get());
-            stack.pop();
+            context->fromUnnamedNamespaceDefinition = stack.Pop<NamespaceNode*>();
         }
     }
 private:
@@ -480,18 +448,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<NamespaceNode*>(context->value)));
+            stack.Push<NamespaceNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -521,16 +486,14 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
     void PreDeclarations(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<NamespaceNode*>(context->ns.get())));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<NamespaceNode*>(context->ns.get());
+        stack.Push<ParsingContext*>(context->ctx);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -555,18 +518,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<NamespaceNode*>(context->value)));
+            stack.Push<NamespaceNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -592,8 +552,8 @@ public:
     void PreDeclarations(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<NamespaceNode*>(context->ns.get())));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<NamespaceNode*>(context->ns.get());
+        stack.Push<ParsingContext*>(context->ctx);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -616,18 +576,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -707,106 +664,92 @@ public:
     void PreSimpleDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostSimpleDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSimpleDeclaration_value = std::move(stack.top());
-            context->fromSimpleDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromSimpleDeclaration_value.get());
-            stack.pop();
+            context->fromSimpleDeclaration = stack.Pop<Node*>();
         }
     }
     void PreAliasDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostAliasDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAliasDeclaration_value = std::move(stack.top());
-            context->fromAliasDeclaration = *static_cast<gendoc::parsing::ValueObject<AliasDeclarationNode*>*>(fromAliasDeclaration_value.get());
-            stack.pop();
+            context->fromAliasDeclaration = stack.Pop<AliasDeclarationNode*>();
         }
     }
     void PreUsingDirective(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostUsingDirective(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDirective_value = std::move(stack.top());
-            context->fromUsingDirective = *static_cast<gendoc::parsing::ValueObject<UsingDirectiveNode*>*>(fromUsingDirective_value.get());
-            stack.pop();
+            context->fromUsingDirective = stack.Pop<UsingDirectiveNode*>();
         }
     }
     void PreUsingDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostUsingDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDeclaration_value = std::move(stack.top());
-            context->fromUsingDeclaration = *static_cast<gendoc::parsing::ValueObject<UsingDeclarationNode*>*>(fromUsingDeclaration_value.get());
-            stack.pop();
+            context->fromUsingDeclaration = stack.Pop<UsingDeclarationNode*>();
         }
     }
     void PreOpaqueEnumDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostOpaqueEnumDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOpaqueEnumDeclaration_value = std::move(stack.top());
-            context->fromOpaqueEnumDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromOpaqueEnumDeclaration_value.get());
-            stack.pop();
+            context->fromOpaqueEnumDeclaration = stack.Pop<Node*>();
         }
     }
     void PreTypedefDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypedefDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypedefDeclaration_value = std::move(stack.top());
-            context->fromTypedefDeclaration = *static_cast<gendoc::parsing::ValueObject<TypedefNode*>*>(fromTypedefDeclaration_value.get());
-            stack.pop();
+            context->fromTypedefDeclaration = stack.Pop<TypedefNode*>();
         }
     }
     void PreForwardClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostForwardClassDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromForwardClassDeclaration_value = std::move(stack.top());
-            context->fromForwardClassDeclaration = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromForwardClassDeclaration_value.get());
-            stack.pop();
+            context->fromForwardClassDeclaration = stack.Pop<Node*>();
         }
     }
 private:
@@ -838,18 +781,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -890,39 +830,33 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclSpecifiers_value = std::move(stack.top());
-            context->fromDeclSpecifiers = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromDeclSpecifiers_value.get());
-            stack.pop();
+            context->fromDeclSpecifiers = stack.Pop<Specifier>();
         }
     }
     void PreTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeExpr_value = std::move(stack.top());
-            context->fromTypeExpr = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTypeExpr_value.get());
-            stack.pop();
+            context->fromTypeExpr = stack.Pop<Node*>();
         }
     }
     void PreInitDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostInitDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitDeclarator_value = std::move(stack.top());
-            context->fromInitDeclarator = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromInitDeclarator_value.get());
-            stack.pop();
+            context->fromInitDeclarator = stack.Pop<Node*>();
         }
     }
 private:
@@ -949,15 +883,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -978,9 +911,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclSpecifier_value = std::move(stack.top());
-            context->fromDeclSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromDeclSpecifier_value.get());
-            stack.pop();
+            context->fromDeclSpecifier = stack.Pop<Specifier>();
         }
     }
 private:
@@ -1002,15 +933,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1070,9 +1000,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStorageClassSpecifier_value = std::move(stack.top());
-            context->fromStorageClassSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromStorageClassSpecifier_value.get());
-            stack.pop();
+            context->fromStorageClassSpecifier = stack.Pop<Specifier>();
         }
     }
     void PostFunctionSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1080,9 +1008,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionSpecifier_value = std::move(stack.top());
-            context->fromFunctionSpecifier = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromFunctionSpecifier_value.get());
-            stack.pop();
+            context->fromFunctionSpecifier = stack.Pop<Specifier>();
         }
     }
     void PostIdentifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1090,9 +1016,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1116,15 +1040,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1184,15 +1107,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Specifier>(context->value)));
+            stack.Push<Specifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1239,18 +1161,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<AliasDeclarationNode*>(context->value)));
+            stack.Push<AliasDeclarationNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1274,24 +1193,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
     void PreTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeExpr_value = std::move(stack.top());
-            context->fromTypeExpr = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTypeExpr_value.get());
-            stack.pop();
+            context->fromTypeExpr = stack.Pop<Node*>();
         }
     }
 private:
@@ -1316,18 +1231,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<UsingDirectiveNode*>(context->value)));
+            stack.Push<UsingDirectiveNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1348,16 +1260,14 @@ public:
     void PreQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedIdNode_value = std::move(stack.top());
-            context->fromQualifiedIdNode = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromQualifiedIdNode_value.get());
-            stack.pop();
+            context->fromQualifiedIdNode = stack.Pop<Node*>();
         }
     }
 private:
@@ -1382,18 +1292,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<UsingDeclarationNode*>(context->value)));
+            stack.Push<UsingDeclarationNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1421,16 +1328,14 @@ public:
     void PreQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedIdNode_value = std::move(stack.top());
-            context->fromQualifiedIdNode = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromQualifiedIdNode_value.get());
-            stack.pop();
+            context->fromQualifiedIdNode = stack.Pop<Node*>();
         }
     }
 private:
@@ -1455,18 +1360,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<TypedefNode*>(context->value)));
+            stack.Push<TypedefNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1489,31 +1391,27 @@ public:
     void PreTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeExpr_value = std::move(stack.top());
-            context->fromTypeExpr = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTypeExpr_value.get());
-            stack.pop();
+            context->fromTypeExpr = stack.Pop<Node*>();
         }
     }
     void PreDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<Node*>();
         }
     }
 private:
@@ -1539,18 +1437,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<LinkageSpecificationNode*>(context->value)));
+            stack.Push<LinkageSpecificationNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1598,39 +1493,33 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStringLiteral_value = std::move(stack.top());
-            context->fromStringLiteral = *static_cast<gendoc::parsing::ValueObject<StringLiteralNode*>*>(fromStringLiteral_value.get());
-            stack.pop();
+            context->fromStringLiteral = stack.Pop<StringLiteralNode*>();
         }
     }
     void Pred1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postd1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromd1_value = std::move(stack.top());
-            context->fromd1 = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromd1_value.get());
-            stack.pop();
+            context->fromd1 = stack.Pop<Node*>();
         }
     }
     void Pred2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postd2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromd2_value = std::move(stack.top());
-            context->fromd2 = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromd2_value.get());
-            stack.pop();
+            context->fromd2 = stack.Pop<Node*>();
         }
     }
 private:
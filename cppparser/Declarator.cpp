@@ -53,7 +53,7 @@ Node* Declarator::Parse(const char32_t* start, const char32_t* end, int fileInde
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<ParsingContext*>(ctx)));
+    stack.Push<ParsingContext*>(ctx);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -71,9 +71,7 @@ Node* Declarator::Parse(const char32_t* start, const char32_t* end, int fileInde
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    Node* result = *static_cast<gendoc::parsing::ValueObject<Node*>*>(value.get());
-    stack.pop();
+    Node* result = stack.Pop<Node*>();
     return result;
 }
 
@@ -90,18 +88,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -140,31 +135,27 @@ public:
     void PreDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<Node*>();
         }
     }
     void PreInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostInitializer(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitializer_value = std::move(stack.top());
-            context->fromInitializer = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromInitializer_value.get());
-            stack.pop();
+            context->fromInitializer = stack.Pop<Node*>();
         }
     }
 private:
@@ -193,18 +184,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -291,16 +279,14 @@ public:
     void PreIdExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostIdExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdExpression_value = std::move(stack.top());
-            context->fromIdExpression = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromIdExpression_value.get());
-            stack.pop();
+            context->fromIdExpression = stack.Pop<Node*>();
         }
     }
     void Postid1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -308,24 +294,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromid1_value = std::move(stack.top());
-            context->fromid1 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromid1_value.get());
-            stack.pop();
+            context->fromid1 = stack.Pop<std::u32string>();
         }
     }
     void PreNestedNameSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostNestedNameSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNestedNameSpecifier_value = std::move(stack.top());
-            context->fromNestedNameSpecifier = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromNestedNameSpecifier_value.get());
-            stack.pop();
+            context->fromNestedNameSpecifier = stack.Pop<Node*>();
         }
     }
     void Postid2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -333,24 +315,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromid2_value = std::move(stack.top());
-            context->fromid2 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromid2_value.get());
-            stack.pop();
+            context->fromid2 = stack.Pop<std::u32string>();
         }
     }
     void PreParameterList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostParameterList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromParameterList_value = std::move(stack.top());
-            context->fromParameterList = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromParameterList_value.get());
-            stack.pop();
+            context->fromParameterList = stack.Pop<Node*>();
         }
     }
     void PostCVSpecifierSequence(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -358,24 +336,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCVSpecifierSequence_value = std::move(stack.top());
-            context->fromCVSpecifierSequence = *static_cast<gendoc::parsing::ValueObject<Specifier>*>(fromCVSpecifierSequence_value.get());
-            stack.pop();
+            context->fromCVSpecifierSequence = stack.Pop<Specifier>();
         }
     }
     void Presize(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postsize(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromsize_value = std::move(stack.top());
-            context->fromsize = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromsize_value.get());
-            stack.pop();
+            context->fromsize = stack.Pop<Node*>();
         }
     }
 private:
@@ -407,18 +381,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -458,46 +429,40 @@ public:
     void PreInitializerClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostInitializerClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitializerClause_value = std::move(stack.top());
-            context->fromInitializerClause = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromInitializerClause_value.get());
-            stack.pop();
+            context->fromInitializerClause = stack.Pop<Node*>();
         }
     }
     void PreExpressionList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostExpressionList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = stack.Pop<Node*>();
         }
     }
     void PreBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBracedInitializerList_value = std::move(stack.top());
-            context->fromBracedInitializerList = *static_cast<gendoc::parsing::ValueObject<BracedInitializerListNode*>*>(fromBracedInitializerList_value.get());
-            stack.pop();
+            context->fromBracedInitializerList = stack.Pop<BracedInitializerListNode*>();
         }
     }
 private:
@@ -523,18 +488,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -564,31 +526,27 @@ public:
     void PreInitializerClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostInitializerClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitializerClause_value = std::move(stack.top());
-            context->fromInitializerClause = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromInitializerClause_value.get());
-            stack.pop();
+            context->fromInitializerClause = stack.Pop<Node*>();
         }
     }
     void PreBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBracedInitializerList_value = std::move(stack.top());
-            context->fromBracedInitializerList = *static_cast<gendoc::parsing::ValueObject<BracedInitializerListNode*>*>(fromBracedInitializerList_value.get());
-            stack.pop();
+            context->fromBracedInitializerList = stack.Pop<BracedInitializerListNode*>();
         }
     }
 private:
@@ -615,18 +573,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<BracedInitializerListNode*>(context->value)));
+            stack.Push<BracedInitializerListNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -675,31 +630,27 @@ public:
     void Preleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<Node*>();
         }
     }
     void Preright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<Node*>();
         }
     }
 private:
@@ -726,18 +677,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -767,31 +715,27 @@ public:
     void PreAssignmentExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostAssignmentExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAssignmentExpression_value = std::move(stack.top());
-            context->fromAssignmentExpression = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromAssignmentExpression_value.get());
-            stack.pop();
+            context->fromAssignmentExpression = stack.Pop<Node*>();
         }
     }
     void PreBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostBracedInitializerList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBracedInitializerList_value = std::move(stack.top());
-            context->fromBracedInitializerList = *static_cast<gendoc::parsing::ValueObject<BracedInitializerListNode*>*>(fromBracedInitializerList_value.get());
-            stack.pop();
+            context->fromBracedInitializerList = stack.Pop<BracedInitializerListNode*>();
         }
     }
 private:
@@ -818,18 +762,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -868,31 +809,27 @@ public:
     void Preleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<Node*>();
         }
     }
     void Preright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<Node*>();
         }
     }
 private:
@@ -52,7 +52,7 @@ EnumTypeNode* Enumeration::Parse(const char32_t* start, const char32_t* end, int
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<ParsingContext*>(ctx)));
+    stack.Push<ParsingContext*>(ctx);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -70,9 +70,7 @@ EnumTypeNode* Enumeration::Parse(const char32_t* start, const char32_t* end, int
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    EnumTypeNode* result = *static_cast<gendoc::parsing::ValueObject<EnumTypeNode*>*>(value.get());
-    stack.pop();
+    EnumTypeNode* result = stack.Pop<EnumTypeNode*>();
     return result;
 }
 
@@ -87,18 +85,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<EnumTypeNode*>(context->value)));
+            stack.Push<EnumTypeNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -118,16 +113,14 @@ public:
     void PreEnumSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumSpecifier_value = std::move(stack.top());
-            context->fromEnumSpecifier = *static_cast<gendoc::parsing::ValueObject<EnumTypeNode*>*>(fromEnumSpecifier_value.get());
-            stack.pop();
+            context->fromEnumSpecifier = stack.Pop<EnumTypeNode*>();
         }
     }
 private:
@@ -153,18 +146,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -205,39 +195,33 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumKey_value = std::move(stack.top());
-            context->fromEnumKey = *static_cast<gendoc::parsing::ValueObject<EnumKey>*>(fromEnumKey_value.get());
-            stack.pop();
+            context->fromEnumKey = stack.Pop<EnumKey>();
         }
     }
     void PreEnumName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumName_value = std::move(stack.top());
-            context->fromEnumName = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromEnumName_value.get());
-            stack.pop();
+            context->fromEnumName = stack.Pop<Node*>();
         }
     }
     void PreEnumBase(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumBase(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumBase_value = std::move(stack.top());
-            context->fromEnumBase = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromEnumBase_value.get());
-            stack.pop();
+            context->fromEnumBase = stack.Pop<Node*>();
         }
     }
 private:
@@ -268,18 +252,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<EnumTypeNode*>(context->value)));
+            stack.Push<EnumTypeNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -324,23 +305,21 @@ public:
     void PreEnumHead(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumHead(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumHead_value = std::move(stack.top());
-            context->fromEnumHead = *static_cast<gendoc::parsing::ValueObject<EnumTypeNode*>*>(fromEnumHead_value.get());
-            stack.pop();
+            context->fromEnumHead = stack.Pop<EnumTypeNode*>();
         }
     }
     void PreEnumerators(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<EnumTypeNode*>(context->enumTypeNode.get())));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<EnumTypeNode*>(context->enumTypeNode.get());
+        stack.Push<ParsingContext*>(context->ctx);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -367,18 +346,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<EnumTypeNode*>(context->value)));
+            stack.Push<EnumTypeNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -412,39 +388,33 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumKey_value = std::move(stack.top());
-            context->fromEnumKey = *static_cast<gendoc::parsing::ValueObject<EnumKey>*>(fromEnumKey_value.get());
-            stack.pop();
+            context->fromEnumKey = stack.Pop<EnumKey>();
         }
     }
     void PreEnumName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumName_value = std::move(stack.top());
-            context->fromEnumName = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromEnumName_value.get());
-            stack.pop();
+            context->fromEnumName = stack.Pop<Node*>();
         }
     }
     void PreEnumBase(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostEnumBase(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumBase_value = std::move(stack.top());
-            context->fromEnumBase = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromEnumBase_value.get());
-            stack.pop();
+            context->fromEnumBase = stack.Pop<Node*>();
         }
     }
 private:
@@ -470,15 +440,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<EnumKey>(context->value)));
+            stack.Push<EnumKey>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -525,18 +494,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -556,16 +522,14 @@ public:
     void PreQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostQualifiedIdNode(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQualifiedIdNode_value = std::move(stack.top());
-            context->fromQualifiedIdNode = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromQualifiedIdNode_value.get());
-            stack.pop();
+            context->fromQualifiedIdNode = stack.Pop<Node*>();
         }
     }
 private:
@@ -589,18 +553,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Node*>(context->value)));
+            stack.Push<Node*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -620,16 +581,14 @@ public:
     void PreTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostTypeExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeExpr_value = std::move(stack.top());
-            context->fromTypeExpr = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromTypeExpr_value.get());
-            stack.pop();
+            context->fromTypeExpr = stack.Pop<Node*>();
         }
     }
 private:
@@ -654,14 +613,9 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> enumTypeNode_value = std::move(stack.top());
-        context->enumTypeNode = *static_cast<gendoc::parsing::ValueObject<EnumTypeNode*>*>(enumTypeNode_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
+        context->enumTypeNode = stack.Pop<EnumTypeNode*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -702,31 +656,27 @@ public:
     void Preleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postleft(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<EnumeratorNode*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<EnumeratorNode*>();
         }
     }
     void Preright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<EnumeratorNode*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<EnumeratorNode*>();
         }
     }
 private:
@@ -754,18 +704,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> ctx_value = std::move(stack.top());
-        context->ctx = *static_cast<gendoc::parsing::ValueObject<ParsingContext*>*>(ctx_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->ctx = stack.Pop<ParsingContext*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<EnumeratorNode*>(context->value)));
+            stack.Push<EnumeratorNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -804,24 +751,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnumerator_value = std::move(stack.top());
-            context->fromEnumerator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromEnumerator_value.get());
-            stack.pop();
+            context->fromEnumerator = stack.Pop<std::u32string>();
         }
     }
     void PreConstantExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingContext*>(context->ctx)));
+        stack.Push<ParsingContext*>(context->ctx);
     }
     void PostConstantExpression(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConstantExpression_value = std::move(stack.top());
-            context->fromConstantExpression = *static_cast<gendoc::parsing::ValueObject<Node*>*>(fromConstantExpression_value.get());
-            stack.pop();
+            context->fromConstantExpression = stack.Pop<Node*>();
         }
     }
 private:
@@ -847,15 +790,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -876,9 +818,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -49,7 +49,7 @@ void IncludeDirective::Parse(const char32_t* start, const char32_t* end, int fil
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<SourceFileNode*>(sourceFileNode)));
+    stack.Push<SourceFileNode*>(sourceFileNode);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -79,11 +79,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> sourceFileNode_value = std::move(stack.top());
-        context->sourceFileNode = *static_cast<gendoc::parsing::ValueObject<SourceFileNode*>*>(sourceFileNode_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->sourceFileNode = stack.Pop<SourceFileNode*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -97,7 +94,7 @@ public:
     void PreSourceLine(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<SourceFileNode*>(context->sourceFileNode)));
+        stack.Push<SourceFileNode*>(context->sourceFileNode);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -117,11 +114,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> sourceFile_value = std::move(stack.top());
-        context->sourceFile = *static_cast<gendoc::parsing::ValueObject<SourceFileNode*>*>(sourceFile_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->sourceFile = stack.Pop<SourceFileNode*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -135,7 +129,7 @@ public:
     void PreIncludeDirectiveLine(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<SourceFileNode*>(context->sourceFile)));
+        stack.Push<SourceFileNode*>(context->sourceFile);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -155,11 +149,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> sourceFile_value = std::move(stack.top());
-        context->sourceFile = *static_cast<gendoc::parsing::ValueObject<SourceFileNode*>*>(sourceFile_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->sourceFile = stack.Pop<SourceFileNode*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -182,9 +173,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFilePath_value = std::move(stack.top());
-            context->fromFilePath = *static_cast<gendoc::parsing::ValueObject<std::string>*>(fromFilePath_value.get());
-            stack.pop();
+            context->fromFilePath = stack.Pop<std::string>();
         }
     }
 private:
@@ -206,15 +195,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::string>(context->value)));
+            stack.Push<std::string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -67,9 +67,7 @@ LiteralNode* Literal::Parse(const char32_t* start, const char32_t* end, int file
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    LiteralNode* result = *static_cast<gendoc::parsing::ValueObject<LiteralNode*>*>(value.get());
-    stack.pop();
+    LiteralNode* result = stack.Pop<LiteralNode*>();
     return result;
 }
 
@@ -83,15 +81,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<LiteralNode*>(context->value)));
+            stack.Push<LiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -157,9 +154,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFloatingLiteral_value = std::move(stack.top());
-            context->fromFloatingLiteral = *static_cast<gendoc::parsing::ValueObject<FloatingLiteralNode*>*>(fromFloatingLiteral_value.get());
-            stack.pop();
+            context->fromFloatingLiteral = stack.Pop<FloatingLiteralNode*>();
         }
     }
     void PostIntegerLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -167,9 +162,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIntegerLiteral_value = std::move(stack.top());
-            context->fromIntegerLiteral = *static_cast<gendoc::parsing::ValueObject<IntegerLiteralNode*>*>(fromIntegerLiteral_value.get());
-            stack.pop();
+            context->fromIntegerLiteral = stack.Pop<IntegerLiteralNode*>();
         }
     }
     void PostCharacterLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -177,9 +170,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCharacterLiteral_value = std::move(stack.top());
-            context->fromCharacterLiteral = *static_cast<gendoc::parsing::ValueObject<CharacterLiteralNode*>*>(fromCharacterLiteral_value.get());
-            stack.pop();
+            context->fromCharacterLiteral = stack.Pop<CharacterLiteralNode*>();
         }
     }
     void PostStringLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -187,9 +178,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromStringLiteral_value = std::move(stack.top());
-            context->fromStringLiteral = *static_cast<gendoc::parsing::ValueObject<StringLiteralNode*>*>(fromStringLiteral_value.get());
-            stack.pop();
+            context->fromStringLiteral = stack.Pop<StringLiteralNode*>();
         }
     }
     void PostBooleanLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -197,9 +186,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBooleanLiteral_value = std::move(stack.top());
-            context->fromBooleanLiteral = *static_cast<gendoc::parsing::ValueObject<LiteralNode*>*>(fromBooleanLiteral_value.get());
-            stack.pop();
+            context->fromBooleanLiteral = stack.Pop<LiteralNode*>();
         }
     }
     void PostPointerLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -207,9 +194,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPointerLiteral_value = std::move(stack.top());
-            context->fromPointerLiteral = *static_cast<gendoc::parsing::ValueObject<LiteralNode*>*>(fromPointerLiteral_value.get());
-            stack.pop();
+            context->fromPointerLiteral = stack.Pop<LiteralNode*>();
         }
     }
 private:
@@ -238,15 +223,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<FloatingLiteralNode*>(context->value)));
+            stack.Push<FloatingLiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -301,9 +285,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms1_value = std::move(stack.top());
-            context->froms1 = *static_cast<gendoc::parsing::ValueObject<Suffix>*>(froms1_value.get());
-            stack.pop();
+            context->froms1 = stack.Pop<Suffix>();
         }
     }
     void Posts2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -311,9 +293,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms2_value = std::move(stack.top());
-            context->froms2 = *static_cast<gendoc::parsing::ValueObject<Suffix>*>(froms2_value.get());
-            stack.pop();
+            context->froms2 = stack.Pop<Suffix>();
         }
     }
 private:
@@ -338,15 +318,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Suffix>(context->value)));
+            stack.Push<Suffix>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -388,15 +367,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<IntegerLiteralNode*>(context->value)));
+            stack.Push<IntegerLiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -472,9 +450,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromhl_value = std::move(stack.top());
-            context->fromhl = *static_cast<gendoc::parsing::ValueObject<uint64_t>*>(fromhl_value.get());
-            stack.pop();
+            context->fromhl = stack.Pop<uint64_t>();
         }
     }
     void Posts3(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -482,9 +458,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms3_value = std::move(stack.top());
-            context->froms3 = *static_cast<gendoc::parsing::ValueObject<Suffix>*>(froms3_value.get());
-            stack.pop();
+            context->froms3 = stack.Pop<Suffix>();
         }
     }
     void Postol(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -492,9 +466,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromol_value = std::move(stack.top());
-            context->fromol = *static_cast<gendoc::parsing::ValueObject<uint64_t>*>(fromol_value.get());
-            stack.pop();
+            context->fromol = stack.Pop<uint64_t>();
         }
     }
     void Posts2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -502,9 +474,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms2_value = std::move(stack.top());
-            context->froms2 = *static_cast<gendoc::parsing::ValueObject<Suffix>*>(froms2_value.get());
-            stack.pop();
+            context->froms2 = stack.Pop<Suffix>();
         }
     }
     void Postdl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -512,9 +482,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromdl_value = std::move(stack.top());
-            context->fromdl = *static_cast<gendoc::parsing::ValueObject<uint64_t>*>(fromdl_value.get());
-            stack.pop();
+            context->fromdl = stack.Pop<uint64_t>();
         }
     }
     void Posts1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -522,9 +490,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms1_value = std::move(stack.top());
-            context->froms1 = *static_cast<gendoc::parsing::ValueObject<Suffix>*>(froms1_value.get());
-            stack.pop();
+            context->froms1 = stack.Pop<Suffix>();
         }
     }
 private:
@@ -554,15 +520,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint64_t>(context->value)));
+            stack.Push<uint64_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -596,15 +561,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint64_t>(context->value)));
+            stack.Push<uint64_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -636,15 +600,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint64_t>(context->value)));
+            stack.Push<uint64_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -678,15 +641,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Suffix>(context->value)));
+            stack.Push<Suffix>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -769,15 +731,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<CharacterLiteralNode*>(context->value)));
+            stack.Push<CharacterLiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -812,9 +773,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCChar_value = std::move(stack.top());
-            context->fromCChar = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromCChar_value.get());
-            stack.pop();
+            context->fromCChar = stack.Pop<char32_t>();
         }
     }
 private:
@@ -838,15 +797,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<char32_t>(context->value)));
+            stack.Push<char32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -892,9 +850,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromescape_value = std::move(stack.top());
-            context->fromescape = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromescape_value.get());
-            stack.pop();
+            context->fromescape = stack.Pop<char32_t>();
         }
     }
     void PostHexDigit4(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -902,9 +858,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHexDigit4_value = std::move(stack.top());
-            context->fromHexDigit4 = *static_cast<gendoc::parsing::ValueObject<uint16_t>*>(fromHexDigit4_value.get());
-            stack.pop();
+            context->fromHexDigit4 = stack.Pop<uint16_t>();
         }
     }
     void PostHexDigit8(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -912,9 +866,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHexDigit8_value = std::move(stack.top());
-            context->fromHexDigit8 = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromHexDigit8_value.get());
-            stack.pop();
+            context->fromHexDigit8 = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -938,15 +890,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint16_t>(context->value)));
+            stack.Push<uint16_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -980,15 +931,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint32_t>(context->value)));
+            stack.Push<uint32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1013,9 +963,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromh1_value = std::move(stack.top());
-            context->fromh1 = *static_cast<gendoc::parsing::ValueObject<uint16_t>*>(fromh1_value.get());
-            stack.pop();
+            context->fromh1 = stack.Pop<uint16_t>();
         }
     }
     void Posth2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1023,9 +971,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromh2_value = std::move(stack.top());
-            context->fromh2 = *static_cast<gendoc::parsing::ValueObject<uint16_t>*>(fromh2_value.get());
-            stack.pop();
+            context->fromh2 = stack.Pop<uint16_t>();
         }
     }
 private:
@@ -1050,15 +996,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<StringLiteralNode*>(context->value)));
+            stack.Push<StringLiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1111,9 +1056,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frome1_value = std::move(stack.top());
-            context->frome1 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(frome1_value.get());
-            stack.pop();
+            context->frome1 = stack.Pop<std::u32string>();
         }
     }
     void PostSChar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1121,9 +1064,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSChar_value = std::move(stack.top());
-            context->fromSChar = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromSChar_value.get());
-            stack.pop();
+            context->fromSChar = stack.Pop<char32_t>();
         }
     }
     void Poste2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1131,9 +1072,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frome2_value = std::move(stack.top());
-            context->frome2 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(frome2_value.get());
-            stack.pop();
+            context->frome2 = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1159,15 +1098,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1192,15 +1130,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<char32_t>(context->value)));
+            stack.Push<char32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1246,9 +1183,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromescape_value = std::move(stack.top());
-            context->fromescape = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromescape_value.get());
-            stack.pop();
+            context->fromescape = stack.Pop<char32_t>();
         }
     }
     void PostHexDigit4(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1256,9 +1191,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHexDigit4_value = std::move(stack.top());
-            context->fromHexDigit4 = *static_cast<gendoc::parsing::ValueObject<uint16_t>*>(fromHexDigit4_value.get());
-            stack.pop();
+            context->fromHexDigit4 = stack.Pop<uint16_t>();
         }
     }
     void PostHexDigit8(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1266,9 +1199,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHexDigit8_value = std::move(stack.top());
-            context->fromHexDigit8 = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromHexDigit8_value.get());
-            stack.pop();
+            context->fromHexDigit8 = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -1292,15 +1223,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<LiteralNode*>(context->value)));
+            stack.Push<LiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1339,15 +1269,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<LiteralNode*>(context->value)));
+            stack.Push<LiteralNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
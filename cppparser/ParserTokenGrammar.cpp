@@ -52,7 +52,7 @@ void ParserToken::Parse(const char32_t* start, const char32_t* end, int fileInde
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<SourceCodeWriter*>(writer)));
+    stack.Push<SourceCodeWriter*>(writer);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -82,11 +82,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> writer_value = std::move(stack.top());
-        context->writer = *static_cast<gendoc::parsing::ValueObject<SourceCodeWriter*>*>(writer_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->writer = stack.Pop<SourceCodeWriter*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -100,7 +97,7 @@ public:
     void PreSourceToken(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<SourceCodeWriter*>(context->writer)));
+        stack.Push<SourceCodeWriter*>(context->writer);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -120,11 +117,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> writer_value = std::move(stack.top());
-        context->writer = *static_cast<gendoc::parsing::ValueObject<SourceCodeWriter*>*>(writer_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->writer = stack.Pop<SourceCodeWriter*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -222,9 +216,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromidentifier_value = std::move(stack.top());
-            context->fromidentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromidentifier_value.get());
-            stack.pop();
+            context->fromidentifier = stack.Pop<std::u32string>();
         }
     }
     void Poststring(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -232,9 +224,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromstring_value = std::move(stack.top());
-            context->fromstring = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromstring_value.get());
-            stack.pop();
+            context->fromstring = stack.Pop<std::u32string>();
         }
     }
     void Postchar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -242,9 +232,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromchar_value = std::move(stack.top());
-            context->fromchar = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromchar_value.get());
-            stack.pop();
+            context->fromchar = stack.Pop<char32_t>();
         }
     }
 private:
@@ -269,8 +257,7 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -300,9 +287,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCharSetRange_value = std::move(stack.top());
-            context->fromCharSetRange = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromCharSetRange_value.get());
-            stack.pop();
+            context->fromCharSetRange = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -325,15 +310,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -365,9 +349,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromfirst_value = std::move(stack.top());
-            context->fromfirst = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromfirst_value.get());
-            stack.pop();
+            context->fromfirst = stack.Pop<char32_t>();
         }
     }
     void Postlast(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -375,9 +357,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromlast_value = std::move(stack.top());
-            context->fromlast = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromlast_value.get());
-            stack.pop();
+            context->fromlast = stack.Pop<char32_t>();
         }
     }
 private:
@@ -400,15 +380,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<char32_t>(context->value)));
+            stack.Push<char32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -436,9 +415,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromescape_value = std::move(stack.top());
-            context->fromescape = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromescape_value.get());
-            stack.pop();
+            context->fromescape = stack.Pop<char32_t>();
         }
     }
 private:
@@ -66,9 +66,7 @@ SimpleTypeNode* SimpleType::Parse(const char32_t* start, const char32_t* end, in
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    SimpleTypeNode* result = *static_cast<gendoc::parsing::ValueObject<SimpleTypeNode*>*>(value.get());
-    stack.pop();
+    SimpleTypeNode* result = stack.Pop<SimpleTypeNode*>();
     return result;
 }
 
@@ -83,15 +81,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<SimpleTypeNode*>(context->value)));
+            stack.Push<SimpleTypeNode*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -119,9 +116,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms_value = std::move(stack.top());
-            context->froms = *static_cast<gendoc::parsing::ValueObject<SimpleTypeSpecifier>*>(froms_value.get());
-            stack.pop();
+            context->froms = stack.Pop<SimpleTypeSpecifier>();
         }
     }
 private:
@@ -144,15 +139,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<SimpleTypeSpecifier>(context->value)));
+            stack.Push<SimpleTypeSpecifier>(context->value);
         }
         parsingData->PopContext(Id());
     }
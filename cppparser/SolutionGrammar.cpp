@@ -66,9 +66,7 @@ gendoc::cppast::Solution* Solution::Parse(const char32_t* start, const char32_t*
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::cppast::Solution* result = *static_cast<gendoc::parsing::ValueObject<gendoc::cppast::Solution*>*>(value.get());
-    stack.pop();
+    gendoc::cppast::Solution* result = stack.Pop<gendoc::cppast::Solution*>();
     return result;
 }
 
@@ -82,15 +80,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::cppast::Solution*>(context->value)));
+            stack.Push<gendoc::cppast::Solution*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -115,20 +112,18 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSolutionHeader_value = std::move(stack.top());
-            context->fromSolutionHeader = *static_cast<gendoc::parsing::ValueObject<gendoc::cppast::Solution*>*>(fromSolutionHeader_value.get());
-            stack.pop();
+            context->fromSolutionHeader = stack.Pop<gendoc::cppast::Solution*>();
         }
     }
     void PreProjects(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::cppast::Solution*>(context->value)));
+        stack.Push<gendoc::cppast::Solution*>(context->value);
     }
     void PreGlobal(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::cppast::Solution*>(context->value)));
+        stack.Push<gendoc::cppast::Solution*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -149,15 +144,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::cppast::Solution*>(context->value)));
+            stack.Push<gendoc::cppast::Solution*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -182,9 +176,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFormatVersion_value = std::move(stack.top());
-            context->fromFormatVersion = *static_cast<gendoc::parsing::ValueObject<Version>*>(fromFormatVersion_value.get());
-            stack.pop();
+            context->fromFormatVersion = stack.Pop<Version>();
         }
     }
     void PostvisualStudionVersion(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -192,9 +184,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromvisualStudionVersion_value = std::move(stack.top());
-            context->fromvisualStudionVersion = *static_cast<gendoc::parsing::ValueObject<Version>*>(fromvisualStudionVersion_value.get());
-            stack.pop();
+            context->fromvisualStudionVersion = stack.Pop<Version>();
         }
     }
     void PostminVisualStudioVersion(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -202,9 +192,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromminVisualStudioVersion_value = std::move(stack.top());
-            context->fromminVisualStudioVersion = *static_cast<gendoc::parsing::ValueObject<Version>*>(fromminVisualStudioVersion_value.get());
-            stack.pop();
+            context->fromminVisualStudioVersion = stack.Pop<Version>();
         }
     }
 private:
@@ -228,11 +216,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> solution_value = std::move(stack.top());
-        context->solution = *static_cast<gendoc::parsing::ValueObject<gendoc::cppast::Solution*>*>(solution_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->solution = stack.Pop<gendoc::cppast::Solution*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -255,9 +240,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromProject_value = std::move(stack.top());
-            context->fromProject = *static_cast<gendoc::parsing::ValueObject<Project*>*>(fromProject_value.get());
-            stack.pop();
+            context->fromProject = stack.Pop<Project*>();
         }
     }
 private:
@@ -279,15 +262,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->value)));
+            stack.Push<Project*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -316,9 +298,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromlanguageGuid_value = std::move(stack.top());
-            context->fromlanguageGuid = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromlanguageGuid_value.get());
-            stack.pop();
+            context->fromlanguageGuid = stack.Pop<std::u32string>();
         }
     }
     void PostprojectName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -326,9 +306,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromprojectName_value = std::move(stack.top());
-            context->fromprojectName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromprojectName_value.get());
-            stack.pop();
+            context->fromprojectName = stack.Pop<std::u32string>();
         }
     }
     void PostprojectFilePath(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -336,9 +314,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromprojectFilePath_value = std::move(stack.top());
-            context->fromprojectFilePath = *static_cast<gendoc::parsing::ValueObject<std::string>*>(fromprojectFilePath_value.get());
-            stack.pop();
+            context->fromprojectFilePath = stack.Pop<std::string>();
         }
     }
     void PostprojectGuid(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -346,15 +322,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromprojectGuid_value = std::move(stack.top());
-            context->fromprojectGuid = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromprojectGuid_value.get());
-            stack.pop();
+            context->fromprojectGuid = stack.Pop<std::u32string>();
         }
     }
     void PreProjectContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->value)));
+        stack.Push<Project*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -378,11 +352,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> project_value = std::move(stack.top());
-        context->project = *static_cast<gendoc::parsing::ValueObject<Project*>*>(project_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->project = stack.Pop<Project*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -396,7 +367,7 @@ public:
     void PreProjectSection(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->project)));
+        stack.Push<Project*>(context->project);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -416,11 +387,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> project_value = std::move(stack.top());
-        context->project = *static_cast<gendoc::parsing::ValueObject<Project*>*>(project_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->project = stack.Pop<Project*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -434,7 +402,7 @@ public:
     void PreProjectDependencySection(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->project)));
+        stack.Push<Project*>(context->project);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -454,11 +422,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> project_value = std::move(stack.top());
-        context->project = *static_cast<gendoc::parsing::ValueObject<Project*>*>(project_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->project = stack.Pop<Project*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -472,7 +437,7 @@ public:
     void PreProjectDependencySectionContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->project)));
+        stack.Push<Project*>(context->project);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -492,11 +457,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> project_value = std::move(stack.top());
-        context->project = *static_cast<gendoc::parsing::ValueObject<Project*>*>(project_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->project = stack.Pop<Project*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -519,9 +481,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDependentProject_value = std::move(stack.top());
-            context->fromDependentProject = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDependentProject_value.get());
-            stack.pop();
+            context->fromDependentProject = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -543,15 +503,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -574,9 +533,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromprojectGuid_value = std::move(stack.top());
-            context->fromprojectGuid = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromprojectGuid_value.get());
-            stack.pop();
+            context->fromprojectGuid = stack.Pop<std::u32string>();
         }
     }
     void PostpostGuid(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -584,9 +541,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frompostGuid_value = std::move(stack.top());
-            context->frompostGuid = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(frompostGuid_value.get());
-            stack.pop();
+            context->frompostGuid = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -609,11 +564,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> solution_value = std::move(stack.top());
-        context->solution = *static_cast<gendoc::parsing::ValueObject<gendoc::cppast::Solution*>*>(solution_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->solution = stack.Pop<gendoc::cppast::Solution*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -627,7 +579,7 @@ public:
     void PreGlobalSections(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::cppast::Solution*>(context->solution)));
+        stack.Push<gendoc::cppast::Solution*>(context->solution);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -647,11 +599,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> solution_value = std::move(stack.top());
-        context->solution = *static_cast<gendoc::parsing::ValueObject<gendoc::cppast::Solution*>*>(solution_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->solution = stack.Pop<gendoc::cppast::Solution*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -678,15 +627,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Version>(context->value)));
+            stack.Push<Version>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -709,9 +657,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frommajor_value = std::move(stack.top());
-            context->frommajor = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(frommajor_value.get());
-            stack.pop();
+            context->frommajor = stack.Pop<uint32_t>();
         }
     }
     void Postminor(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -719,9 +665,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromminor_value = std::move(stack.top());
-            context->fromminor = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromminor_value.get());
-            stack.pop();
+            context->fromminor = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -744,15 +688,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Version>(context->value)));
+            stack.Push<Version>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -779,9 +722,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frommajor_value = std::move(stack.top());
-            context->frommajor = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(frommajor_value.get());
-            stack.pop();
+            context->frommajor = stack.Pop<uint32_t>();
         }
     }
     void Postminor(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -789,9 +730,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromminor_value = std::move(stack.top());
-            context->fromminor = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromminor_value.get());
-            stack.pop();
+            context->fromminor = stack.Pop<uint32_t>();
         }
     }
     void Postrevision(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -799,9 +738,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromrevision_value = std::move(stack.top());
-            context->fromrevision = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromrevision_value.get());
-            stack.pop();
+            context->fromrevision = stack.Pop<uint32_t>();
         }
     }
     void Postbuild(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -809,9 +746,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frombuild_value = std::move(stack.top());
-            context->frombuild = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(frombuild_value.get());
-            stack.pop();
+            context->frombuild = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -836,15 +771,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint32_t>(context->value)));
+            stack.Push<uint32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -865,9 +799,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromuint_value = std::move(stack.top());
-            context->fromuint = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromuint_value.get());
-            stack.pop();
+            context->fromuint = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -889,15 +821,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint32_t>(context->value)));
+            stack.Push<uint32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -918,9 +849,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromuint_value = std::move(stack.top());
-            context->fromuint = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromuint_value.get());
-            stack.pop();
+            context->fromuint = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -942,15 +871,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint32_t>(context->value)));
+            stack.Push<uint32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -971,9 +899,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromuint_value = std::move(stack.top());
-            context->fromuint = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromuint_value.get());
-            stack.pop();
+            context->fromuint = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -995,15 +921,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint32_t>(context->value)));
+            stack.Push<uint32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1024,9 +949,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromuint_value = std::move(stack.top());
-            context->fromuint = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromuint_value.get());
-            stack.pop();
+            context->fromuint = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -1048,15 +971,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1077,9 +999,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGuid_value = std::move(stack.top());
-            context->fromGuid = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromGuid_value.get());
-            stack.pop();
+            context->fromGuid = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1101,15 +1021,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1130,9 +1049,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHexGuid_value = std::move(stack.top());
-            context->fromHexGuid = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromHexGuid_value.get());
-            stack.pop();
+            context->fromHexGuid = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1154,15 +1071,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1194,15 +1110,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::string>(context->value)));
+            stack.Push<std::string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -66,9 +66,7 @@ int SourceLines::Parse(const char32_t* start, const char32_t* end, int fileIndex
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    int result = *static_cast<gendoc::parsing::ValueObject<int>*>(value.get());
-    stack.pop();
+    int result = stack.Pop<int>();
     return result;
 }
 
@@ -82,15 +80,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<int>(context->value)));
+            stack.Push<int>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -111,9 +108,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSourceLine_value = std::move(stack.top());
-            context->fromSourceLine = *static_cast<gendoc::parsing::ValueObject<int>*>(fromSourceLine_value.get());
-            stack.pop();
+            context->fromSourceLine = stack.Pop<int>();
         }
     }
 private:
@@ -135,15 +130,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<int>(context->value)));
+            stack.Push<int>(context->value);
         }
         parsingData->PopContext(Id());
     }
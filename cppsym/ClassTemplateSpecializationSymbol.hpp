@@ -23,8 +23,10 @@ public:
     ClassKey GetClassKey() const override { return primaryClassTemplateSymbol->GetClassKey(); }
     TypeSymbol* PrimaryClassTemplateSymbol() { return primaryClassTemplateSymbol; }
     TemplateIdNode* GetTemplateIdNode() { return templateIdNode; }
+    void SetTemplateIdNode(TemplateIdNode* templateIdNode_) { templateIdNode = templateIdNode_; }
     const std::vector<TypeSymbol*>& TemplateArgumentSymbols() const { return templateArgumentSymbols; }
     const std::vector<Node*>& TemplateArgumentNodes() const { return templateArgumentNodes; }
+    void SetTemplateArgumentNodes(const std::vector<Node*>& templateArgumentNodes_) { templateArgumentNodes = templateArgumentNodes_; }
     std::unique_ptr<dom::Element> CreateElement() override;
     std::u32string Id() override { return id; }
 private:
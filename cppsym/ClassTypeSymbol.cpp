@@ -171,6 +171,25 @@ void ClassGroupSymbol::AddClass(std::unique_ptr<ClassTypeSymbol>&& cls)
     classes.push_back(std::move(cls));
 }
 
+void ClassGroupSymbol::InternIds()
+{
+    Symbol::InternIds();
+    for (const std::unique_ptr<ClassTypeSymbol>& cls : classes)
+    {
+        cls->InternIds();
+    }
+}
+
+void ClassGroupSymbol::InvalidateIds()
+{
+    if (!IdsInterned()) return;
+    Symbol::InvalidateIds();
+    for (const std::unique_ptr<ClassTypeSymbol>& cls : classes)
+    {
+        cls->InvalidateIds();
+    }
+}
+
 ClassTypeSymbol* ClassGroupSymbol::GetClass(int arity) const
 {
     auto it = arityClassMap.find(arity);
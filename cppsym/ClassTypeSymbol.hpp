@@ -75,6 +75,8 @@ public:
     void AddClass(std::unique_ptr<ClassTypeSymbol>&& cls);
     ClassTypeSymbol* GetClass(int arity) const;
     std::u32string KindStr() override { return U"class_group"; }
+    void InternIds() override;
+    void InvalidateIds() override;
     std::unique_ptr<dom::Element> CreateElement() override;
     const std::vector<std::unique_ptr<ClassTypeSymbol>>& Classes() const { return classes; }
 private:
@@ -94,6 +94,25 @@ ClassGroupSymbol* ContainerSymbol::MakeClassGroupSymbol(const Span& span_, const
     }
 }
 
+void ContainerSymbol::InternIds()
+{
+    Symbol::InternIds();
+    for (const std::unique_ptr<Symbol>& member : members)
+    {
+        member->InternIds();
+    }
+}
+
+void ContainerSymbol::InvalidateIds()
+{
+    if (!IdsInterned()) return;
+    Symbol::InvalidateIds();
+    for (const std::unique_ptr<Symbol>& member : members)
+    {
+        member->InvalidateIds();
+    }
+}
+
 std::unique_ptr<dom::Element> ContainerSymbol::Namespaces()
 {
     std::unique_ptr<dom::Element> namespacesElement;
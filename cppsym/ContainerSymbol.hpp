@@ -30,6 +30,8 @@ public:
     bool IsContainerSymbol() const override { return true; }
     virtual int NumBases() const { return 0; }
     virtual ContainerSymbol* GetBase(int i) const { return nullptr; }
+    void InternIds() override;
+    void InvalidateIds() override;
     std::unique_ptr<dom::Element> Namespaces() override;
     std::unique_ptr<dom::Element> Classes() override;
     std::unique_ptr<dom::Element> Constructors() override;
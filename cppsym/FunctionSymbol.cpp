@@ -34,6 +34,12 @@ void FunctionDeclarationSymbol::AddMember(std::unique_ptr<Symbol>&& member)
     ContainerSymbol::AddMember(std::move(member));
 }
 
+void FunctionDeclarationSymbol::InternIds()
+{
+    // parameters of a function declaration have no ids
+    Symbol::InternIds();
+}
+
 void FunctionDeclarationSymbol::AddSpecifiers(Specifier specifiers_)
 {
     specifiers = specifiers | specifiers_;
@@ -93,6 +99,23 @@ std::u32string FunctionSymbol::IdStr()
     return idStr;
 }
 
+struct FunctionById
+{
+    bool operator()(FunctionSymbol* left, FunctionSymbol* right) const
+    {
+        return left->Id() < right->Id();
+    }
+};
+
+// Sets of function symbols are iterated in pointer order that varies from run to run, so they are written in id order.
+
+std::vector<FunctionSymbol*> SortById(const std::unordered_set<FunctionSymbol*>& functions)
+{
+    std::vector<FunctionSymbol*> sorted(functions.begin(), functions.end());
+    std::sort(sorted.begin(), sorted.end(), FunctionById());
+    return sorted;
+}
+
 std::unique_ptr<dom::Element> FunctionSymbol::CreateElement()
 {
     std::unique_ptr<dom::Element> functionElement(new dom::Element(U"function"));
@@ -139,7 +162,7 @@ std::unique_ptr<dom::Element> FunctionSymbol::CreateElement()
     if (!overrides.empty())
     {
         std::unique_ptr<dom::Element> overridesElement(new dom::Element(U"overrides"));
-        for (FunctionSymbol* override_ : overrides)
+        for (FunctionSymbol* override_ : SortById(overrides))
         {
             std::unique_ptr<dom::Element> overrideElement(new dom::Element(U"override"));
             overrideElement->SetAttribute(U"functionId", override_->Id());
@@ -150,7 +173,7 @@ std::unique_ptr<dom::Element> FunctionSymbol::CreateElement()
     if (!overridden.empty())
     {
         std::unique_ptr<dom::Element> overriddenFunctionsElement(new dom::Element(U"overriddenFunctions"));
-        for (FunctionSymbol* overridden_ : overridden)
+        for (FunctionSymbol* overridden_ : SortById(overridden))
         {
             std::unique_ptr<dom::Element> overriddenFunctionElement(new dom::Element(U"overriddenFunction"));
             overriddenFunctionElement->SetAttribute(U"functionId", overridden_->Id());
@@ -161,7 +184,7 @@ std::unique_ptr<dom::Element> FunctionSymbol::CreateElement()
     if (!calls.empty())
     {
         std::unique_ptr<dom::Element> callsElement(new dom::Element(U"calls"));
-        for (FunctionSymbol* function : calls)
+        for (FunctionSymbol* function : SortById(calls))
         {
             std::unique_ptr<dom::Element> callElement(new dom::Element(U"call"));
             callElement->SetAttribute(U"functionId", function->Id());
@@ -172,7 +195,7 @@ std::unique_ptr<dom::Element> FunctionSymbol::CreateElement()
     if (!calledBy.empty())
     {
         std::unique_ptr<dom::Element> calledByFunctionsElement(new dom::Element(U"calledByFunctions"));
-        for (FunctionSymbol* function : calledBy)
+        for (FunctionSymbol* function : SortById(calledBy))
         {
             std::unique_ptr<dom::Element> calledByFunctionElement(new dom::Element(U"calledByFunction"));
             calledByFunctionElement->SetAttribute(U"functionId", function->Id());
@@ -288,6 +311,33 @@ void FunctionGroupSymbol::AddFunctionDeclaration(std::unique_ptr<FunctionDeclara
     functionDeclarations.push_back(std::move(functionDeclaration));
 }
 
+void FunctionGroupSymbol::InternIds()
+{
+    Symbol::InternIds();
+    for (const std::unique_ptr<FunctionSymbol>& function : functions)
+    {
+        function->InternIds();
+    }
+    for (const std::unique_ptr<FunctionDeclarationSymbol>& functionDeclaration : functionDeclarations)
+    {
+        functionDeclaration->InternIds();
+    }
+}
+
+void FunctionGroupSymbol::InvalidateIds()
+{
+    if (!IdsInterned()) return;
+    Symbol::InvalidateIds();
+    for (const std::unique_ptr<FunctionSymbol>& function : functions)
+    {
+        function->InvalidateIds();
+    }
+    for (const std::unique_ptr<FunctionDeclarationSymbol>& functionDeclaration : functionDeclarations)
+    {
+        functionDeclaration->InvalidateIds();
+    }
+}
+
 FunctionDeclarationSymbol* FunctionGroupSymbol::GetFunctionDeclaration(const std::vector<ParameterSymbol*>& parameters, Specifier specifiers)
 {
     FunctionDeclarationSymbol* functionDeclarationSymbol = nullptr;
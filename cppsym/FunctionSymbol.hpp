@@ -24,6 +24,7 @@ public:
     Specifier Specifiers() const { return specifiers; }
     bool IsInstallSymbol() const override { return false; }
     std::u32string KindStr() override { return U"function_declaration"; }
+    void InternIds() override;
     const std::vector<ParameterSymbol*>& Parameters() const { return parameters; }
     TypeSymbol* ReturnType() { return returnType; }
     void SetReturnType(TypeSymbol* returnType_) { returnType = returnType_; }
@@ -141,6 +142,8 @@ public:
     FunctionDeclarationSymbol* GetFunctionDeclaration(const std::vector<ParameterSymbol*>& parameters, Specifier specifiers);
     FunctionSymbol* ResolveOverload(const std::vector<Symbol*>& argumentSymbols);
     std::u32string KindStr() override { return U"function_group"; }
+    void InternIds() override;
+    void InvalidateIds() override;
     std::unique_ptr<dom::Element> CreateElement() override;
     const std::vector<std::unique_ptr<FunctionSymbol>>& Functions() const { return functions; }
     const std::vector<std::unique_ptr<FunctionDeclarationSymbol>>& FunctionDeclarations() const { return functionDeclarations; }
@@ -16,14 +16,14 @@ class NameResolver : public Visitor
 public:
     void Visit(IdentifierNode& identifierNode) override;
     void Visit(NestedIdNode& nestedIdNode) override;
-    const std::vector<std::u32string>& NameSequence() const { return nameSequence; }
+    const std::vector<Atom>& NameSequence() const { return nameSequence; }
 private:
-    std::vector<std::u32string> nameSequence;
+    std::vector<Atom> nameSequence;
 };
 
 void NameResolver::Visit(IdentifierNode& identifierNode)
 {
-    nameSequence.push_back(identifierNode.Identifier());
+    nameSequence.push_back(identifierNode.IdentifierAtom());
 }
 
 void NameResolver::Visit(NestedIdNode& nestedIdNode)
@@ -34,7 +34,7 @@ void NameResolver::Visit(NestedIdNode& nestedIdNode)
     }
     else
     {
-        nameSequence.push_back(std::u32string());
+        nameSequence.push_back(gendoc::util::emptyAtom);
     }
     nestedIdNode.Right()->Accept(*this);
 }
@@ -43,6 +43,26 @@ Scope::~Scope()
 {
 }
 
+Symbol* Scope::Lookup(Atom name)
+{
+    return Lookup(name, ScopeLookup::this_);
+}
+
+Symbol* Scope::Lookup(const std::u32string& name)
+{
+    return Lookup(name, ScopeLookup::this_);
+}
+
+Symbol* Scope::Lookup(const std::u32string& name, ScopeLookup scopeLookup)
+{
+    Atom nameAtom = gendoc::util::GetAtom(name);
+    if (nameAtom == gendoc::util::noAtom)
+    {
+        return nullptr;
+    }
+    return Lookup(nameAtom, scopeLookup);
+}
+
 Symbol* Scope::Lookup(Node* nameNode)
 {
     return Lookup(nameNode, ScopeLookup::this_);
@@ -82,15 +102,10 @@ ContainerSymbol* ContainerScope::GlobalNs()
 
 void ContainerScope::Install(Symbol* symbol)
 {
-    symbolMap[symbol->Name()] = symbol;
+    symbolMap[symbol->NameAtom()] = symbol;
 }
 
-Symbol* ContainerScope::Lookup(const std::u32string& name)
-{
-    return Lookup(name, ScopeLookup::this_);
-}
-
-Symbol* ContainerScope::Lookup(const std::u32string& name, ScopeLookup scopeLookup)
+Symbol* ContainerScope::Lookup(Atom name, ScopeLookup scopeLookup)
 {
     auto it = symbolMap.find(name);
     if (it != symbolMap.cend())
@@ -127,7 +142,7 @@ Symbol* ContainerScope::Lookup(const std::u32string& name, ScopeLookup scopeLook
     return nullptr;
 }
 
-Symbol* ContainerScope::Lookup(const std::vector<std::u32string>& nameSequence, ScopeLookup scopeLoookup) 
+Symbol* ContainerScope::Lookup(const std::vector<Atom>& nameSequence, ScopeLookup scopeLoookup) 
 {
     ContainerScope* scope = this;
     Symbol* s = nullptr;
@@ -135,8 +150,8 @@ Symbol* ContainerScope::Lookup(const std::vector<std::u32string>& nameSequence,
     bool allComponentsMatched = true;
     for (int i = 0; i < n; ++i)
     {
-        const std::u32string& name = nameSequence[i];
-        if (name.empty())
+        Atom name = nameSequence[i];
+        if (name == gendoc::util::emptyAtom)
         {
             scope = GlobalNs()->GetContainerScope();
         }
@@ -204,16 +219,11 @@ void FileScope::Install(ContainerScope* containerScope, UsingDeclarationNode& us
     Symbol* symbol = static_cast<Scope*>(containerScope)->Lookup(usingDeclarationNode.QualifiedId(), ScopeLookup::this_and_parent);
     if (symbol)
     {
-        aliasSymbolMap[symbol->Name()] = symbol;
+        aliasSymbolMap[symbol->NameAtom()] = symbol;
     }
 }
 
-Symbol* FileScope::Lookup(const std::u32string& name)
-{
-    return Lookup(name, ScopeLookup::this_);
-}
-
-Symbol* FileScope::Lookup(const std::u32string& name, ScopeLookup scopeLookup)
+Symbol* FileScope::Lookup(Atom name, ScopeLookup scopeLookup)
 {
     if (scopeLookup != ScopeLookup::this_)
     {
@@ -251,7 +261,7 @@ Symbol* FileScope::Lookup(const std::u32string& name, ScopeLookup scopeLookup)
     }
 }
 
-Symbol* FileScope::Lookup(const std::vector<std::u32string>& nameSequence, ScopeLookup scopeLoookup)
+Symbol* FileScope::Lookup(const std::vector<Atom>& nameSequence, ScopeLookup scopeLoookup)
 {
     std::unordered_set<Symbol*> foundSymbols;
     for (ContainerScope* containerScope : containerScopes)
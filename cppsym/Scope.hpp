@@ -6,12 +6,14 @@
 #ifndef GENDOC_CPPSYM_SCOPE_INCLUDED
 #define GENDOC_CPPSYM_SCOPE_INCLUDED
 #include <gendoc/cppast/Declaration.hpp>
+#include <gendoc/util/Atom.hpp>
 #include <unordered_map>
 #include <stdint.h>
 
 namespace gendoc { namespace cppsym {
 
 using namespace gendoc::cppast;
+using gendoc::util::Atom;
 
 enum class ScopeLookup : uint8_t
 {
@@ -37,13 +39,17 @@ inline ScopeLookup operator|(ScopeLookup left, ScopeLookup right)
 class Symbol;
 class ContainerSymbol;
 
+// Scopes map names to symbols by atom; a name that has never been interned cannot name any symbol.
+
 class Scope
 {
 public:
     virtual ~Scope();
-    virtual Symbol* Lookup(const std::u32string& name) = 0;
-    virtual Symbol* Lookup(const std::u32string& name, ScopeLookup scopeLookup) = 0;
-    virtual Symbol* Lookup(const std::vector<std::u32string>& nameSequence, ScopeLookup scopeLoookup) = 0;
+    virtual Symbol* Lookup(Atom name, ScopeLookup scopeLookup) = 0;
+    virtual Symbol* Lookup(const std::vector<Atom>& nameSequence, ScopeLookup scopeLoookup) = 0;
+    Symbol* Lookup(Atom name);
+    Symbol* Lookup(const std::u32string& name);
+    Symbol* Lookup(const std::u32string& name, ScopeLookup scopeLookup);
     Symbol* Lookup(Node* nameNode);
     Symbol* Lookup(Node* nameNode, ScopeLookup scopeLookup);
 };
@@ -55,12 +61,12 @@ public:
     ContainerSymbol* Container() { return container; }
     ContainerSymbol* GlobalNs();
     void Install(Symbol* symbol);
-    Symbol* Lookup(const std::u32string& name) override;
-    Symbol* Lookup(const std::u32string& name, ScopeLookup scopeLookup) override;
-    Symbol* Lookup(const std::vector<std::u32string>& nameSequence, ScopeLookup scopeLoookup) override;
+    using Scope::Lookup;
+    Symbol* Lookup(Atom name, ScopeLookup scopeLookup) override;
+    Symbol* Lookup(const std::vector<Atom>& nameSequence, ScopeLookup scopeLoookup) override;
 private:
     ContainerSymbol* container;
-    std::unordered_map<std::u32string, Symbol*> symbolMap;
+    std::unordered_map<Atom, Symbol*> symbolMap;
 };
 
 class FileScope : public Scope
@@ -68,12 +74,12 @@ class FileScope : public Scope
 public:
     void Install(ContainerScope* containerScope, UsingDirectiveNode& usingDirectiveNode);
     void Install(ContainerScope* containerScope, UsingDeclarationNode& usingDeclarationNode);
-    Symbol* Lookup(const std::u32string& name) override;
-    Symbol* Lookup(const std::u32string& name, ScopeLookup scopeLookup) override;
-    Symbol* Lookup(const std::vector<std::u32string>& nameSequence, ScopeLookup scopeLoookup) override;
+    using Scope::Lookup;
+    Symbol* Lookup(Atom name, ScopeLookup scopeLookup) override;
+    Symbol* Lookup(const std::vector<Atom>& nameSequence, ScopeLookup scopeLoookup) override;
 private:
     std::vector<ContainerScope*> containerScopes;
-    std::unordered_map<std::u32string, Symbol*> aliasSymbolMap;
+    std::unordered_map<Atom, Symbol*> aliasSymbolMap;
 };
 
 } } // namespace gendoc::cppsym
@@ -7,6 +7,7 @@
 #include <gendoc/cppsym/ContainerSymbol.hpp>
 #include <gendoc/cppsym/ClassTypeSymbol.hpp>
 #include <gendoc/util/Sha1.hpp>
+#include <gendoc/util/Hash128.hpp>
 #include <gendoc/util/Unicode.hpp>
 
 namespace gendoc { namespace cppsym {
@@ -25,7 +26,24 @@ std::u32string ToString(SymbolAccess access)
     return std::u32string();
 }
 
-Symbol::Symbol(const Span& span_, const std::u32string& name_) : span(span_), name(name_), parent(nullptr), access(SymbolAccess::private_)
+SymbolIdDigest symbolIdDigest = SymbolIdDigest::sha1;
+
+void SetSymbolIdDigest(SymbolIdDigest idDigest)
+{
+    symbolIdDigest = idDigest;
+}
+
+std::u32string MakeSymbolIdDigest(const std::u32string& idMaterial)
+{
+    if (symbolIdDigest == SymbolIdDigest::hash128)
+    {
+        return ToUtf32(GetHash128Digest(idMaterial));
+    }
+    return ToUtf32(GetSha1MessageDigest(ToUtf8(idMaterial)));
+}
+
+Symbol::Symbol(const Span& span_, const std::u32string& name_) : span(span_), name(name_), nameAtom(MakeAtom(name_)), parent(nullptr), access(SymbolAccess::private_), 
+    idsInterned(false)
 {
 }
 
@@ -35,6 +53,10 @@ Symbol::~Symbol()
 
 std::u32string Symbol::FullName() 
 {
+    if (idsInterned)
+    {
+        return internedFullName;
+    }
     std::u32string fullName;
     if (Parent())
     {
@@ -74,11 +96,30 @@ std::u32string Symbol::IdStr()
 
 std::u32string Symbol::Id()
 {
+    if (idsInterned)
+    {
+        return internedId;
+    }
     std::u32string id = KindStr();
-    id.append(1, '_').append(SimpleName()).append(1, '_').append(ToUtf32(GetSha1MessageDigest(ToUtf8(IdStr()))));
+    id.append(1, '_').append(SimpleName()).append(1, '_').append(MakeSymbolIdDigest(IdStr()));
     return id;
 }
 
+void Symbol::InternIds()
+{
+    idsInterned = false;
+    internedFullName = FullName();
+    internedId = Id();
+    idsInterned = true;
+}
+
+void Symbol::InvalidateIds()
+{
+    idsInterned = false;
+    internedFullName.clear();
+    internedId.clear();
+}
+
 std::unique_ptr<dom::Element> Symbol::ToDomElement()
 {
     std::unique_ptr<dom::Element> element = CreateElement();
@@ -8,11 +8,13 @@
 #include <gendoc/cppast/Specifier.hpp>
 #include <gendoc/parsing/Scanner.hpp>
 #include <gendoc/dom/Element.hpp>
+#include <gendoc/util/Atom.hpp>
 #include <string>
 
 namespace gendoc { namespace cppsym {
 
 using gendoc::parsing::Span;
+using gendoc::util::Atom;
 
 using namespace gendoc::cppast;
 
@@ -28,14 +30,27 @@ enum class SymbolAccess : uint8_t
 
 std::u32string ToString(SymbolAccess access);
 
+// Symbol and type ids end with a digest of the identifying string of the symbol. The default is the SHA-1 digest of the UTF-8 encoded
+// string; the hash128 digest is a faster non-cryptographic hash of the UTF-32 string producing different ids.
+
+enum class SymbolIdDigest : uint8_t
+{
+    sha1, hash128
+};
+
+void SetSymbolIdDigest(SymbolIdDigest idDigest);
+std::u32string MakeSymbolIdDigest(const std::u32string& idMaterial);
+
 class Symbol
 {
 public:
     Symbol(const Span& span_, const std::u32string& name_);
     virtual ~Symbol();
     const Span& GetSpan() const { return span; }
+    void SetSpan(const Span& span_) { span = span_; }
     const std::u32string& Name() const { return name; }
-    void SetName(const std::u32string& name_) { name = name_; }
+    Atom NameAtom() const { return nameAtom; }
+    void SetName(const std::u32string& name_) { name = name_; nameAtom = gendoc::util::MakeAtom(name); InvalidateIds(); }
     virtual bool NameBefore(Symbol* that) { return name < that->Name(); }
     virtual const std::u32string& SimpleName() const { return name; }
     virtual TypeSymbol* GetType() { return nullptr; }
@@ -47,6 +62,9 @@ public:
     virtual std::u32string KindStr() = 0;
     virtual std::u32string IdStr();
     virtual std::u32string Id();
+    virtual void InternIds();
+    virtual void InvalidateIds();
+    bool IdsInterned() const { return idsInterned; }
     virtual std::unique_ptr<dom::Element> CreateElement() = 0;
     std::unique_ptr<dom::Element> ToDomElement();
     virtual std::unique_ptr<dom::Element> Namespaces();
@@ -59,7 +77,7 @@ public:
     virtual std::unique_ptr<dom::Element> Variables();
     virtual std::unique_ptr<dom::Element> Grammars();
     ContainerSymbol* Parent() { return parent; }
-    void SetParent(ContainerSymbol* parent_) { parent = parent_; }
+    void SetParent(ContainerSymbol* parent_) { parent = parent_; InvalidateIds(); }
     ClassTypeSymbol* Class();
     virtual bool IsInstallSymbol() const { return true; }
     virtual bool IsNamespaceSymbol() const { return false; }
@@ -85,8 +103,12 @@ public:
 private:
     Span span;
     std::u32string name;
+    Atom nameAtom;
     ContainerSymbol* parent;
     SymbolAccess access;
+    bool idsInterned;
+    std::u32string internedFullName;
+    std::u32string internedId;
 };
 
 } } // namespace gendoc::cppsym
@@ -13,7 +13,6 @@
 #include <gendoc/cppsym/GrammarSymbol.hpp>
 #include <gendoc/cppast/Class.hpp>
 #include <gendoc/util/Unicode.hpp>
-#include <gendoc/util/Sha1.hpp>
 #include <algorithm>
 
 namespace gendoc { namespace cppsym {
@@ -21,6 +20,54 @@ namespace gendoc { namespace cppsym {
 using namespace gendoc::unicode;
 using namespace gendoc::util;
 
+BindingBuffer::BindingBuffer(int order_) : order(order_)
+{
+}
+
+void BindingBuffer::MapNode(Node* node, Symbol* symbol)
+{
+    nodeSymbols.push_back(std::make_pair(node, symbol));
+}
+
+void BindingBuffer::MapIdNodeSequence(Node* node, const std::vector<IdentifierNode*>& idNodeSequence)
+{
+    idNodeSequences.push_back(std::make_pair(node, idNodeSequence));
+}
+
+void BindingBuffer::AddCall(FunctionSymbol* caller, FunctionSymbol* callee)
+{
+    calls.push_back(std::make_pair(caller, callee));
+}
+
+void BindingBuffer::AddType(TypeSymbol* type)
+{
+    types.push_back(type);
+}
+
+thread_local BindingBuffer* currentBindingBuffer = nullptr;
+
+BindingBufferScope::BindingBufferScope(BindingBuffer* buffer) : prevBuffer(currentBindingBuffer)
+{
+    currentBindingBuffer = buffer;
+}
+
+BindingBufferScope::~BindingBufferScope()
+{
+    currentBindingBuffer = prevBuffer;
+}
+
+// Types are created in a different order when function bodies are bound in parallel, so types having the same name are ordered by id.
+
+struct ByNameAndId
+{
+    bool operator()(TypeSymbol* left, TypeSymbol* right) const
+    {
+        if (left->NameBefore(right)) return true;
+        if (right->NameBefore(left)) return false;
+        return left->Id() < right->Id();
+    }
+};
+
 SymbolTable::SymbolTable() : globalNs(Span(), U""), container(&globalNs), blockNumber(0)
 {
     globalNs.SetAccess(Specifier::public_);
@@ -33,6 +80,11 @@ std::unique_ptr<dom::Document> SymbolTable::ToDomDocument()
     return symbolTableDoc;
 }
 
+void SymbolTable::InternIds()
+{
+    globalNs.InternIds();
+}
+
 std::unique_ptr<dom::Element> SymbolTable::ToDomElement()
 {
     std::unique_ptr<dom::Element> symbolTableElement(new dom::Element(U"symbolTable"));
@@ -57,7 +109,7 @@ std::unique_ptr<dom::Element> SymbolTable::CreateTypesElement()
         {
             typeSymbols.push_back(type.get());
         }
-        std::sort(typeSymbols.begin(), typeSymbols.end(), ByName());
+        std::sort(typeSymbols.begin(), typeSymbols.end(), ByNameAndId());
         for (TypeSymbol* typeSymbol : typeSymbols)
         {
             std::unique_ptr<dom::Element> typeElement = typeSymbol->ToDomElement();
@@ -362,14 +414,85 @@ void SymbolTable::AddVariable(Node* node, const std::u32string& variableName, co
 
 void SymbolTable::MapNode(Node* node, Symbol* symbol)
 {
+    if (currentBindingBuffer)
+    {
+        currentBindingBuffer->MapNode(node, symbol);
+        return;
+    }
     nodeSymbolMap[node] = symbol;
 }
 
 void SymbolTable::MapIdNodeSequence(Node* node, const std::vector<IdentifierNode*>& idNodeSequence)
 {
+    if (currentBindingBuffer)
+    {
+        currentBindingBuffer->MapIdNodeSequence(node, idNodeSequence);
+        return;
+    }
     idNodeSequenceMap[node] = idNodeSequence;
 }
 
+void SymbolTable::AddCall(FunctionSymbol* caller, FunctionSymbol* callee)
+{
+    if (currentBindingBuffer)
+    {
+        currentBindingBuffer->AddCall(caller, callee);
+        return;
+    }
+    caller->AddToCalls(callee);
+    callee->AddToCalledBy(caller);
+}
+
+void SymbolTable::ApplyBindingBuffer(BindingBuffer& buffer)
+{
+    for (std::pair<Node*, Symbol*>& nodeSymbol : buffer.NodeSymbols())
+    {
+        nodeSymbolMap[nodeSymbol.first] = nodeSymbol.second;
+    }
+    for (std::pair<Node*, std::vector<IdentifierNode*>>& idNodeSequence : buffer.IdNodeSequences())
+    {
+        idNodeSequenceMap[idNodeSequence.first] = std::move(idNodeSequence.second);
+    }
+    for (const std::pair<FunctionSymbol*, FunctionSymbol*>& call : buffer.Calls())
+    {
+        call.first->AddToCalls(call.second);
+        call.second->AddToCalledBy(call.first);
+    }
+    for (TypeSymbol* type : buffer.Types())
+    {
+        typeOrderMap.erase(type);
+    }
+}
+
+// While function bodies are bound in parallel, records the order of the source file that made the type.
+
+void SymbolTable::RecordTypeOrder(TypeSymbol* type)
+{
+    if (currentBindingBuffer)
+    {
+        typeOrderMap[type] = currentBindingBuffer->Order();
+        currentBindingBuffer->AddType(type);
+    }
+}
+
+// Returns true if the source file being bound comes before the source file that made the type, that is, if binding sequentially would have made
+// the type here. The type then takes its span and nodes from here, so that it does not depend on which thread made it first.
+
+bool SymbolTable::PrecedesTypeOrder(TypeSymbol* type)
+{
+    if (currentBindingBuffer)
+    {
+        auto it = typeOrderMap.find(type);
+        if (it != typeOrderMap.cend() && currentBindingBuffer->Order() < it->second)
+        {
+            it->second = currentBindingBuffer->Order();
+            currentBindingBuffer->AddType(type);
+            return true;
+        }
+    }
+    return false;
+}
+
 Symbol* SymbolTable::GetSymbolNothrow(Node* node)
 {
     auto it = nodeSymbolMap.find(node);
@@ -416,17 +539,24 @@ ContainerScope* SymbolTable::GetContainerScope()
 
 TypeSymbol* SymbolTable::MakeSimpleTypeSymbol(SimpleTypeNode& simpleTypeNode)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     std::u32string id = simpleTypeNode.Id();
     auto it = idTypeMap.find(id);
     if (it != idTypeMap.cend())
     {
-        return it->second;
+        TypeSymbol* type = it->second;
+        if (PrecedesTypeOrder(type))
+        {
+            type->SetSpan(simpleTypeNode.GetSpan());
+        }
+        return type;
     }
     else
     {
         SimpleTypeSymbol* simpleTypeSymbol = new SimpleTypeSymbol(simpleTypeNode.GetSpan(), simpleTypeNode.Str(), id);
         simpleTypeSymbol->SetAccess(Specifier::public_);
         idTypeMap[id] = simpleTypeSymbol;
+        RecordTypeOrder(simpleTypeSymbol);
         types.push_back(std::unique_ptr<TypeSymbol>(simpleTypeSymbol));
         return simpleTypeSymbol;
     }
@@ -434,8 +564,9 @@ TypeSymbol* SymbolTable::MakeSimpleTypeSymbol(SimpleTypeNode& simpleTypeNode)
 
 TypeSymbol* SymbolTable::MakeElaborateClassTypeSymbol(ClassKey classKey, TypeSymbol* classType)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     std::u32string idMaterial = ToString(classKey) + classType->IdStr();
-    std::u32string id = U"type_" + ToUtf32(GetSha1MessageDigest(ToUtf8(idMaterial)));
+    std::u32string id = U"type_" + MakeSymbolIdDigest(idMaterial);
     auto it = idTypeMap.find(id);
     if (it != idTypeMap.cend())
     {
@@ -452,6 +583,7 @@ TypeSymbol* SymbolTable::MakeElaborateClassTypeSymbol(ClassKey classKey, TypeSym
 
 TypeSymbol* SymbolTable::MakeDerivedTypeSymbol(std::vector<Derivation>& derivations, TypeSymbol* baseType)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     if (baseType->IsDerivedTypeSymbol())
     {
         DerivedTypeSymbol* derivedType = static_cast<DerivedTypeSymbol*>(baseType);
@@ -480,23 +612,30 @@ TypeSymbol* SymbolTable::MakeDerivedTypeSymbol(std::vector<Derivation>& derivati
 
 TypeSymbol* SymbolTable::MakeExternalTypeSymbol(const Span& span, const std::u32string& name, ClassKey classKey)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     std::u32string id = U"type_";
     if (classKey != ClassKey::none)
     {
         id.append(ToString(classKey));
         id.append(1, '_');
     }
-    id.append(ToUtf32(GetSha1MessageDigest(ToUtf8(name))));
+    id.append(MakeSymbolIdDigest(name));
     auto it = idTypeMap.find(id);
     if (it != idTypeMap.cend())
     {
-        return it->second;
+        TypeSymbol* type = it->second;
+        if (PrecedesTypeOrder(type))
+        {
+            type->SetSpan(span);
+        }
+        return type;
     }
     else
     {
         ExternalTypeSymbol* externalTypeSymbol = new ExternalTypeSymbol(span, name, classKey, id);
         externalTypeSymbol->SetAccess(Specifier::public_);
         idTypeMap[id] = externalTypeSymbol;
+        RecordTypeOrder(externalTypeSymbol);
         types.push_back(std::unique_ptr<TypeSymbol>(externalTypeSymbol));
         return externalTypeSymbol;
     }
@@ -504,6 +643,7 @@ TypeSymbol* SymbolTable::MakeExternalTypeSymbol(const Span& span, const std::u32
 
 TypeSymbol* SymbolTable::MakeClassGroupTypeSymbol(ClassGroupSymbol* classGroup)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     std::u32string id = classGroup->Id();
     auto it = idTypeMap.find(id);
     if (it != idTypeMap.cend())
@@ -522,11 +662,20 @@ TypeSymbol* SymbolTable::MakeClassGroupTypeSymbol(ClassGroupSymbol* classGroup)
 TypeSymbol* SymbolTable::MakeClassTemplateSpecializationSymbol(const Span& span, TypeSymbol* primaryClassTemplate, TemplateIdNode* templateIdNode, 
     const std::vector<TypeSymbol*>& templateArguments, const std::vector<Node*>& templateArgumentNodes)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     std::u32string id = MakeClassTemplateSpecializationId(primaryClassTemplate, templateArguments);
     auto it = idTypeMap.find(id);
     if (it != idTypeMap.cend())
     {
-        return it->second;
+        TypeSymbol* type = it->second;
+        if (PrecedesTypeOrder(type))
+        {
+            ClassTemplateSpecializationSymbol* classTemplateSpecializationSymbol = static_cast<ClassTemplateSpecializationSymbol*>(type);
+            classTemplateSpecializationSymbol->SetSpan(span);
+            classTemplateSpecializationSymbol->SetTemplateIdNode(templateIdNode);
+            classTemplateSpecializationSymbol->SetTemplateArgumentNodes(templateArgumentNodes);
+        }
+        return type;
     }
     else
     {
@@ -535,6 +684,7 @@ TypeSymbol* SymbolTable::MakeClassTemplateSpecializationSymbol(const Span& span,
                 templateArguments, templateArgumentNodes, id);
         classTemplateSpecializationSymbol->SetAccess(Specifier::public_);
         idTypeMap[id] = classTemplateSpecializationSymbol;
+        RecordTypeOrder(classTemplateSpecializationSymbol);
         types.push_back(std::unique_ptr<TypeSymbol>(classTemplateSpecializationSymbol));
         return classTemplateSpecializationSymbol;
     }
@@ -542,17 +692,24 @@ TypeSymbol* SymbolTable::MakeClassTemplateSpecializationSymbol(const Span& span,
 
 TypeSymbol* SymbolTable::MakeIntegerLiteralTypeSymbol(const Span& span, const std::u32string& valueName)
 {
+    std::lock_guard<std::mutex> lock(typeMutex);
     std::u32string id = U"literal_" + valueName;
     auto it = idTypeMap.find(id);
     if (it != idTypeMap.cend())
     {
-        return it->second;
+        TypeSymbol* type = it->second;
+        if (PrecedesTypeOrder(type))
+        {
+            type->SetSpan(span);
+        }
+        return type;
     }
     else
     {
         IntegerLiteralTypeSymbol* integerLiteralTypeSymbol = new IntegerLiteralTypeSymbol(span, valueName, id);
         integerLiteralTypeSymbol->SetAccess(Specifier::public_);
         idTypeMap[id] = integerLiteralTypeSymbol;
+        RecordTypeOrder(integerLiteralTypeSymbol);
         types.push_back(std::unique_ptr<TypeSymbol>(integerLiteralTypeSymbol));
         return integerLiteralTypeSymbol;
     }
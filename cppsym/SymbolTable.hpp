@@ -23,11 +23,52 @@
 #include <gendoc/cppast/Template.hpp>
 #include <gendoc/dom/Document.hpp>
 #include <gendoc/dom/Element.hpp>
+#include <mutex>
 
 namespace gendoc { namespace cppsym {
 
 using namespace gendoc::cppast;
 
+// Records the node mappings and function calls made while the function bodies of one source file are bound on a worker thread.
+// The records are applied to the symbol table afterwards in source file order, so the result is the same as when binding sequentially.
+// The order of the source file is also used to keep the first occurrence of a type that several source files make.
+
+class BindingBuffer
+{
+public:
+    BindingBuffer(int order_);
+    int Order() const { return order; }
+    BindingBuffer(const BindingBuffer&) = delete;
+    BindingBuffer& operator=(const BindingBuffer&) = delete;
+    void MapNode(Node* node, Symbol* symbol);
+    void MapIdNodeSequence(Node* node, const std::vector<IdentifierNode*>& idNodeSequence);
+    void AddCall(FunctionSymbol* caller, FunctionSymbol* callee);
+    void AddType(TypeSymbol* type);
+    std::vector<std::pair<Node*, Symbol*>>& NodeSymbols() { return nodeSymbols; }
+    std::vector<std::pair<Node*, std::vector<IdentifierNode*>>>& IdNodeSequences() { return idNodeSequences; }
+    const std::vector<std::pair<FunctionSymbol*, FunctionSymbol*>>& Calls() const { return calls; }
+    const std::vector<TypeSymbol*>& Types() const { return types; }
+private:
+    int order;
+    std::vector<std::pair<Node*, Symbol*>> nodeSymbols;
+    std::vector<std::pair<Node*, std::vector<IdentifierNode*>>> idNodeSequences;
+    std::vector<std::pair<FunctionSymbol*, FunctionSymbol*>> calls;
+    std::vector<TypeSymbol*> types;
+};
+
+// While a scope is alive, node mappings and function calls made by the current thread go to its buffer instead of the symbol table.
+
+class BindingBufferScope
+{
+public:
+    BindingBufferScope(BindingBuffer* buffer);
+    BindingBufferScope(const BindingBufferScope&) = delete;
+    BindingBufferScope& operator=(const BindingBufferScope&) = delete;
+    ~BindingBufferScope();
+private:
+    BindingBuffer* prevBuffer;
+};
+
 class SymbolTable
 {
 public:
@@ -35,6 +76,7 @@ public:
     std::unique_ptr<dom::Document> ToDomDocument();
     std::unique_ptr<dom::Element> ToDomElement();
     std::unique_ptr<dom::Element> CreateTypesElement();
+    void InternIds();
     void BeginContainer(ContainerSymbol* container_);
     void EndContainer();
     int BeginNameSequence(const std::vector<std::pair<std::u32string, int>>& nameSequence);
@@ -61,6 +103,8 @@ public:
     void AddVariable(Node* node, const std::u32string& variableName, const std::u32string& projectName);
     void MapNode(Node* node, Symbol* symbol);
     void MapIdNodeSequence(Node* node, const std::vector<IdentifierNode*>& idNodeSequence);
+    void AddCall(FunctionSymbol* caller, FunctionSymbol* callee);
+    void ApplyBindingBuffer(BindingBuffer& buffer);
     Symbol* GetSymbolNothrow(Node* node);
     Symbol* GetSymbol(Node* node);
     const std::vector<IdentifierNode*>& GetIdNodeSequence(Node* node);
@@ -81,8 +125,12 @@ private:
     std::unordered_map<Node*, Symbol*> nodeSymbolMap;
     std::unordered_map<Node*, std::vector<IdentifierNode*>> idNodeSequenceMap;
     int blockNumber;
+    std::mutex typeMutex;
     std::unordered_map<std::u32string, TypeSymbol*> idTypeMap;
     std::vector<std::unique_ptr<TypeSymbol>> types;
+    std::unordered_map<TypeSymbol*, int> typeOrderMap;
+    void RecordTypeOrder(TypeSymbol* type);
+    bool PrecedesTypeOrder(TypeSymbol* type);
 };
 
 } } // namespace gendoc::cppsym
@@ -0,0 +1,336 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/dom/BinaryDocument.hpp>
+#include <gendoc/dom/Element.hpp>
+#include <gendoc/dom/CharacterData.hpp>
+#include <gendoc/util/BinaryWriter.hpp>
+#include <gendoc/util/BinaryReader.hpp>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace gendoc { namespace dom {
+
+using namespace gendoc::util;
+
+const uint32_t binaryDocumentMagic = 0x42434447; // "GDCB"
+const uint32_t binaryDocumentVersion = 2;
+
+enum class BinaryNodeKind : uint8_t
+{
+    end = 0, element = 1, text = 2, cdataSection = 3, comment = 4, processingInstruction = 5, entityReference = 6
+};
+
+class AttributeCollector : public NodeOp
+{
+public:
+    void Apply(Node* node) override
+    {
+        attributes.push_back(static_cast<Attr*>(node));
+    }
+    const std::vector<Attr*>& Attributes() const { return attributes; }
+private:
+    std::vector<Attr*> attributes;
+};
+
+class BinaryDocumentWriter
+{
+public:
+    BinaryDocumentWriter(Document* document_);
+    void Write(const std::string& fileName, uint64_t sourceSize, const std::string& sourceDigest);
+private:
+    Document* document;
+    std::unordered_map<std::u32string, uint32_t> stringIndexMap;
+    std::vector<const std::u32string*> strings;
+    uint32_t Intern(const std::u32string& s);
+    void CollectStrings(ParentNode* parent);
+    void WriteChildren(BinaryWriter& writer, ParentNode* parent);
+};
+
+BinaryDocumentWriter::BinaryDocumentWriter(Document* document_) : document(document_)
+{
+}
+
+uint32_t BinaryDocumentWriter::Intern(const std::u32string& s)
+{
+    auto it = stringIndexMap.find(s);
+    if (it != stringIndexMap.cend())
+    {
+        return it->second;
+    }
+    uint32_t index = static_cast<uint32_t>(strings.size());
+    auto result = stringIndexMap.insert(std::make_pair(s, index));
+    strings.push_back(&result.first->first);
+    return index;
+}
+
+void BinaryDocumentWriter::CollectStrings(ParentNode* parent)
+{
+    for (Node* child = parent->FirstChild(); child; child = child->NextSibling())
+    {
+        switch (child->GetNodeType())
+        {
+            case NodeType::elementNode:
+            {
+                Element* element = static_cast<Element*>(child);
+                Intern(element->TagName());
+                Intern(element->NamespaceUri());
+                AttributeCollector collector;
+                element->WalkAttribute(collector);
+                for (Attr* attr : collector.Attributes())
+                {
+                    Intern(attr->Name());
+                    Intern(attr->Value());
+                }
+                CollectStrings(element);
+                break;
+            }
+            case NodeType::textNode: case NodeType::cdataSectionNode: case NodeType::commentNode: case NodeType::entityReferenceNode:
+            {
+                Intern(static_cast<CharacterData*>(child)->Data());
+                break;
+            }
+            case NodeType::processingInstructionNode:
+            {
+                ProcessingInstruction* pi = static_cast<ProcessingInstruction*>(child);
+                Intern(pi->Target());
+                Intern(pi->Data());
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+void BinaryDocumentWriter::WriteChildren(BinaryWriter& writer, ParentNode* parent)
+{
+    for (Node* child = parent->FirstChild(); child; child = child->NextSibling())
+    {
+        switch (child->GetNodeType())
+        {
+            case NodeType::elementNode:
+            {
+                Element* element = static_cast<Element*>(child);
+                writer.Write(static_cast<uint8_t>(BinaryNodeKind::element));
+                writer.WriteULEB128UInt(Intern(element->TagName()));
+                writer.WriteULEB128UInt(Intern(element->NamespaceUri()));
+                AttributeCollector collector;
+                element->WalkAttribute(collector);
+                writer.WriteULEB128UInt(static_cast<uint32_t>(collector.Attributes().size()));
+                for (Attr* attr : collector.Attributes())
+                {
+                    writer.WriteULEB128UInt(Intern(attr->Name()));
+                    writer.WriteULEB128UInt(Intern(attr->Value()));
+                }
+                WriteChildren(writer, element);
+                break;
+            }
+            case NodeType::textNode:
+            {
+                writer.Write(static_cast<uint8_t>(BinaryNodeKind::text));
+                writer.WriteULEB128UInt(Intern(static_cast<CharacterData*>(child)->Data()));
+                break;
+            }
+            case NodeType::cdataSectionNode:
+            {
+                writer.Write(static_cast<uint8_t>(BinaryNodeKind::cdataSection));
+                writer.WriteULEB128UInt(Intern(static_cast<CharacterData*>(child)->Data()));
+                break;
+            }
+            case NodeType::commentNode:
+            {
+                writer.Write(static_cast<uint8_t>(BinaryNodeKind::comment));
+                writer.WriteULEB128UInt(Intern(static_cast<CharacterData*>(child)->Data()));
+                break;
+            }
+            case NodeType::entityReferenceNode:
+            {
+                writer.Write(static_cast<uint8_t>(BinaryNodeKind::entityReference));
+                writer.WriteULEB128UInt(Intern(static_cast<CharacterData*>(child)->Data()));
+                break;
+            }
+            case NodeType::processingInstructionNode:
+            {
+                ProcessingInstruction* pi = static_cast<ProcessingInstruction*>(child);
+                writer.Write(static_cast<uint8_t>(BinaryNodeKind::processingInstruction));
+                writer.WriteULEB128UInt(Intern(pi->Target()));
+                writer.WriteULEB128UInt(Intern(pi->Data()));
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+    writer.Write(static_cast<uint8_t>(BinaryNodeKind::end));
+}
+
+void BinaryDocumentWriter::Write(const std::string& fileName, uint64_t sourceSize, const std::string& sourceDigest)
+{
+    Intern(document->XmlVersion());
+    Intern(document->XmlEncoding());
+    CollectStrings(document);
+    BinaryWriter writer(fileName);
+    writer.Write(binaryDocumentMagic);
+    writer.Write(binaryDocumentVersion);
+    writer.Write(sourceSize);
+    writer.Write(sourceDigest);
+    writer.WriteULEB128UInt(static_cast<uint32_t>(strings.size()));
+    for (const std::u32string* s : strings)
+    {
+        writer.Write(*s);
+    }
+    writer.WriteULEB128UInt(Intern(document->XmlVersion()));
+    writer.WriteULEB128UInt(Intern(document->XmlEncoding()));
+    writer.Write(document->XmlStandalone());
+    WriteChildren(writer, document);
+}
+
+void WriteBinaryDocument(Document* document, const std::string& fileName, uint64_t sourceSize, const std::string& sourceDigest)
+{
+    BinaryDocumentWriter writer(document);
+    writer.Write(fileName, sourceSize, sourceDigest);
+}
+
+class BinaryDocumentReader
+{
+public:
+    BinaryDocumentReader(const std::string& fileName);
+    std::unique_ptr<Document> Read(uint64_t sourceSize, const std::string& sourceDigest);
+private:
+    BinaryReader reader;
+    std::vector<std::u32string> strings;
+    const std::u32string& ReadString();
+};
+
+BinaryDocumentReader::BinaryDocumentReader(const std::string& fileName) : reader(fileName)
+{
+}
+
+const std::u32string& BinaryDocumentReader::ReadString()
+{
+    uint32_t index = reader.ReadULEB128UInt();
+    if (index >= strings.size())
+    {
+        throw std::runtime_error("invalid string index in binary document '" + reader.FileName() + "'");
+    }
+    return strings[index];
+}
+
+std::unique_ptr<Document> BinaryDocumentReader::Read(uint64_t sourceSize, const std::string& sourceDigest)
+{
+    if (reader.ReadUInt() != binaryDocumentMagic)
+    {
+        throw std::runtime_error("'" + reader.FileName() + "' is not a binary document");
+    }
+    if (reader.ReadUInt() != binaryDocumentVersion)
+    {
+        throw std::runtime_error("binary document '" + reader.FileName() + "' has unsupported format version");
+    }
+    if (reader.ReadULong() != sourceSize || reader.ReadUtf8String() != sourceDigest)
+    {
+        throw std::runtime_error("binary document '" + reader.FileName() + "' is out of date");
+    }
+    uint32_t numStrings = reader.ReadULEB128UInt();
+    strings.reserve(numStrings);
+    for (uint32_t i = 0; i < numStrings; ++i)
+    {
+        strings.push_back(reader.ReadUtf32String());
+    }
+    std::unique_ptr<Document> document(new Document());
+    document->SetXmlVersion(ReadString());
+    document->SetXmlEncoding(ReadString());
+    document->SetXmlStandalone(reader.ReadBool());
+    std::vector<ParentNode*> parentStack;
+    ParentNode* parent = document.get();
+    while (parent)
+    {
+        BinaryNodeKind kind = static_cast<BinaryNodeKind>(reader.ReadByte());
+        switch (kind)
+        {
+            case BinaryNodeKind::end:
+            {
+                if (parentStack.empty())
+                {
+                    parent = nullptr;
+                }
+                else
+                {
+                    parent = parentStack.back();
+                    parentStack.pop_back();
+                }
+                break;
+            }
+            case BinaryNodeKind::element:
+            {
+                const std::u32string& name = ReadString();
+                const std::u32string& namespaceUri = ReadString();
+                std::map<std::u32string, std::unique_ptr<Attr>> attributeMap;
+                uint32_t numAttributes = reader.ReadULEB128UInt();
+                for (uint32_t i = 0; i < numAttributes; ++i)
+                {
+                    const std::u32string& attrName = ReadString();
+                    const std::u32string& attrValue = ReadString();
+                    attributeMap[attrName] = std::unique_ptr<Attr>(new Attr(attrName, attrValue));
+                }
+                std::unique_ptr<Element> element(new Element(name, std::move(attributeMap)));
+                if (!namespaceUri.empty())
+                {
+                    element->InternalSetNamespaceUri(namespaceUri);
+                }
+                ParentNode* elementNode = element.get();
+                parent->AppendChild(std::unique_ptr<Node>(element.release()));
+                parentStack.push_back(parent);
+                parent = elementNode;
+                break;
+            }
+            case BinaryNodeKind::text:
+            {
+                parent->AppendChild(std::unique_ptr<Node>(new Text(ReadString())));
+                break;
+            }
+            case BinaryNodeKind::cdataSection:
+            {
+                parent->AppendChild(std::unique_ptr<Node>(new CDataSection(ReadString())));
+                break;
+            }
+            case BinaryNodeKind::comment:
+            {
+                parent->AppendChild(std::unique_ptr<Node>(new Comment(ReadString())));
+                break;
+            }
+            case BinaryNodeKind::entityReference:
+            {
+                parent->AppendChild(std::unique_ptr<Node>(new EntityReference(ReadString())));
+                break;
+            }
+            case BinaryNodeKind::processingInstruction:
+            {
+                const std::u32string& target = ReadString();
+                const std::u32string& data = ReadString();
+                parent->AppendChild(std::unique_ptr<Node>(new ProcessingInstruction(target, data)));
+                break;
+            }
+            default:
+            {
+                throw std::runtime_error("invalid node kind in binary document '" + reader.FileName() + "'");
+            }
+        }
+    }
+    return document;
+}
+
+std::unique_ptr<Document> ReadBinaryDocument(const std::string& fileName, uint64_t sourceSize, const std::string& sourceDigest)
+{
+    BinaryDocumentReader reader(fileName);
+    return reader.Read(sourceSize, sourceDigest);
+}
+
+} } // namespace gendoc::dom
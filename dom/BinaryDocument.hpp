@@ -0,0 +1,23 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef GENDOC_DOM_BINARY_DOCUMENT_INCLUDED
+#define GENDOC_DOM_BINARY_DOCUMENT_INCLUDED
+#include <gendoc/dom/Document.hpp>
+
+namespace gendoc { namespace dom {
+
+// A document in binary form starts with a table of the distinct strings of the document: element and attribute names, attribute values and
+// character data. The nodes follow in document order and refer to the strings by ULEB128 encoded indeces, so reading a document back
+// decodes each string once and involves no XML parsing.
+// The header records the size and digest of the XML file the document was made from. Reading throws if they differ from the given ones,
+// so a binary document that is out of date with respect to its XML file is never used.
+
+void WriteBinaryDocument(Document* document, const std::string& fileName, uint64_t sourceSize, const std::string& sourceDigest);
+std::unique_ptr<Document> ReadBinaryDocument(const std::string& fileName, uint64_t sourceSize, const std::string& sourceDigest);
+
+} } // namespace gendoc::dom
+
+#endif // GENDOC_DOM_BINARY_DOCUMENT_INCLUDED
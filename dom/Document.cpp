@@ -137,14 +137,19 @@ void BuildIndexVisitor::BeginVisit(Element* element)
     }
 }
 
+void Document::BuildIndex()
+{
+    elementsByIdMap.clear();
+    BuildIndexVisitor visitor(elementsByIdMap);
+    Accept(visitor);
+    indexValid = true;
+}
+
 Element* Document::GetElementById(const std::u32string& elementId)
 {
     if (!indexValid)
     {
-        elementsByIdMap.clear();
-        BuildIndexVisitor visitor(elementsByIdMap);
-        Accept(visitor);
-        indexValid = true;
+        BuildIndex();
     }
     auto it = elementsByIdMap.find(elementId);
     if (it != elementsByIdMap.cend())
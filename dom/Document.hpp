@@ -29,6 +29,7 @@ public:
     std::unique_ptr<Node> RemoveChild(Node* oldChild) override;
     Node* AppendChild(std::unique_ptr<Node>&& newChild) override;
     Element* GetElementById(const std::u32string& elementId);
+    void BuildIndex();
     void SetXmlStandalone(bool xmlStandalone_) { xmlStandalone = xmlStandalone_; }
     bool XmlStandalone() const { return xmlStandalone; }
     void SetXmlVersion(const std::u32string& xmlVersion_) { xmlVersion = xmlVersion_; }
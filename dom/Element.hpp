@@ -10,6 +10,8 @@
 
 namespace gendoc { namespace dom {
 
+std::u32string MakeXmlAttrValue(const std::u32string& attributeValue);
+
 class Attr : public Node
 {
 public:
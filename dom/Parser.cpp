@@ -7,7 +7,6 @@
 #include <gendoc/dom/Element.hpp>
 #include <gendoc/dom/CharacterData.hpp>
 #include <gendoc/xml/XmlParser.hpp>
-#include <gendoc/util/MappedInputFile.hpp>
 #include <gendoc/util/Unicode.hpp>
 #include <gendoc/util/TextUtils.hpp>
 #include <string>
@@ -195,8 +194,9 @@ std::unique_ptr<Document> ParseDocument(const std::u32string& content, const std
 
 std::unique_ptr<Document> ReadDocument(const std::string& fileName)
 {
-    std::u32string content = ToUtf32(ReadFile(fileName));
-    return ParseDocument(content, fileName);
+    DomDocumentHandler domDocumentHandler;
+    ParseXmlFile(fileName, &domDocumentHandler);
+    return domDocumentHandler.GetDocument();
 }
 
 } } // namespace gendoc::dom
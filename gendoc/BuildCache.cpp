@@ -0,0 +1,140 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/gendoc/BuildCache.hpp>
+#include <gendoc/xpath/XPathEvaluate.hpp>
+#include <gendoc/dom/Parser.hpp>
+#include <gendoc/dom/Element.hpp>
+#include <gendoc/util/MappedInputFile.hpp>
+#include <gendoc/util/CodeFormatter.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/Sha1.hpp>
+#include <boost/filesystem.hpp>
+#include <iostream>
+#include <fstream>
+
+namespace gendoc { namespace buildcache {
+
+using namespace gendoc::util;
+using namespace gendoc::unicode;
+
+std::string GetFileDigest(const std::string& filePath)
+{
+    Sha1 sha1;
+    if (boost::filesystem::file_size(filePath) > 0)
+    {
+        MappedInputFile file(filePath);
+        sha1.Process(const_cast<char*>(file.Begin()), const_cast<char*>(file.End()));
+    }
+    return sha1.GetDigest();
+}
+
+BuildCache::BuildCache(const std::string& cacheFilePath_) : cacheFilePath(cacheFilePath_)
+{
+}
+
+void BuildCache::Read()
+{
+    phaseDigestMap.clear();
+    if (!boost::filesystem::exists(cacheFilePath))
+    {
+        return;
+    }
+    std::unique_ptr<dom::Document> cacheXml = dom::ReadDocument(cacheFilePath);
+    std::unique_ptr<xpath::XPathObject> phases = xpath::Evaluate(U"/buildCache/phase", cacheXml.get());
+    if (phases->Type() == xpath::XPathObjectType::nodeSet)
+    {
+        xpath::XPathNodeSet* phaseNodeSet = static_cast<xpath::XPathNodeSet*>(phases.get());
+        int n = phaseNodeSet->Length();
+        for (int i = 0; i < n; ++i)
+        {
+            dom::Node* phaseNode = (*phaseNodeSet)[i];
+            if (phaseNode->GetNodeType() == dom::NodeType::elementNode)
+            {
+                dom::Element* phaseElement = static_cast<dom::Element*>(phaseNode);
+                std::map<std::string, std::string>& digestMap = phaseDigestMap[ToUtf8(phaseElement->GetAttribute(U"name"))];
+                std::unique_ptr<xpath::XPathObject> files = xpath::Evaluate(U"file", phaseNode);
+                if (files->Type() == xpath::XPathObjectType::nodeSet)
+                {
+                    xpath::XPathNodeSet* fileNodeSet = static_cast<xpath::XPathNodeSet*>(files.get());
+                    int m = fileNodeSet->Length();
+                    for (int j = 0; j < m; ++j)
+                    {
+                        dom::Node* fileNode = (*fileNodeSet)[j];
+                        if (fileNode->GetNodeType() == dom::NodeType::elementNode)
+                        {
+                            dom::Element* fileElement = static_cast<dom::Element*>(fileNode);
+                            digestMap[ToUtf8(fileElement->GetAttribute(U"path"))] = ToUtf8(fileElement->GetAttribute(U"sha1"));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void BuildCache::Write()
+{
+    dom::Document cacheXml;
+    std::unique_ptr<dom::Element> buildCacheElement(new dom::Element(U"buildCache"));
+    for (const std::pair<std::string, std::map<std::string, std::string>>& phaseDigests : phaseDigestMap)
+    {
+        std::unique_ptr<dom::Element> phaseElement(new dom::Element(U"phase"));
+        phaseElement->SetAttribute(U"name", ToUtf32(phaseDigests.first));
+        for (const std::pair<std::string, std::string>& fileDigest : phaseDigests.second)
+        {
+            std::unique_ptr<dom::Element> fileElement(new dom::Element(U"file"));
+            fileElement->SetAttribute(U"path", ToUtf32(fileDigest.first));
+            fileElement->SetAttribute(U"sha1", ToUtf32(fileDigest.second));
+            phaseElement->AppendChild(std::unique_ptr<dom::Node>(fileElement.release()));
+        }
+        buildCacheElement->AppendChild(std::unique_ptr<dom::Node>(phaseElement.release()));
+    }
+    cacheXml.AppendChild(std::unique_ptr<dom::Node>(buildCacheElement.release()));
+    std::ofstream cacheXmlFile(cacheFilePath);
+    CodeFormatter formatter(cacheXmlFile);
+    formatter.SetIndentSize(1);
+    cacheXml.Write(formatter);
+}
+
+bool BuildCache::InputFilesUnchanged(const std::string& phase, bool verbose) const
+{
+    auto it = phaseDigestMap.find(phase);
+    if (it == phaseDigestMap.cend())
+    {
+        return false;
+    }
+    bool unchanged = true;
+    for (const std::pair<std::string, std::string>& fileDigest : it->second)
+    {
+        if (!boost::filesystem::exists(fileDigest.first) || GetFileDigest(fileDigest.first) != fileDigest.second)
+        {
+            if (!verbose)
+            {
+                return false;
+            }
+            std::cout << "'" << fileDigest.first << "' changed" << std::endl;
+            unchanged = false;
+        }
+    }
+    return unchanged;
+}
+
+void BuildCache::SetInputFiles(const std::string& phase, const std::vector<std::string>& inputFilePaths)
+{
+    std::map<std::string, std::string>& digestMap = phaseDigestMap[phase];
+    digestMap.clear();
+    for (const std::string& inputFilePath : inputFilePaths)
+    {
+        digestMap[inputFilePath] = GetFileDigest(inputFilePath);
+    }
+}
+
+void BuildCache::Invalidate(const std::string& phase)
+{
+    phaseDigestMap.erase(phase);
+}
+
+} } // namespace gendoc::buildcache
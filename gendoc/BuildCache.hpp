@@ -0,0 +1,35 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef GENDOC_BUILD_CACHE_INCLUDED
+#define GENDOC_BUILD_CACHE_INCLUDED
+#include <gendoc/dom/Document.hpp>
+#include <map>
+#include <vector>
+
+namespace gendoc { namespace buildcache {
+
+// Records for each phase the files it was generated from together with a SHA-1 digest of their contents. The cache does not track which
+// output depends on which input: when none of the input files of a phase has changed the whole phase is skipped, otherwise it is run in full.
+
+class BuildCache
+{
+public:
+    BuildCache(const std::string& cacheFilePath_);
+    void Read();
+    void Write();
+    bool InputFilesUnchanged(const std::string& phase, bool verbose) const;
+    void SetInputFiles(const std::string& phase, const std::vector<std::string>& inputFilePaths);
+    void Invalidate(const std::string& phase);
+private:
+    std::string cacheFilePath;
+    std::map<std::string, std::map<std::string, std::string>> phaseDigestMap;
+};
+
+std::string GetFileDigest(const std::string& filePath);
+
+} } // namespace gendoc::buildcache
+
+#endif // GENDOC_BUILD_CACHE_INCLUDED
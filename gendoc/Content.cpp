@@ -19,16 +19,23 @@
 #include <gendoc/parsing/Visitor.hpp>
 #include <gendoc/parsing/Primitive.hpp>
 #include <gendoc/parsing/Composite.hpp>
+#include <gendoc/parsing/Linking.hpp>
 #include <gendoc/cppast/Visitor.hpp>
 #include <gendoc/xpath/XPathEvaluate.hpp>
 #include <gendoc/dom/Parser.hpp>
+#include <gendoc/dom/BinaryDocument.hpp>
 #include <gendoc/dom/CharacterData.hpp>
 #include <gendoc/util/TextUtils.hpp>
 #include <gendoc/util/MappedInputFile.hpp>
 #include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/Hash128.hpp>
 #include <gendoc/util/Util.hpp>
+#include <gendoc/util/Parallel.hpp>
+#include <gendoc/util/Log.hpp>
 #include <boost/filesystem.hpp>
 #include <iostream>
+#include <algorithm>
+#include <map>
 
 namespace gendoc { namespace content {
 
@@ -90,63 +97,157 @@ void ResolveIncludeDirectives(SourceFileNode* sourceFileNode, const std::unorder
     sourceFileNode->Accept(resolver);
 }
 
-CppSourceFile* cppSourceFileGrammar = nullptr;
-IncludeDirective* includeDirectiveGrammar = nullptr;
+std::vector<CppSourceFile*> cppSourceFileGrammars;
+std::vector<IncludeDirective*> includeDirectiveGrammars;
+std::vector<Rule*> memoizedRules;
+std::vector<Rule*> sourceFileRules;
 
-std::unique_ptr<SourceFileNode> ParseSourceFile(const std::string& sourceFilePath, const std::string& relativeSourceFilePath, const std::u32string& projectName, 
-    bool debugParse, int& sourceFileIndex)
+void CreateSourceFileGrammars(int numThreads, bool packrat, bool dispatch)
 {
-    if (!cppSourceFileGrammar)
+    while (int(cppSourceFileGrammars.size()) < numThreads)
     {
-        cppSourceFileGrammar = CppSourceFile::Create();
+        CppSourceFile* cppSourceFileGrammar = CppSourceFile::Create();
+        IncludeDirective* includeDirectiveGrammar = IncludeDirective::Create();
+        if (dispatch)
+        {
+            CreateDispatchTables(cppSourceFileGrammar->GetParsingDomain());
+            CreateDispatchTables(includeDirectiveGrammar->GetParsingDomain());
+        }
+        if (packrat)
+        {
+            std::vector<Rule*> cppSourceFileRules = EnableMemoization(cppSourceFileGrammar->GetParsingDomain());
+            memoizedRules.insert(memoizedRules.end(), cppSourceFileRules.begin(), cppSourceFileRules.end());
+            std::vector<Rule*> includeDirectiveRules = EnableMemoization(includeDirectiveGrammar->GetParsingDomain());
+            memoizedRules.insert(memoizedRules.end(), includeDirectiveRules.begin(), includeDirectiveRules.end());
+        }
+        std::vector<Rule*> cppSourceFileGrammarRules = GetRules(cppSourceFileGrammar->GetParsingDomain());
+        sourceFileRules.insert(sourceFileRules.end(), cppSourceFileGrammarRules.begin(), cppSourceFileGrammarRules.end());
+        std::vector<Rule*> includeDirectiveGrammarRules = GetRules(includeDirectiveGrammar->GetParsingDomain());
+        sourceFileRules.insert(sourceFileRules.end(), includeDirectiveGrammarRules.begin(), includeDirectiveGrammarRules.end());
+        cppSourceFileGrammars.push_back(cppSourceFileGrammar);
+        includeDirectiveGrammars.push_back(includeDirectiveGrammar);
+    }
+}
+
+void WriteMemoizationStatistics()
+{
+    std::map<std::u32string, std::pair<int64_t, int64_t>> statistics;
+    for (Rule* rule : memoizedRules)
+    {
+        std::pair<int64_t, int64_t>& s = statistics[rule->FullName()];
+        s.first += rule->MemoHits();
+        s.second += rule->MemoMisses();
+    }
+    std::cout << "memoized rules:" << std::endl;
+    for (const std::pair<std::u32string, std::pair<int64_t, int64_t>>& p : statistics)
+    {
+        if (p.second.first == 0 && p.second.second == 0) continue;
+        std::cout << ToUtf8(p.first) << ": " << p.second.first << " hits, " << p.second.second << " misses" << std::endl;
+    }
+}
+
+void WriteContextDepthStatistics()
+{
+    std::map<std::u32string, int> statistics;
+    for (Rule* rule : sourceFileRules)
+    {
+        int& peakDepth = statistics[rule->FullName()];
+        peakDepth = std::max(peakDepth, rule->PeakContextDepth());
     }
-    if (!includeDirectiveGrammar)
+    std::cout << "peak rule context depths:" << std::endl;
+    for (const std::pair<std::u32string, int>& p : statistics)
     {
-        includeDirectiveGrammar = IncludeDirective::Create();
+        if (p.second == 0) continue;
+        std::cout << ToUtf8(p.first) << ": " << p.second << std::endl;
     }
+}
+
+std::unique_ptr<SourceFileNode> ParseSourceFile(CppSourceFile* cppSourceFileGrammar, IncludeDirective* includeDirectiveGrammar, const std::string& sourceFilePath, 
+    const std::string& relativeSourceFilePath, const std::u32string& projectName, bool debugParse, int sourceFileIndex)
+{
     if (debugParse)
     {
         cppSourceFileGrammar->SetLog(&std::cout);
         cppSourceFileGrammar->SetMaxLogLineLength(1024);
     }
-    std::u32string sourceFileContent;
+    std::unique_ptr<SourceFileNode> sourceFileNode(new SourceFileNode(Span(), sourceFilePath, relativeSourceFilePath, projectName));
+    std::unique_ptr<MappedInputFile> sourceFile;
+    const char* sourceFileBegin = nullptr;
+    const char* sourceFileEnd = nullptr;
     if (boost::filesystem::file_size(sourceFilePath) > 0)
     {
-        MappedInputFile sourceFile(sourceFilePath);
-        sourceFileContent = ToUtf32(std::string(sourceFile.Begin(), sourceFile.End()));
+        sourceFile.reset(new MappedInputFile(sourceFilePath));
+        sourceFileBegin = sourceFile->Begin();
+        sourceFileEnd = sourceFile->End();
     }
-    std::unique_ptr<SourceFileNode> sourceFileNode(new SourceFileNode(Span(), sourceFilePath, relativeSourceFilePath, projectName));
-    includeDirectiveGrammar->Parse(sourceFileContent.c_str(), sourceFileContent.c_str() + sourceFileContent.length(), sourceFileIndex, sourceFilePath, sourceFileNode.get());
-    cppSourceFileGrammar->Parse(sourceFileContent.c_str(), sourceFileContent.c_str() + sourceFileContent.length(), sourceFileIndex, sourceFilePath, sourceFileNode.get());
+    LazyUtf32Text sourceFileContent(sourceFileBegin, sourceFileEnd);
+    {
+        LazyTextScope lazyTextScope(&sourceFileContent);
+        NodeArenaScope arenaScope(sourceFileNode->Arena());
+        includeDirectiveGrammar->Parse(sourceFileContent.Start(), sourceFileContent.End(), sourceFileIndex, sourceFilePath, sourceFileNode.get());
+        cppSourceFileGrammar->Parse(sourceFileContent.Start(), sourceFileContent.End(), sourceFileIndex, sourceFilePath, sourceFileNode.get());
+    }
+    sourceFileNode->SetContent(std::move(sourceFileContent.Text()));
     sourceFileNode->SetSourceFileIndex(sourceFileIndex);
-    sourceFileNode->ComputeLineStarts(sourceFileContent);
-    ++sourceFileIndex;
     return sourceFileNode;
 }
 
+class SourceFileParser : public ParallelWork
+{
+public:
+    SourceFileParser(const std::vector<std::pair<std::string, std::string>>& sourceFilePaths_, std::vector<std::unique_ptr<SourceFileNode>>& parsedSourceFiles_, bool verbose_, 
+        int firstSourceFileIndex_, const std::u32string& projectName_);
+    void Run(int itemIndex, int threadIndex) override;
+private:
+    const std::vector<std::pair<std::string, std::string>>& sourceFilePaths;
+    std::vector<std::unique_ptr<SourceFileNode>>& parsedSourceFiles;
+    bool verbose;
+    int firstSourceFileIndex;
+    const std::u32string& projectName;
+};
+
+SourceFileParser::SourceFileParser(const std::vector<std::pair<std::string, std::string>>& sourceFilePaths_, std::vector<std::unique_ptr<SourceFileNode>>& parsedSourceFiles_, 
+    bool verbose_, int firstSourceFileIndex_, const std::u32string& projectName_) : 
+    sourceFilePaths(sourceFilePaths_), parsedSourceFiles(parsedSourceFiles_), verbose(verbose_), firstSourceFileIndex(firstSourceFileIndex_), projectName(projectName_)
+{
+}
+
+void SourceFileParser::Run(int itemIndex, int threadIndex)
+{
+    const std::pair<std::string, std::string>& sourceFilePath = sourceFilePaths[itemIndex];
+    if (verbose)
+    {
+        LogMessage(-1, "> " + sourceFilePath.first);
+    }
+    parsedSourceFiles[itemIndex] = ParseSourceFile(cppSourceFileGrammars[threadIndex], includeDirectiveGrammars[threadIndex], sourceFilePath.first, sourceFilePath.second,
+        projectName, false, firstSourceFileIndex + itemIndex);
+}
+
 std::unique_ptr<gendoc::cppast::Node> ParseSourceFiles(const std::vector<std::pair<std::string, std::string>>& sourceFilePaths, 
     std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles, std::unordered_map<std::string, SourceFileNode*>& allSourceFiles, 
-    bool verbose, int& sourceFileIndex, const std::u32string& projectName)
+    bool verbose, int numJobs, bool packrat, bool dispatch, int& sourceFileIndex, const std::u32string& projectName)
 {
     if (verbose)
     {
         std::cout << "parsing sources..." << std::endl;
     }
+    if (sourceFileIndex != sourceFiles.size())
+    {
+        throw std::runtime_error("source file index does not match");
+    }
+    int numSourceFiles = int(sourceFilePaths.size());
+    int numThreads = std::max(1, std::min(numJobs, numSourceFiles));
+    CreateSourceFileGrammars(numThreads, packrat, dispatch);
+    std::vector<std::unique_ptr<SourceFileNode>> parsedSourceFiles(numSourceFiles);
+    SourceFileParser parser(sourceFilePaths, parsedSourceFiles, verbose, sourceFileIndex, projectName);
+    ParallelFor(numSourceFiles, numThreads, parser);
     std::unique_ptr<gendoc::cppast::Node> node;
     std::vector<SourceFileNode*> sourceFileNodes;
-    for (const std::pair<std::string, std::string>& sourceFilePath : sourceFilePaths)
+    for (std::unique_ptr<SourceFileNode>& sourceFileNode : parsedSourceFiles)
     {
-        if (verbose)
-        {
-            std::cout << "> " << sourceFilePath.first << std::endl;
-        }
-        if (sourceFileIndex != sourceFiles.size())
-        {
-            throw std::runtime_error("source file index does not match");
-        }
-        std::unique_ptr<SourceFileNode> sourceFileNode = ParseSourceFile(sourceFilePath.first, sourceFilePath.second, projectName, false, sourceFileIndex);
         sourceFiles.push_back(sourceFileNode.get());
         sourceFileNodes.push_back(sourceFileNode.get());
+        ++sourceFileIndex;
         if (node)
         {
             node.reset(new SourceFileSequenceNode(Span(), node.release(), sourceFileNode.release()));
@@ -191,10 +292,12 @@ void ParseParserSourceFiles(const std::vector<std::pair<std::string, std::string
             std::cout << "> " << sourceFilePath << std::endl;
         }
         MappedInputFile parserSourceFile(sourceFilePath);
-        std::u32string parserSourceFileContent = ToUtf32(std::string(parserSourceFile.Begin(), parserSourceFile.End()));
+        LazyUtf32Text parserSourceFileContent(parserSourceFile.Begin(), parserSourceFile.End());
+        LazyTextScope lazyTextScope(&parserSourceFileContent);
         std::unique_ptr<ParserFileContent> parserFileContent(parserFileGrammar->Parse(
-            parserSourceFileContent.c_str(), parserSourceFileContent.c_str() + parserSourceFileContent.length(), parserSourceFileIndex, sourceFilePath, projectId, parsingDomain));
+            parserSourceFileContent.Start(), parserSourceFileContent.End(), parserSourceFileIndex, sourceFilePath, projectId, parsingDomain));
         parserFileContent->SetRelativeFilePath(sourceFileName);
+        parserFileContent->SetContent(std::move(parserSourceFileContent.Text()));
         ++parserSourceFileIndex;
         parserFileContents.push_back(std::move(parserFileContent));
     }
@@ -1565,9 +1668,25 @@ void ProcessGrammars(gendoc::cppsym::SymbolTable& symbolTable, ParsingDomain* pa
     parsingDomain->GlobalNamespace()->Accept(ruleBodyCreatorVisitor);
 }
 
-std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXml, dom::Document* solutionXml, const std::string& contentXmlFilePath, bool verbose,
-    gendoc::cppsym::SymbolTable& symbolTable, std::vector<std::unique_ptr<gendoc::cppast::Node>>& asts, std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles,
-    ParsingDomain* parsingDomain, std::vector<std::unique_ptr<ParserFileContent>>& parserFileContents, std::unordered_map<int, std::u32string>& parserProjectMap)
+std::string ContentBinFilePath(const std::string& contentXmlFilePath)
+{
+    return boost::filesystem::path(contentXmlFilePath).replace_extension(".bin").generic_string();
+}
+
+std::string ContentXmlDigest(const std::string& contentXmlFilePath, uint64_t contentXmlSize)
+{
+    if (contentXmlSize == 0)
+    {
+        return GetHash128Digest(nullptr, 0);
+    }
+    MappedInputFile contentXmlFile(contentXmlFilePath);
+    return GetHash128Digest(contentXmlFile.Begin(), static_cast<size_t>(contentXmlFile.End() - contentXmlFile.Begin()));
+}
+
+std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXml, dom::Document* solutionXml, const std::string& contentXmlFilePath, bool verbose, int numJobs,
+    bool packrat, bool dispatch, gendoc::cppsym::SymbolTable& symbolTable, std::vector<std::unique_ptr<gendoc::cppast::Node>>& asts, std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles,
+    ParsingDomain* parsingDomain, std::vector<std::unique_ptr<ParserFileContent>>& parserFileContents, std::unordered_map<int, std::u32string>& parserProjectMap,
+    std::vector<std::string>& inputFilePaths)
 {
     std::unique_ptr<gendoc::dom::Document> contentXml;
     std::unique_ptr<xpath::XPathObject> projects = xpath::Evaluate(U"/solution/project", solutionXml);
@@ -1587,7 +1706,9 @@ std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXm
             {
                 dom::Element* projectElement = static_cast<dom::Element*>(projectNode);
                 std::u32string projectName = projectElement->GetAttribute(U"name");
-                std::unique_ptr<xpath::XPathObject> component = xpath::Evaluate(U"/solution/components/component[@name=\"" + projectName + U"\"]", inputXml);
+                xpath::XPathVariableBindings bindings;
+                bindings.BindString(U"name", projectName);
+                std::unique_ptr<xpath::XPathObject> component = xpath::Evaluate(U"/solution/components/component[@name=$name]", inputXml, bindings);
                 if (component->Type() == xpath::XPathObjectType::nodeSet)
                 {
                     xpath::XPathNodeSet* componentNodeSet = static_cast<xpath::XPathNodeSet*>(component.get());
@@ -1612,10 +1733,11 @@ std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXm
                                     std::string sourceFilePath = ToUtf8(sourceElement->GetAttribute(U"filePath"));
                                     std::string relativeSourceFilePath = ToUtf8(sourceElement->GetAttribute(U"relativeFilePath"));
                                     sourceFilePaths.push_back(std::make_pair(sourceFilePath, relativeSourceFilePath));
+                                    inputFilePaths.push_back(sourceFilePath);
                                 }
                             }
                         }
-                        std::unique_ptr<gendoc::cppast::Node> ast = ParseSourceFiles(sourceFilePaths, sourceFiles, allSourceFiles, verbose, sourceFileIndex, projectName);
+                        std::unique_ptr<gendoc::cppast::Node> ast = ParseSourceFiles(sourceFilePaths, sourceFiles, allSourceFiles, verbose, numJobs, packrat, dispatch, sourceFileIndex, projectName);
                         if (ast)
                         {
                             if (verbose)
@@ -1641,8 +1763,7 @@ std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXm
                             }
                             std::vector<std::unique_ptr<BoundSourceFile>> sourceFiles = typeBinder.SourceFiles();
                             std::unordered_map<SourceFileNode*, BoundSourceFile*> sourceFileMap = typeBinder.SourceFileMap();
-                            StatementBinder statementBinder(symbolTable, sourceFileMap);
-                            ast->Accept(statementBinder);
+                            BindStatements(ast.get(), symbolTable, sourceFileMap, numJobs);
                             asts.push_back(std::move(ast));
                         }
                         std::unique_ptr<xpath::XPathObject> parserSources = xpath::Evaluate(U"parserSources/parserSource", projectNode);
@@ -1660,6 +1781,7 @@ std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXm
                                     std::string sourceFilePath = ToUtf8(parserSourceElement->GetAttribute(U"filePath"));
                                     std::string relativeSourceFilePath = ToUtf8(parserSourceElement->GetAttribute(U"relativeFilePath"));
                                     parserSourceFilePaths.push_back(std::make_pair(sourceFilePath, relativeSourceFilePath));
+                                    inputFilePaths.push_back(sourceFilePath);
                                 }
                             }
                         }
@@ -1674,6 +1796,11 @@ std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXm
             }
         }
     }
+    if (verbose)
+    {
+        std::cout << "interning symbol ids..." << std::endl;
+    }
+    symbolTable.InternIds();
     contentXml.reset(new dom::Document());
     std::unique_ptr<dom::Element> solutionElement(new dom::Element(U"solution"));
     std::unique_ptr<dom::Element> symbolTableElement = symbolTable.ToDomElement();
@@ -1683,16 +1810,42 @@ std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXm
     formatter.SetIndentSize(1);
     contentXml->AppendChild(std::unique_ptr<dom::Node>(solutionElement.release()));
     contentXml->Write(formatter);
+    contentXmlFile.close();
+    uint64_t contentXmlSize = boost::filesystem::file_size(contentXmlFilePath);
+    std::string contentBinFilePath = ContentBinFilePath(contentXmlFilePath);
+    dom::WriteBinaryDocument(contentXml.get(), contentBinFilePath, contentXmlSize, ContentXmlDigest(contentXmlFilePath, contentXmlSize));
     if (verbose)
     {
+        if (packrat)
+        {
+            WriteMemoizationStatistics();
+        }
+        WriteContextDepthStatistics();
         std::cout << "==> " << contentXmlFilePath << std::endl;
+        std::cout << "==> " << contentBinFilePath << std::endl;
     }
     return contentXml;
 }
 
 std::unique_ptr<gendoc::dom::Document> ReadContentXml(const std::string& contentXmlFilePath)
 {
-    return dom::ReadDocument(contentXmlFilePath);
+    std::string contentBinFilePath = ContentBinFilePath(contentXmlFilePath);
+    uint64_t contentXmlSize = boost::filesystem::file_size(contentXmlFilePath);
+    std::string contentXmlDigest = ContentXmlDigest(contentXmlFilePath, contentXmlSize);
+    if (boost::filesystem::exists(contentBinFilePath))
+    {
+        try
+        {
+            return dom::ReadBinaryDocument(contentBinFilePath, contentXmlSize, contentXmlDigest);
+        }
+        catch (const std::exception& ex)
+        {
+            LogMessage(-1, "'" + contentBinFilePath + "' not used, reading '" + contentXmlFilePath + "': " + ex.what());
+        }
+    }
+    std::unique_ptr<gendoc::dom::Document> contentXml = dom::ReadDocument(contentXmlFilePath);
+    dom::WriteBinaryDocument(contentXml.get(), contentBinFilePath, contentXmlSize, contentXmlDigest);
+    return contentXml;
 }
 
 } } // namespace gendoc::content
@@ -13,10 +13,10 @@
 
 namespace gendoc { namespace content {
 
-std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXml, dom::Document* solutionXml, const std::string& contentXmlFilePath, bool verbose,
-    gendoc::cppsym::SymbolTable& symbolTable, std::vector<std::unique_ptr<gendoc::cppast::Node>>& asts, std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles,
+std::unique_ptr<gendoc::dom::Document> GenerateContentXml(dom::Document* inputXml, dom::Document* solutionXml, const std::string& contentXmlFilePath, bool verbose, int numJobs,
+    bool packrat, bool dispatch, gendoc::cppsym::SymbolTable& symbolTable, std::vector<std::unique_ptr<gendoc::cppast::Node>>& asts, std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles,
     gendoc::parsing::ParsingDomain* parsingDomain, std::vector<std::unique_ptr<gendoc::syntax::ParserFileContent>>& parserFileContents, 
-    std::unordered_map<int, std::u32string>& parserProjectMap);
+    std::unordered_map<int, std::u32string>& parserProjectMap, std::vector<std::string>& inputFilePaths);
 std::unique_ptr<gendoc::dom::Document> ReadContentXml(const std::string& contentXmlFilePath);
 
 } } // namespace gendoc::content
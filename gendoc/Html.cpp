@@ -13,12 +13,14 @@
 #include <gendoc/dom/CharacterData.hpp>
 #include <gendoc/xpath/XPathEvaluate.hpp>
 #include <gendoc/cppparser/ParserTokenGrammar.hpp>
+#include <gendoc/cppparser/CppTokenGrammar.hpp>
 #include <gendoc/cppsym/Symbol.hpp>
 #include <gendoc/parsing/Utility.hpp>
 #include <gendoc/util/TextUtils.hpp>
 #include <gendoc/util/Path.hpp>
 #include <gendoc/util/Unicode.hpp>
 #include <gendoc/util/Util.hpp>
+#include <gendoc/util/Parallel.hpp>
 #include <boost/filesystem.hpp>
 #include <algorithm>
 #include <stdexcept>
@@ -635,6 +637,7 @@ void GenerateComponentFileSection(const std::vector<gendoc::cppast::SourceFileNo
             if (projectName == componentName)
             {
                 std::unique_ptr<SourceFileNode> sourceFileNode(new SourceFileNode(Span(), parserFileContent->FilePath(), parserFileContent->RelativeFilePath(), projectName));
+                sourceFileNode->SetContent(parserFileContent->ReleaseContent());
                 componentSourceFiles.push_back(sourceFileNode.get());
                 parserSourceFileNodes.push_back(std::move(sourceFileNode));
             }
@@ -2283,89 +2286,126 @@ void GenerateFunctionDetailSection(const std::u32string& title, const std::u32st
     }
 }
 
-void GenerateContent(dom::Document* contentXml, const std::string& contentDir, const std::string& styleDirName, const std::string& styleFileName,
+void GenerateNamespaceContent(dom::Element* nsElement, dom::Document* contentXml, const std::string& contentDir, const std::string& styleDirName, 
+    const std::string& styleFileName, const std::u32string& indexLink, const std::u32string& parentLink, const std::u32string& prevLink, const std::u32string& nextLink,
     std::unordered_map<std::u32string, std::unique_ptr<gendoc::dom::Element>>& inlineCodeMap)
+{
+    std::vector<dom::Element*> functionElements;
+    std::u32string nsName = nsElement->GetAttribute(U"name");
+    std::u32string nsId = nsElement->GetAttribute(U"id");
+    std::string nsFileName = ToUtf8(nsId) + ".html";
+    std::string nsFilePath = Path::Combine(contentDir, nsFileName);
+    std::ofstream nsFile(nsFilePath);
+    CodeFormatter formatter(nsFile);
+    dom::Document nsDocument;
+    std::unique_ptr<dom::Element> htmlElement(new dom::Element(U"html"));
+    std::unique_ptr<dom::Element> headElement(new dom::Element(U"head"));
+    std::unique_ptr<dom::Element> metaElement(new dom::Element(U"meta"));
+    metaElement->SetAttribute(U"charset", U"utf-8");
+    headElement->AppendChild(std::unique_ptr<dom::Node>(metaElement.release()));
+    std::unique_ptr<dom::Element> titleElement(new dom::Element(U"title"));
+    std::u32string title;
+    if (nsName.empty())
+    {
+        title = U"Global Namespace";
+    }
+    else
+    {
+        title = MakeTitle(nsName) + U" Namespace";
+    }
+    titleElement->AppendChild(std::unique_ptr<dom::Node>(new dom::Text(title)));
+    headElement->AppendChild(std::unique_ptr<dom::Node>(titleElement.release()));
+    std::unique_ptr<dom::Element> linkElement(new dom::Element(U"link"));
+    linkElement->SetAttribute(U"rel", U"stylesheet");
+    linkElement->SetAttribute(U"type", U"text/css");
+    std::u32string relativeStyleFilePath = ToUtf32(Path::Combine(Path::Combine("..", styleDirName), styleFileName));
+    linkElement->SetAttribute(U"href", relativeStyleFilePath);
+    headElement->AppendChild(std::unique_ptr<dom::Node>(linkElement.release()));
+    htmlElement->AppendChild(std::unique_ptr<dom::Node>(headElement.release()));
+    std::unique_ptr<dom::Element> bodyElement(new dom::Element(U"body"));
+    GenerateNavigation(bodyElement.get(), Navigation::header, indexLink, parentLink, prevLink, nextLink);
+    std::unique_ptr<dom::Element> h1Element(new dom::Element(U"h1"));
+    h1Element->AppendChild(std::unique_ptr<dom::Node>(new dom::Text(title)));
+    bodyElement->AppendChild(std::unique_ptr<dom::Node>(h1Element.release()));
+    GenerateNamespaceSection(nsElement, bodyElement.get(), contentXml, std::u32string());
+    GenerateGrammarSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
+    GenerateClassSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName, inlineCodeMap);
+    GenerateFunctionSection(U"Functions", bodyElement.get(), nsElement, contentDir, styleDirName, styleFileName, contentXml, functionElements);
+    GenerateEnumSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
+    GenerateTypedefSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
+    GenerateVariableSection(U"Variables", bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
+    bodyElement->AppendChild(std::unique_ptr<dom::Node>(new dom::Element(U"hr")));
+    GenerateFunctionDetailSection(U"Function Details", U"Function", bodyElement.get(), nsElement, functionElements, contentXml, inlineCodeMap);
+    GenerateNavigation(bodyElement.get(), Navigation::footer, indexLink, parentLink, prevLink, nextLink);
+    htmlElement->AppendChild(std::unique_ptr<dom::Node>(bodyElement.release()));
+    nsDocument.AppendChild(std::unique_ptr<dom::Node>(htmlElement.release()));
+    nsDocument.Write(formatter);
+}
+
+// Generates the page of a namespace together with the pages of its classes, enumerations and grammars.
+// The pages of different namespaces share only the content document that is read but not modified, 
+// and the inline code map of which each function takes its own entry.
+
+class NamespaceContentGenerator : public ParallelWork
+{
+public:
+    NamespaceContentGenerator(const std::vector<dom::Element*>& nsElements_, dom::Document* contentXml_, const std::string& contentDir_, 
+        const std::string& styleDirName_, const std::string& styleFileName_, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap_);
+    void Run(int itemIndex, int threadIndex) override;
+private:
+    const std::vector<dom::Element*>& nsElements;
+    dom::Document* contentXml;
+    const std::string& contentDir;
+    const std::string& styleDirName;
+    const std::string& styleFileName;
+    std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap;
+};
+
+NamespaceContentGenerator::NamespaceContentGenerator(const std::vector<dom::Element*>& nsElements_, dom::Document* contentXml_, const std::string& contentDir_,
+    const std::string& styleDirName_, const std::string& styleFileName_, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap_) :
+    nsElements(nsElements_), contentXml(contentXml_), contentDir(contentDir_), styleDirName(styleDirName_), styleFileName(styleFileName_), inlineCodeMap(inlineCodeMap_)
+{
+}
+
+void NamespaceContentGenerator::Run(int itemIndex, int threadIndex)
+{
+    std::u32string indexLink = U"../index.html";
+    std::u32string parentLink = indexLink;
+    std::u32string prevLink;
+    std::u32string nextLink;
+    if (itemIndex > 0)
+    {
+        prevLink = nsElements[itemIndex - 1]->GetAttribute(U"id") + U".html";
+    }
+    if (itemIndex < int(nsElements.size()) - 1)
+    {
+        nextLink = nsElements[itemIndex + 1]->GetAttribute(U"id") + U".html";
+    }
+    GenerateNamespaceContent(nsElements[itemIndex], contentXml, contentDir, styleDirName, styleFileName, indexLink, parentLink, prevLink, nextLink, inlineCodeMap);
+}
+
+void GenerateContent(dom::Document* contentXml, const std::string& contentDir, const std::string& styleDirName, const std::string& styleFileName,
+    std::unordered_map<std::u32string, std::unique_ptr<gendoc::dom::Element>>& inlineCodeMap, int numJobs)
 {
     std::unique_ptr<xpath::XPathObject> namespaces = xpath::Evaluate(U"//namespace", contentXml);
     if (namespaces->Type() == xpath::XPathObjectType::nodeSet)
     {
         xpath::XPathNodeSet* namespaceNodeSet = static_cast<xpath::XPathNodeSet*>(namespaces.get());
-        std::u32string indexLink = U"../index.html";
-        std::u32string parentLink = indexLink;
-        std::u32string prevLink;
-        std::u32string nextLink;
+        std::vector<dom::Element*> nsElements;
         int n = namespaceNodeSet->Length();
         for (int i = 0; i < n; ++i)
         {
-            nextLink.clear();
             dom::Node* nsNode = (*namespaceNodeSet)[i];
             if (nsNode->GetNodeType() == dom::NodeType::elementNode)
             {
-                dom::Element* nsElement = static_cast<dom::Element*>(nsNode);
-                if (i < n - 1)
-                {
-                    dom::Node* nextNsNode = (*namespaceNodeSet)[i + 1];
-                    if (nextNsNode->GetNodeType() == dom::NodeType::elementNode)
-                    {
-                        dom::Element* nextNsElement = static_cast<dom::Element*>(nextNsNode);
-                        std::u32string nextNsId = nextNsElement->GetAttribute(U"id");
-                        std::string nextNsFileName = ToUtf8(nextNsId) + ".html";
-                        nextLink = ToUtf32(nextNsFileName);
-                    }
-                }
-                std::vector<dom::Element*> functionElements;
-                std::u32string nsName = nsElement->GetAttribute(U"name");
-                std::u32string nsId = nsElement->GetAttribute(U"id");
-                std::string nsFileName = ToUtf8(nsId) + ".html";
-                std::string nsFilePath = Path::Combine(contentDir, nsFileName);
-                std::ofstream nsFile(nsFilePath);
-                CodeFormatter formatter(nsFile);
-                dom::Document nsDocument;
-                std::unique_ptr<dom::Element> htmlElement(new dom::Element(U"html"));
-                std::unique_ptr<dom::Element> headElement(new dom::Element(U"head"));
-                std::unique_ptr<dom::Element> metaElement(new dom::Element(U"meta"));
-                metaElement->SetAttribute(U"charset", U"utf-8");
-                headElement->AppendChild(std::unique_ptr<dom::Node>(metaElement.release()));
-                std::unique_ptr<dom::Element> titleElement(new dom::Element(U"title"));
-                std::u32string title;
-                if (nsName.empty())
-                {
-                    title = U"Global Namespace";
-                }
-                else
-                {
-                    title = MakeTitle(nsName) + U" Namespace";
-                }
-                titleElement->AppendChild(std::unique_ptr<dom::Node>(new dom::Text(title)));
-                headElement->AppendChild(std::unique_ptr<dom::Node>(titleElement.release()));
-                std::unique_ptr<dom::Element> linkElement(new dom::Element(U"link"));
-                linkElement->SetAttribute(U"rel", U"stylesheet");
-                linkElement->SetAttribute(U"type", U"text/css");
-                std::u32string relativeStyleFilePath = ToUtf32(Path::Combine(Path::Combine("..", styleDirName), styleFileName));
-                linkElement->SetAttribute(U"href", relativeStyleFilePath);
-                headElement->AppendChild(std::unique_ptr<dom::Node>(linkElement.release()));
-                htmlElement->AppendChild(std::unique_ptr<dom::Node>(headElement.release()));
-                std::unique_ptr<dom::Element> bodyElement(new dom::Element(U"body"));
-                GenerateNavigation(bodyElement.get(), Navigation::header, indexLink, parentLink, prevLink, nextLink);
-                std::unique_ptr<dom::Element> h1Element(new dom::Element(U"h1"));
-                h1Element->AppendChild(std::unique_ptr<dom::Node>(new dom::Text(title)));
-                bodyElement->AppendChild(std::unique_ptr<dom::Node>(h1Element.release()));
-                GenerateNamespaceSection(nsElement, bodyElement.get(), contentXml, std::u32string());
-                GenerateGrammarSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
-                GenerateClassSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName, inlineCodeMap);
-                GenerateFunctionSection(U"Functions", bodyElement.get(), nsElement, contentDir, styleDirName, styleFileName, contentXml, functionElements);
-                GenerateEnumSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
-                GenerateTypedefSection(bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
-                GenerateVariableSection(U"Variables", bodyElement.get(), nsElement, contentXml, contentDir, styleDirName, styleFileName);
-                bodyElement->AppendChild(std::unique_ptr<dom::Node>(new dom::Element(U"hr")));
-                GenerateFunctionDetailSection(U"Function Details", U"Function", bodyElement.get(), nsElement, functionElements, contentXml, inlineCodeMap);
-                GenerateNavigation(bodyElement.get(), Navigation::footer, indexLink, parentLink, prevLink, nextLink);
-                htmlElement->AppendChild(std::unique_ptr<dom::Node>(bodyElement.release()));
-                nsDocument.AppendChild(std::unique_ptr<dom::Node>(htmlElement.release()));
-                nsDocument.Write(formatter);
-                prevLink = ToUtf32(nsFileName);
+                nsElements.push_back(static_cast<dom::Element*>(nsNode));
             }
         }
+        contentXml->BuildIndex();
+        int numNamespaces = int(nsElements.size());
+        int numThreads = std::max(1, std::min(numJobs, numNamespaces));
+        NamespaceContentGenerator generator(nsElements, contentXml, contentDir, styleDirName, styleFileName, inlineCodeMap);
+        ParallelFor(numNamespaces, numThreads, generator);
     }
 }
 
@@ -2461,23 +2501,59 @@ int Log10(int n)
     return log10;
 }
 
+CppToken* cppTokenGrammar = nullptr;
+
+class HtmlCodeFileGenerator : public ParallelWork
+{
+public:
+    HtmlCodeFileGenerator(const std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles_, const std::string& styleDirName_, const std::string& styleFileName_,
+        gendoc::cppsym::SymbolTable& symbolTable_, int inlineCodeLimit_, std::vector<std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>>& inlineCodeMaps_);
+    void Run(int itemIndex, int threadIndex) override;
+private:
+    const std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles;
+    const std::string& styleDirName;
+    const std::string& styleFileName;
+    gendoc::cppsym::SymbolTable& symbolTable;
+    int inlineCodeLimit;
+    std::vector<std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>>& inlineCodeMaps;
+};
+
+HtmlCodeFileGenerator::HtmlCodeFileGenerator(const std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles_, const std::string& styleDirName_, 
+    const std::string& styleFileName_, gendoc::cppsym::SymbolTable& symbolTable_, int inlineCodeLimit_, 
+    std::vector<std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>>& inlineCodeMaps_) :
+    sourceFiles(sourceFiles_), styleDirName(styleDirName_), styleFileName(styleFileName_), symbolTable(symbolTable_), inlineCodeLimit(inlineCodeLimit_), 
+    inlineCodeMaps(inlineCodeMaps_)
+{
+}
+
+void HtmlCodeFileGenerator::Run(int itemIndex, int threadIndex)
+{
+    gendoc::cppast::SourceFileNode* sourceFile = sourceFiles[itemIndex];
+    int numDigits = Log10(sourceFile->NumLines());
+    HtmlSourceCodeGenerator generator(numDigits, styleDirName, styleFileName, symbolTable, inlineCodeLimit, inlineCodeMaps[itemIndex], 
+        cppTokenGrammar);
+    sourceFile->Accept(generator);
+    generator.WriteDocument();
+}
+
 void GenerateHtmlCodeFiles(const std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles, const std::string& styleDirName, const std::string& styleFileName,
-    gendoc::cppsym::SymbolTable& symbolTable, int inlineCodeLimit, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap)
+    gendoc::cppsym::SymbolTable& symbolTable, int inlineCodeLimit, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap, int numJobs)
 {
-    for (gendoc::cppast::SourceFileNode* sourceFile : sourceFiles)
+    int numSourceFiles = int(sourceFiles.size());
+    int numThreads = std::max(1, std::min(numJobs, numSourceFiles));
+    if (!cppTokenGrammar)
     {
-        std::ifstream inputFile(sourceFile->SourceFilePath());
-        std::vector<std::u32string> inputLines;
-        std::string line;
-        while (std::getline(inputFile, line))
+        cppTokenGrammar = CppToken::Create();
+    }
+    std::vector<std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>> inlineCodeMaps(numSourceFiles);
+    HtmlCodeFileGenerator generator(sourceFiles, styleDirName, styleFileName, symbolTable, inlineCodeLimit, inlineCodeMaps);
+    ParallelFor(numSourceFiles, numThreads, generator);
+    for (std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& fileInlineCodeMap : inlineCodeMaps)
+    {
+        for (std::pair<const std::u32string, std::unique_ptr<dom::Element>>& inlineCode : fileInlineCodeMap)
         {
-            inputLines.push_back(ToUtf32(line));
+            inlineCodeMap[inlineCode.first] = std::move(inlineCode.second);
         }
-        int n = inputLines.size();
-        int numDigits = Log10(n);
-        HtmlSourceCodeGenerator generator(inputLines, numDigits, styleDirName, styleFileName, symbolTable, inlineCodeLimit, inlineCodeMap);
-        sourceFile->Accept(generator);
-        generator.WriteDocument();
     }
 }
 
@@ -2497,14 +2573,7 @@ void GenerateHtmlParserFiles(const std::vector<gendoc::cppast::SourceFileNode*>&
         std::ofstream htmlFile(htmlFilePath);
         CodeFormatter formatter(htmlFile);
         HtmlSourceCodeWriter writer;
-        std::ifstream inputFile(parserSourceFile->SourceFilePath());
-        std::vector<std::u32string> inputLines;
-        std::string line;
-        while (std::getline(inputFile, line))
-        {
-            inputLines.push_back(ToUtf32(line));
-        }
-        int n = inputLines.size();
+        int n = parserSourceFile->NumLines();
         int numDigits = Log10(n);
         dom::Document htmlParserFileDocument;
         std::unique_ptr<dom::Element> htmlElement(new dom::Element(U"html"));
@@ -2522,8 +2591,7 @@ void GenerateHtmlParserFiles(const std::vector<gendoc::cppast::SourceFileNode*>&
         headElement->AppendChild(std::unique_ptr<dom::Node>(linkElement.release()));
         htmlElement->AppendChild(std::unique_ptr<dom::Node>(headElement.release()));
         std::unique_ptr<dom::Element> bodyElement(new dom::Element(U"body"));
-        int currentSourceLineNumber = 1;
-        for (const std::u32string& inputLine : inputLines)
+        for (int currentSourceLineNumber = 1; currentSourceLineNumber <= n; ++currentSourceLineNumber)
         {
             std::unique_ptr<dom::Element> lineElement(new dom::Element(U"span"));
             lineElement->SetAttribute(U"class", U"code");
@@ -2533,10 +2601,9 @@ void GenerateHtmlParserFiles(const std::vector<gendoc::cppast::SourceFileNode*>&
             std::u32string lineNumberText = FormatNumber(currentSourceLineNumber, numDigits);
             writer.WriteLineNumber(lineNumberText);
             writer.WriteSpace(1);
-            parserTokenGrammar->Parse(inputLine.c_str(), inputLine.c_str() + inputLine.length(), 0, "", &writer);
+            parserTokenGrammar->Parse(parserSourceFile->LineStart(currentSourceLineNumber), parserSourceFile->LineEnd(currentSourceLineNumber), 0, "", &writer);
             bodyElement->AppendChild(std::unique_ptr<dom::Node>(lineElement.release()));
             bodyElement->AppendChild(std::unique_ptr<dom::Node>(new dom::Element(U"br")));
-            ++currentSourceLineNumber;
         }
         htmlElement->AppendChild(std::unique_ptr<dom::Node>(bodyElement.release()));
         htmlParserFileDocument.AppendChild(std::unique_ptr<dom::Node>(htmlElement.release()));
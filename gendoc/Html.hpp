@@ -22,9 +22,9 @@ void GenerateComponentHtml(dom::Document* inputXml, dom::Document* contentXml, c
     const std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles, const std::vector<std::unique_ptr<gendoc::syntax::ParserFileContent>>& parserFileContents,
     const std::unordered_map<int, std::u32string>& parserProjectMap, std::vector<std::unique_ptr<gendoc::cppast::SourceFileNode>>& parserSourceFileNodes);
 void GenerateContent(dom::Document* contentXml, const std::string& contentDir, const std::string& styleDirName, const std::string& styleFileName, 
-    std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap);
+    std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap, int numJobs);
 void GenerateHtmlCodeFiles(const std::vector<gendoc::cppast::SourceFileNode*>& sourceFiles, const std::string& styleDirName, const std::string& styleFileName,
-    gendoc::cppsym::SymbolTable& symbolTable, int inlineCodeLimit, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap);
+    gendoc::cppsym::SymbolTable& symbolTable, int inlineCodeLimit, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap, int numJobs);
 void GenerateHtmlParserFiles(const std::vector<gendoc::cppast::SourceFileNode*>& parserSourceFiles, const std::string& styleDirName, const std::string& styleFileName);
 
 } } // namespace gendoc::html
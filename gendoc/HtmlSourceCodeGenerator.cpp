@@ -6,7 +6,6 @@
 #include <gendoc/gendoc/HtmlSourceCodeGenerator.hpp>
 #include <gendoc/cppsym/ClassTemplateSpecializationSymbol.hpp>
 #include <gendoc/cppsym/ExternalTypeSymbol.hpp>
-#include <gendoc/cppparser/CppTokenGrammar.hpp>
 #include <gendoc/cppast/Class.hpp>
 #include <gendoc/cppast/Expression.hpp>
 #include <gendoc/cppast/TypeExpr.hpp>
@@ -25,32 +24,40 @@ using namespace gendoc::cppast;
 using namespace gendoc::util;
 using namespace gendoc::unicode;
 
-CppToken* cppTokenGrammar = nullptr;
-
-HtmlSourceCodeGenerator::HtmlSourceCodeGenerator(const std::vector<std::u32string>& inputLines_, int numDigits_,
+HtmlSourceCodeGenerator::HtmlSourceCodeGenerator(int numDigits_,
     const std::string& styleDirName_, const std::string& styleFileName_, SymbolTable& symbolTable_, int inlineCodeLimit_,
-    std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap_) :
-    symbolTable(symbolTable_), currentFunction(nullptr), invokeSymbol(nullptr), inputLines(inputLines_), numDigits(numDigits_), 
+    std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap_, CppToken* cppTokenGrammar_) :
+    symbolTable(symbolTable_), currentFunction(nullptr), invokeSymbol(nullptr), sourceFile(nullptr), numDigits(numDigits_), 
     currentSourceLineNumber(1), styleFilePath(Path::Combine(Path::Combine("../../..", styleDirName_), styleFileName_)), contentFilePath("../.."),
-    lineStarts(nullptr), firstBaseClass(false), firstParam(false), firstTemplateParameter(false), firstTemplateArgument(false),
+    formatter(htmlFile), bodyOpen(false), lineOpen(false), lineStarts(nullptr), firstBaseClass(false), firstParam(false), firstTemplateParameter(false), firstTemplateArgument(false),
     firstMemberInitializer(false), firstInitializer(false), firstEnumerator(false), rangeForDeclaration(false), blockLevel(0),
-    currentAccess(Specifier::private_), inlineCodeLimit(inlineCodeLimit_), inlineCodeOffset(0), inlineCodeMap(inlineCodeMap_), skip(false)
+    currentAccess(Specifier::private_), inlineCodeLimit(inlineCodeLimit_), inlineCodeOffset(0), inlineCodeMap(inlineCodeMap_), cppTokenGrammar(cppTokenGrammar_), skip(false)
 {
-    htmlElement.reset(new dom::Element(U"html"));
+    formatter.SetIndentSize(1);
 }
 
+// The page is written while the source file is visited: the head when the visit starts, each line of the body when the line is closed,
+// and the end of the page by WriteDocument. The text is the same as a document containing the corresponding elements would produce.
+
 void HtmlSourceCodeGenerator::WriteDocument()
 {
-    std::ofstream htmlFile(htmlFilePath);
-    CodeFormatter formatter(htmlFile);
-    formatter.SetIndentSize(1);
-    htmlElement->AppendChild(std::unique_ptr<dom::Node>(bodyElement.release()));
-    htmlSourceFileDocument.AppendChild(std::unique_ptr<dom::Node>(htmlElement.release()));
-    htmlSourceFileDocument.Write(formatter);
+    if (bodyOpen)
+    {
+        formatter.DecIndent();
+        formatter.WriteLine("</body>");
+    }
+    else
+    {
+        formatter.WriteLine("<body/>");
+    }
+    formatter.DecIndent();
+    formatter.WriteLine("</html>");
+    htmlFile.close();
 }
 
 void HtmlSourceCodeGenerator::Visit(SourceFileNode& sourceFileNode)
 {
+    sourceFile = &sourceFileNode;
     lineStarts = sourceFileNode.LineStarts();
     htmlFilePath = sourceFileNode.HtmlSourceFilePath();
     std::unique_ptr<dom::Element> headElement(new dom::Element(U"head"));
@@ -65,8 +72,11 @@ void HtmlSourceCodeGenerator::Visit(SourceFileNode& sourceFileNode)
     std::u32string relativeStyleFilePath = ToUtf32(styleFilePath);
     linkElement->SetAttribute(U"href", relativeStyleFilePath);
     headElement->AppendChild(std::unique_ptr<dom::Node>(linkElement.release()));
-    htmlElement->AppendChild(std::unique_ptr<dom::Node>(headElement.release()));
-    bodyElement.reset(new dom::Element(U"body"));
+    htmlFile.open(htmlFilePath);
+    formatter.WriteLine("<html>");
+    formatter.IncIndent();
+    headElement->Write(formatter);
+    writer.SetLineBuffer(&lineBuffer, std::string(formatter.IndentSize() * (formatter.Indent() + 1), ' '));
     sourceFileNode.GlobalNs()->Accept(*this);
     WriteRestOfInput();
 }
@@ -334,7 +344,7 @@ void HtmlSourceCodeGenerator::MoveTo(const Span& span)
     int lineNumber = span.LineNumber();
     while (lineNumber > currentSourceLineNumber)
     {
-        if (!lineElement)
+        if (!lineOpen)
         {
             UseInputLine();
         }
@@ -343,7 +353,7 @@ void HtmlSourceCodeGenerator::MoveTo(const Span& span)
             CloseLine();
         }
     }
-    if (!lineElement)
+    if (!lineOpen)
     {
         OpenLine();
     }
@@ -356,11 +366,14 @@ void HtmlSourceCodeGenerator::MoveTo(const Span& span)
 
 void HtmlSourceCodeGenerator::OpenLine()
 {
-    lineElement.reset(new dom::Element(U"span"));
-    writer.SetLineElement(lineElement.get());
-    lineElement->SetAttribute(U"class", U"code");
-    lineElement->SetAttribute(U"xml:space", U"preserve");
-    lineElement->SetAttribute(U"id", ToUtf32(std::to_string(currentSourceLineNumber)));
+    if (!bodyOpen)
+    {
+        formatter.WriteLine("<body>");
+        formatter.IncIndent();
+        bodyOpen = true;
+    }
+    lineBuffer = "<span class=\"code\" id=\"" + std::to_string(currentSourceLineNumber) + "\" xml:space=\"preserve\">";
+    lineOpen = true;
     std::u32string lineNumberText = FormatNumber(currentSourceLineNumber, numDigits);
     writer.WriteLineNumberKind(lineNumberText, WriteKind::line);
     writer.WriteSpaceKind(1, WriteKind::line);
@@ -391,8 +404,11 @@ void HtmlSourceCodeGenerator::OpenInlineLine()
 
 void HtmlSourceCodeGenerator::CloseLine()
 {
-    bodyElement->AppendChild(std::unique_ptr<dom::Node>(lineElement.release()));
-    bodyElement->AppendChild(std::unique_ptr<dom::Node>(new dom::Element(U"br")));
+    formatter.Write(lineBuffer);
+    formatter.WriteLine("</span>");
+    formatter.WriteLine("<br/>");
+    lineBuffer.clear();
+    lineOpen = false;
     if (inlineCodeElement && inlineLineElement)
     {
         inlineCodeElement->AppendChild(std::unique_ptr<dom::Node>(inlineLineElement.release()));
@@ -404,19 +420,16 @@ void HtmlSourceCodeGenerator::CloseLine()
 
 void HtmlSourceCodeGenerator::UseInputLine()
 {
-    if (!cppTokenGrammar)
-    {
-        cppTokenGrammar = CppToken::Create();
-    }
-    const std::u32string& line = inputLines[currentSourceLineNumber - 1];
+    const char32_t* lineStart = sourceFile->LineStart(currentSourceLineNumber);
+    const char32_t* lineEnd = sourceFile->LineEnd(currentSourceLineNumber);
     OpenLine();
-    cppTokenGrammar->Parse(line.c_str(), line.c_str() + line.length(), 0, "", &writer);
+    cppTokenGrammar->Parse(lineStart, lineEnd, 0, "", &writer);
     CloseLine();
 }
 
 void HtmlSourceCodeGenerator::WriteRestOfInput()
 {
-    int n = inputLines.size();
+    int n = sourceFile->NumLines();
     while (currentSourceLineNumber <= n)
     {
         UseInputLine();
@@ -7,18 +7,23 @@
 #define GENDOC_HTML_SOURCE_CODE_GENERATOR_INCLUDED
 #include <gendoc/gendoc/HtmlSourceCodeWriter.hpp>
 #include <gendoc/cppsym/SymbolTable.hpp>
+#include <gendoc/cppparser/CppTokenGrammar.hpp>
 #include <gendoc/cppast/Visitor.hpp>
 #include <gendoc/cppast/SourceFile.hpp>
+#include <gendoc/util/CodeFormatter.hpp>
+#include <fstream>
 
 namespace gendoc { namespace html {
 
 using namespace gendoc::cppsym;
+using gendoc::util::CodeFormatter;
 
 class HtmlSourceCodeGenerator : public gendoc::cppast::Visitor
 {
 public:
-    HtmlSourceCodeGenerator(const std::vector<std::u32string>& inputLines_, int numDigits_, const std::string& styleDirName_, const std::string& styleFileName_,
-        SymbolTable& symbolTable_, int inlineCodeLimit_, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap_);
+    HtmlSourceCodeGenerator(int numDigits_, const std::string& styleDirName_, const std::string& styleFileName_,
+        SymbolTable& symbolTable_, int inlineCodeLimit_, std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap_, 
+        gendoc::cppparser::CppToken* cppTokenGrammar_);
     std::u32string MakeSymbolRef(Symbol* symbol);
     std::u32string MakeInlineSymbolRef(Symbol* symbol);
     void WriteId(IdentifierNode* id, Symbol* symbol, bool writeType);
@@ -141,16 +146,17 @@ private:
     FunctionSymbol* currentFunction;
     Symbol* invokeSymbol;
     HtmlSourceCodeWriter writer;
-    const std::vector<std::u32string>& inputLines;
+    SourceFileNode* sourceFile;
     int numDigits;
     std::string styleFilePath;
     std::string contentFilePath;
     int currentSourceLineNumber;
     std::string htmlFilePath;
-    dom::Document htmlSourceFileDocument;
-    std::unique_ptr<dom::Element> htmlElement;
-    std::unique_ptr<dom::Element> bodyElement;
-    std::unique_ptr<dom::Element> lineElement;
+    std::ofstream htmlFile;
+    CodeFormatter formatter;
+    bool bodyOpen;
+    bool lineOpen;
+    std::string lineBuffer;
     std::unique_ptr<dom::Element> inlineLineElement;
     std::unique_ptr<dom::Element> inlineCodeElement;
     std::vector<std::pair<IdentifierNode*, Symbol*>> idSequence;
@@ -169,6 +175,7 @@ private:
     int inlineCodeOffset;
     bool skip;
     std::unordered_map<std::u32string, std::unique_ptr<dom::Element>>& inlineCodeMap;
+    gendoc::cppparser::CppToken* cppTokenGrammar;
 };
 
 } } // namespace gendoc::html
@@ -5,10 +5,13 @@
 
 #include <gendoc/gendoc/HtmlSourceCodeWriter.hpp>
 #include <gendoc/dom/CharacterData.hpp>
+#include <gendoc/util/Unicode.hpp>
 
 namespace gendoc { namespace html {
 
-HtmlSourceCodeWriter::HtmlSourceCodeWriter() : lineElement(nullptr), inlineLineElement(nullptr), currentPos(0), inlineCurrentPos(0)
+using namespace gendoc::unicode;
+
+HtmlSourceCodeWriter::HtmlSourceCodeWriter() : lineElement(nullptr), lineBuffer(nullptr), inlineLineElement(nullptr), currentPos(0), inlineCurrentPos(0)
 {
 }
 
@@ -27,39 +30,86 @@ void HtmlSourceCodeWriter::WriteToElement(dom::Element* element, const std::u32s
     }
 }
 
-void HtmlSourceCodeWriter::MoveTo(const Span& span)
+std::unique_ptr<dom::Element> HtmlSourceCodeWriter::MakeElement(const std::u32string& elementName, const std::u32string& attrName, const std::u32string& attrValue,
+    const std::u32string& text)
 {
-    if (currentPos < span.Start())
+    std::unique_ptr<dom::Element> element(new dom::Element(elementName));
+    element->SetAttribute(attrName, attrValue);
+    WriteToElement(element.get(), text);
+    return element;
+}
+
+// Writing to the line buffer produces the same text as writing the element made by MakeElement inside a line element:
+// an element without content is followed by a new line and the indentation of the line.
+
+void HtmlSourceCodeWriter::WriteToLine(const std::u32string& elementName, const std::u32string& attrName, const std::u32string& attrValue, const std::u32string& text)
+{
+    if (lineBuffer)
     {
-        int length = span.Start() - currentPos;
-        WriteSpaceKind(length, WriteKind::line);
+        std::u32string html;
+        html.append(1, '<').append(elementName).append(1, ' ').append(attrName).append(1, '=').append(dom::MakeXmlAttrValue(attrValue));
+        if (text.empty())
+        {
+            html.append(U"/>");
+            lineBuffer->append(ToUtf8(html)).append("\n").append(lineIndent);
+            return;
+        }
+        html.append(1, '>');
+        for (char32_t c : text)
+        {
+            switch (c)
+            {
+                case ' ': html.append(U"&nbsp;"); break;
+                case '<': html.append(U"&lt;"); break;
+                case '&': html.append(U"&amp;"); break;
+                default: html.append(1, c); break;
+            }
+        }
+        html.append(U"</").append(elementName).append(1, '>');
+        lineBuffer->append(ToUtf8(html));
     }
-    if (inlineCurrentPos < span.Start())
+    else
     {
-        int length = span.Start() - inlineCurrentPos;
-        WriteSpaceKind(length, WriteKind::inlineLine);
+        lineElement->AppendChild(std::unique_ptr<dom::Node>(MakeElement(elementName, attrName, attrValue, text).release()));
     }
 }
 
-void HtmlSourceCodeWriter::WriteLineNumberKind(const std::u32string& lineNumber, WriteKind kind)
+void HtmlSourceCodeWriter::WriteSpan(const std::u32string& className, const std::u32string& text, WriteKind kind)
 {
-    std::unique_ptr<dom::Element> lineNumberElement(new dom::Element(U"span"));
-    lineNumberElement->SetAttribute(U"class", U"lineNumber");
-    WriteToElement(lineNumberElement.get(), lineNumber);
     if ((kind & WriteKind::inlineLine) != WriteKind::none)
     {
         if (inlineLineElement)
         {
-            inlineLineElement->AppendChild(lineNumberElement->CloneNode(true));
-            inlineCurrentPos += lineNumber.length();
+            inlineLineElement->AppendChild(std::unique_ptr<dom::Node>(MakeElement(U"span", U"class", className, text).release()));
+            inlineCurrentPos += text.length();
         }
     }
     if ((kind & WriteKind::line) != WriteKind::none)
     {
-        lineElement->AppendChild(std::unique_ptr<dom::Node>(lineNumberElement.release()));
-        currentPos += lineNumber.length();
+        WriteToLine(U"span", U"class", className, text);
+        currentPos += text.length();
+    }
+}
+
+void HtmlSourceCodeWriter::MoveTo(const Span& span)
+{
+    if (currentPos < span.Start())
+    {
+        int length = span.Start() - currentPos;
+        WriteSpaceKind(length, WriteKind::line);
+    }
+    if (inlineCurrentPos < span.Start())
+    {
+        int length = span.Start() - inlineCurrentPos;
+        WriteSpaceKind(length, WriteKind::inlineLine);
     }
 }
+
+void HtmlSourceCodeWriter::WriteLineNumberKind(const std::u32string& lineNumber, WriteKind kind)
+{
+    WriteSpan(U"lineNumber", lineNumber, kind);
+}
+
 void HtmlSourceCodeWriter::WriteLineNumber(const std::u32string& lineNumber)
 {
     WriteLineNumberKind(lineNumber, WriteKind::both);
@@ -67,64 +117,30 @@ void HtmlSourceCodeWriter::WriteLineNumber(const std::u32string& lineNumber)
 
 void HtmlSourceCodeWriter::WriteComment(const std::u32string& comment)
 {
-    std::unique_ptr<dom::Element> commentElement(new dom::Element(U"span"));
-    commentElement->SetAttribute(U"class", U"comment");
-    WriteToElement(commentElement.get(), comment);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(commentElement->CloneNode(true));
-        inlineCurrentPos += comment.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(commentElement.release()));
-    currentPos += comment.length();
+    WriteSpan(U"comment", comment, WriteKind::both);
 }
 
 void HtmlSourceCodeWriter::WriteKeyword(const std::u32string& keyword)
 {
-    std::unique_ptr<dom::Element> keywordElement(new dom::Element(U"span"));
-    keywordElement->SetAttribute(U"class", U"kw");
-    WriteToElement(keywordElement.get(), keyword);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(keywordElement->CloneNode(true));
-        inlineCurrentPos += keyword.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(keywordElement.release()));
-    currentPos += keyword.length();
+    WriteSpan(U"kw", keyword, WriteKind::both);
 }
 
 void HtmlSourceCodeWriter::WriteIdentifier(const std::u32string& identifier)
 {
-    std::unique_ptr<dom::Element> identifierElement(new dom::Element(U"span"));
-    identifierElement->SetAttribute(U"class", U"identifier");
-    WriteToElement(identifierElement.get(), identifier);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(identifierElement->CloneNode(true));
-        inlineCurrentPos += identifier.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(identifierElement.release()));
-    currentPos += identifier.length();
+    WriteSpan(U"identifier", identifier, WriteKind::both);
 }
 
 void HtmlSourceCodeWriter::WriteLink(const std::u32string& identifier, const std::u32string& ref)
 {
     if (ref.empty())
     {
-        std::unique_ptr<dom::Element> identifierElement(new dom::Element(U"span"));
-        identifierElement->SetAttribute(U"class", U"identifier");
-        WriteToElement(identifierElement.get(), identifier);
-        lineElement->AppendChild(std::unique_ptr<dom::Node>(identifierElement.release()));
-        currentPos += identifier.length();
+        WriteToLine(U"span", U"class", U"identifier", identifier);
     }
     else
     {
-        std::unique_ptr<dom::Element> linkElement(new dom::Element(U"a"));
-        linkElement->SetAttribute(U"href", ref);
-        WriteToElement(linkElement.get(), identifier);
-        lineElement->AppendChild(std::unique_ptr<dom::Node>(linkElement.release()));
-        currentPos += identifier.length();
+        WriteToLine(U"a", U"href", ref, identifier);
     }
+    currentPos += identifier.length();
 }
 
 void HtmlSourceCodeWriter::WriteInlineLink(const std::u32string& identifier, const std::u32string& ref)
@@ -133,63 +149,29 @@ void HtmlSourceCodeWriter::WriteInlineLink(const std::u32string& identifier, con
     {
         if (ref.empty())
         {
-            std::unique_ptr<dom::Element> identifierElement(new dom::Element(U"span"));
-            identifierElement->SetAttribute(U"class", U"identifier");
-            WriteToElement(identifierElement.get(), identifier);
-            inlineLineElement->AppendChild(std::unique_ptr<dom::Node>(identifierElement.release()));
-            inlineCurrentPos += identifier.length();
+            inlineLineElement->AppendChild(std::unique_ptr<dom::Node>(MakeElement(U"span", U"class", U"identifier", identifier).release()));
         }
         else
         {
-            std::unique_ptr<dom::Element> linkElement(new dom::Element(U"a"));
-            linkElement->SetAttribute(U"href", ref);
-            WriteToElement(linkElement.get(), identifier);
-            inlineLineElement->AppendChild(std::unique_ptr<dom::Node>(linkElement.release()));
-            inlineCurrentPos += identifier.length();
+            inlineLineElement->AppendChild(std::unique_ptr<dom::Node>(MakeElement(U"a", U"href", ref, identifier).release()));
         }
+        inlineCurrentPos += identifier.length();
     }
 }
 
 void HtmlSourceCodeWriter::WriteType(const std::u32string& type)
 {
-    std::unique_ptr<dom::Element> typeElement(new dom::Element(U"span"));
-    typeElement->SetAttribute(U"class", U"type");
-    WriteToElement(typeElement.get(), type);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(typeElement->CloneNode(true));
-        inlineCurrentPos += type.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(typeElement.release()));
-    currentPos += type.length();
+    WriteSpan(U"type", type, WriteKind::both);
 }
 
 void HtmlSourceCodeWriter::WritePP(const std::u32string& pp)
 {
-    std::unique_ptr<dom::Element> ppElement(new dom::Element(U"span"));
-    ppElement->SetAttribute(U"class", U"pp");
-    WriteToElement(ppElement.get(), pp);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(ppElement->CloneNode(true));
-        inlineCurrentPos += pp.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(ppElement.release()));
-    currentPos += pp.length();
+    WriteSpan(U"pp", pp, WriteKind::both);
 }
 
 void HtmlSourceCodeWriter::WriteString(const std::u32string& string)
 {
-    std::unique_ptr<dom::Element> stringElement(new dom::Element(U"span"));
-    stringElement->SetAttribute(U"class", U"string");
-    WriteToElement(stringElement.get(), string);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(stringElement->CloneNode(true));
-        inlineCurrentPos += string.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(stringElement.release()));
-    currentPos += string.length();
+    WriteSpan(U"string", string, WriteKind::both);
 }
 
 void HtmlSourceCodeWriter::WriteSpaceKind(int numSpaces, WriteKind kind)
@@ -198,7 +180,14 @@ void HtmlSourceCodeWriter::WriteSpaceKind(int numSpaces, WriteKind kind)
     {
         for (int i = 0; i < numSpaces; ++i)
         {
-            lineElement->AppendChild(std::unique_ptr<dom::Node>(new dom::EntityReference(U"nbsp")));
+            if (lineBuffer)
+            {
+                lineBuffer->append("&nbsp;");
+            }
+            else
+            {
+                lineElement->AppendChild(std::unique_ptr<dom::Node>(new dom::EntityReference(U"nbsp")));
+            }
         }
         currentPos += numSpaces;
     }
@@ -222,16 +211,7 @@ void HtmlSourceCodeWriter::WriteSpace(int numSpaces)
 
 void HtmlSourceCodeWriter::WriteOther(const std::u32string& other)
 {
-    std::unique_ptr<dom::Element> otherElement(new dom::Element(U"span"));
-    otherElement->SetAttribute(U"class", U"other");
-    WriteToElement(otherElement.get(), other);
-    if (inlineLineElement)
-    {
-        inlineLineElement->AppendChild(otherElement->CloneNode(true));
-        inlineCurrentPos += other.length();
-    }
-    lineElement->AppendChild(std::unique_ptr<dom::Node>(otherElement.release()));
-    currentPos += other.length();
+    WriteSpan(U"other", other, WriteKind::both);
 }
 
 } } // namespace gendoc::html
@@ -31,11 +31,15 @@ inline WriteKind operator&(WriteKind left, WriteKind right)
     return WriteKind(uint8_t(left) & uint8_t(right));
 }
 
+// Writes the tokens of a source line as HTML span and link elements. A line goes either to a line element or, when a line buffer is set,
+// straight to the buffer as escaped UTF-8 text formatted the same way as the line element would be written. An inline line always goes to an element.
+
 class HtmlSourceCodeWriter : public gendoc::cppast::SourceCodeWriter
 {
 public:
     HtmlSourceCodeWriter();
     void SetLineElement(dom::Element* lineElement_) { lineElement = lineElement_; }
+    void SetLineBuffer(std::string* lineBuffer_, const std::string& lineIndent_) { lineBuffer = lineBuffer_; lineIndent = lineIndent_; }
     void SetInlineLineElement(dom::Element* inlineLineElement_) { inlineLineElement = inlineLineElement_; }
     void SetCurrentPos(int currentPos_) { currentPos = currentPos_; }
     void SetInlineCurrentPos(int inlineCurrentPos_) { inlineCurrentPos = inlineCurrentPos_; }
@@ -55,10 +59,16 @@ public:
     void WriteOther(const std::u32string& other) override;
 private:
     dom::Element* lineElement;
+    std::string* lineBuffer;
+    std::string lineIndent;
     dom::Element* inlineLineElement;
     int currentPos;
     int inlineCurrentPos;
     void WriteToElement(dom::Element* element, const std::u32string& text);
+    std::unique_ptr<dom::Element> MakeElement(const std::u32string& elementName, const std::u32string& attrName, const std::u32string& attrValue, 
+        const std::u32string& text);
+    void WriteToLine(const std::u32string& elementName, const std::u32string& attrName, const std::u32string& attrValue, const std::u32string& text);
+    void WriteSpan(const std::u32string& className, const std::u32string& text, WriteKind kind);
 };
 
 } } // namespace gendoc::html
@@ -71,6 +71,22 @@ std::string GetContentXmlFilePath(dom::Document* inputDoc)
     return contentXmlFilePath;
 }
 
+std::string GetBuildCacheFilePath(dom::Document* inputDoc)
+{
+    std::u32string targetDir = inputDoc->DocumentElement()->GetAttribute(U"targetDir");
+    if (targetDir.empty())
+    {
+        throw std::runtime_error("solution.targetDir is empty");
+    }
+    std::u32string solutionName = inputDoc->DocumentElement()->GetAttribute(U"name");
+    if (solutionName.empty())
+    {
+        throw std::runtime_error("solution.name is empty");
+    }
+    std::string buildCacheFilePath = Path::Combine(ToUtf8(targetDir), ToUtf8(solutionName) + ".cache.xml");
+    return buildCacheFilePath;
+}
+
 std::u32string GetSolutionDescription(dom::Document* inputDoc)
 {
     std::u32string solutionDescription = inputDoc->DocumentElement()->GetAttribute(U"description");
@@ -14,6 +14,7 @@ std::string GetTargetDir(dom::Document* inputDoc);
 std::string GetSolutionFilePath(dom::Document* inputDoc);
 std::string GetSolutionXmlFilePath(dom::Document* inputDoc);
 std::string GetContentXmlFilePath(dom::Document* inputDoc);
+std::string GetBuildCacheFilePath(dom::Document* inputDoc);
 std::u32string GetSolutionDescription(dom::Document* inputDoc);
 
 struct Tree
@@ -8,12 +8,15 @@
 #include <gendoc/gendoc/Content.hpp>
 #include <gendoc/gendoc/Html.hpp>
 #include <gendoc/gendoc/HtmlTreeDoc.hpp>
+#include <gendoc/gendoc/BuildCache.hpp>
 #include <gendoc/parsing/InitDone.hpp>
 #include <gendoc/parsing/Exception.hpp>
 #include <gendoc/xpath/InitDone.hpp>
 #include <gendoc/dom/Document.hpp>
 #include <gendoc/util/InitDone.hpp>
 #include <gendoc/util/Path.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/Parallel.hpp>
 #include <boost/filesystem.hpp>
 #include <stdexcept>
 #include <iostream>
@@ -46,7 +49,13 @@ int main(int argc, const char** argv)
     {
         bool verbose = false;
         bool force = false;
+        bool packrat = false;
+        bool dispatch = false;
+        bool fastIds = false;
+        bool loadUnicode = false;
         bool prevWasPhase = false;
+        bool prevWasJobs = false;
+        int numJobs = 1;
         std::string phase;
         std::string inputXmlFilePath;
         for (int i = 1; i < argc; ++i)
@@ -62,10 +71,30 @@ int main(int argc, const char** argv)
                 {
                     force = true;
                 }
+                else if (arg == "--packrat" || arg == "-P")
+                {
+                    packrat = true;
+                }
+                else if (arg == "--dispatch" || arg == "-D")
+                {
+                    dispatch = true;
+                }
+                else if (arg == "--fast-ids" || arg == "-I")
+                {
+                    fastIds = true;
+                }
+                else if (arg == "--load-unicode" || arg == "-U")
+                {
+                    loadUnicode = true;
+                }
                 else if (arg == "--phase" || arg == "-p")
                 {
                     prevWasPhase = true;
                 }
+                else if (arg == "--jobs" || arg == "-j")
+                {
+                    prevWasJobs = true;
+                }
                 else
                 {
                     throw std::runtime_error("unknown option '" + arg + "'");
@@ -76,6 +105,11 @@ int main(int argc, const char** argv)
                 phase = arg;
                 prevWasPhase = false;
             }
+            else if (prevWasJobs)
+            {
+                numJobs = GetNumberOfJobs(std::stoi(arg));
+                prevWasJobs = false;
+            }
             else
             {
                 if (!inputXmlFilePath.empty())
@@ -85,6 +119,14 @@ int main(int argc, const char** argv)
                 inputXmlFilePath = GetFullPath(arg);
             }
         }
+        if (fastIds)
+        {
+            gendoc::cppsym::SetSymbolIdDigest(gendoc::cppsym::SymbolIdDigest::hash128);
+        }
+        if (loadUnicode)
+        {
+            gendoc::unicode::CharacterTable::Instance().LoadAll();
+        }
         if (verbose)
         {
             std::cout << "reading '" << inputXmlFilePath << "'..." << std::endl;
@@ -101,13 +143,18 @@ int main(int argc, const char** argv)
         std::string solutionFilePath = gendoc::input::GetSolutionFilePath(inputXml.get());
         std::string solutionXmlFilePath = gendoc::input::GetSolutionXmlFilePath(inputXml.get());
         std::unique_ptr<gendoc::dom::Document> solutionXml;
-        if (!boost::filesystem::exists(solutionXmlFilePath) || force || phase == "solution")
+        gendoc::buildcache::BuildCache buildCache(gendoc::input::GetBuildCacheFilePath(inputXml.get()));
+        buildCache.Read();
+        std::vector<std::string> solutionInputFilePaths;
+        bool generateSolution = !boost::filesystem::exists(solutionXmlFilePath) || force || phase == "solution" || !buildCache.InputFilesUnchanged("solution", verbose);
+        if (generateSolution)
         {
             if (verbose)
             {
                 std::cout << "generating '" << solutionXmlFilePath << "'..." << std::endl;
             }
-            solutionXml = gendoc::solution::GenerateSolutionXml(solutionFilePath, solutionXmlFilePath, verbose);
+            solutionInputFilePaths.push_back(inputXmlFilePath);
+            solutionXml = gendoc::solution::GenerateSolutionXml(solutionFilePath, solutionXmlFilePath, verbose, solutionInputFilePaths);
         }
         else
         {
@@ -121,14 +168,18 @@ int main(int argc, const char** argv)
         std::unique_ptr<gendoc::dom::Document> contentXml;
         std::vector<std::unique_ptr<gendoc::cppast::Node>> asts;
         std::vector<gendoc::cppast::SourceFileNode*> sourceFiles;
-        if (!boost::filesystem::exists(contentXmlFilePath) || force || phase == "content" || phase == "solution")
+        std::vector<std::string> contentInputFilePaths;
+        bool generateContent = !boost::filesystem::exists(contentXmlFilePath) || force || phase == "content" || phase == "solution" || !buildCache.InputFilesUnchanged("content", verbose);
+        if (generateContent)
         {
             if (verbose)
             {
                 std::cout << "generating '" << contentXmlFilePath << "'..." << std::endl;
             }
-            contentXml = gendoc::content::GenerateContentXml(inputXml.get(), solutionXml.get(), contentXmlFilePath, verbose, symbolTable, asts, sourceFiles, 
-                parsingDomain.get(), parserFileContents, parserProjectMap);
+            contentInputFilePaths.push_back(inputXmlFilePath);
+            contentInputFilePaths.push_back(GetFullPath(solutionXmlFilePath));
+            contentXml = gendoc::content::GenerateContentXml(inputXml.get(), solutionXml.get(), contentXmlFilePath, verbose, numJobs, packrat, dispatch, symbolTable, asts, sourceFiles, 
+                parsingDomain.get(), parserFileContents, parserProjectMap, contentInputFilePaths);
         }
         else
         {
@@ -143,7 +194,7 @@ int main(int argc, const char** argv)
         std::string contentDir;
         std::string styleDir;
         gendoc::html::MakeDirectories(targetDir, htmlDir, contentDir, styleDir, sourceFiles);
-        if (!boost::filesystem::exists(contentXmlFilePath) || force || phase == "html" || phase == "content" || phase == "solution")
+        if (generateContent || phase == "html")
         {
             if (verbose)
             {
@@ -156,7 +207,7 @@ int main(int argc, const char** argv)
             {
                 std::cout << "generating html for C++ source files..." << std::endl;
             }
-            gendoc::html::GenerateHtmlCodeFiles(sourceFiles, styleDirName, styleFileName, symbolTable, inlineCodeLimit, inlineCodeMap);
+            gendoc::html::GenerateHtmlCodeFiles(sourceFiles, styleDirName, styleFileName, symbolTable, inlineCodeLimit, inlineCodeMap, numJobs);
             if (verbose)
             {
                 std::cout << "generating html reference docs..." << std::endl;
@@ -166,7 +217,7 @@ int main(int argc, const char** argv)
             gendoc::html::GenerateIndexHtml(inputXml.get(), htmlDir, styleDirName, styleFileName, componentElements, componentElementFileNameMap);
             gendoc::html::GenerateComponentHtml(inputXml.get(), contentXml.get(), contentDir, styleDirName, styleFileName, componentElements, componentElementFileNameMap,
                 sourceFiles, parserFileContents, parserProjectMap, parserSourceFileNodes);
-            gendoc::html::GenerateContent(contentXml.get(), contentDir, styleDirName, styleFileName, inlineCodeMap);
+            gendoc::html::GenerateContent(contentXml.get(), contentDir, styleDirName, styleFileName, inlineCodeMap, numJobs);
             if (verbose)
             {
                 std::cout << "generating html for parser source files..." << std::endl;
@@ -185,6 +236,22 @@ int main(int argc, const char** argv)
                 std::cout << "html generated." << std::endl;
             }
         }
+        else if (verbose)
+        {
+            std::cout << "input files not changed, skipping content and html generation." << std::endl;
+        }
+        if (generateSolution)
+        {
+            buildCache.SetInputFiles("solution", solutionInputFilePaths);
+        }
+        if (generateContent)
+        {
+            buildCache.SetInputFiles("content", contentInputFilePaths);
+        }
+        if (generateSolution || generateContent)
+        {
+            buildCache.Write();
+        }
     }
     catch (const ParsingException& ex)
     {
@@ -41,8 +41,9 @@ void ReadCmpgPRoject(const std::string& ppFilePath, std::vector<std::pair<std::s
         cmpgProjectFileGrammar = ProjectFile::Create();
     }
     MappedInputFile ppFile(ppFilePath);
-    std::u32string ppText = ToUtf32(std::string(ppFile.Begin(), ppFile.End()));
-    std::unique_ptr<gendoc::syntax::Project> cmpgProject(cmpgProjectFileGrammar->Parse(ppText.c_str(), ppText.c_str() + ppText.length(), 0, ppFilePath));
+    LazyUtf32Text ppText(ppFile.Begin(), ppFile.End());
+    gendoc::parsing::LazyTextScope lazyTextScope(&ppText);
+    std::unique_ptr<gendoc::syntax::Project> cmpgProject(cmpgProjectFileGrammar->Parse(ppText.Start(), ppText.End(), 0, ppFilePath));
     for (const std::string& parserFileName : cmpgProject->RelativeSourceFiles())
     {
         std::string parserFilePath = Path::Combine(cmpgProject->BasePath(), parserFileName);
@@ -65,15 +66,21 @@ void ReadCmpgPRoject(const std::string& ppFilePath, std::vector<std::pair<std::s
 
 gendoc::cppparser::Solution* solutionGrammar = nullptr;
 
-std::unique_ptr<dom::Document> GenerateSolutionXml(const std::string& solutionFilePath, const std::string& solutionXmlFilePath, bool verbose)
+std::unique_ptr<dom::Document> GenerateSolutionXml(const std::string& solutionFilePath, const std::string& solutionXmlFilePath, bool verbose,
+    std::vector<std::string>& inputFilePaths)
 {
     if (!solutionGrammar)
     {
         solutionGrammar = gendoc::cppparser::Solution::Create();
     }
+    inputFilePaths.push_back(GetFullPath(solutionFilePath));
     MappedInputFile solutionFile(solutionFilePath);
-    std::u32string solutionText = ToUtf32(std::string(solutionFile.Begin(), solutionFile.End()));
-    std::unique_ptr<gendoc::cppast::Solution> solution(solutionGrammar->Parse(solutionText.c_str(), solutionText.c_str() + solutionText.length(), 0, solutionFilePath));
+    LazyUtf32Text solutionText(solutionFile.Begin(), solutionFile.End());
+    std::unique_ptr<gendoc::cppast::Solution> solution;
+    {
+        gendoc::parsing::LazyTextScope lazyTextScope(&solutionText);
+        solution.reset(solutionGrammar->Parse(solutionText.Start(), solutionText.End(), 0, solutionFilePath));
+    }
     std::unique_ptr<dom::Document> solutionXml(new dom::Document());
     std::unique_ptr<dom::Element> solutionElement(new dom::Element(U"solution"));
     std::unique_ptr<dom::Element> solutionNameElement(new dom::Element(U"name"));
@@ -86,6 +93,7 @@ std::unique_ptr<dom::Document> GenerateSolutionXml(const std::string& solutionFi
         {
             std::string projectFilePath = GetFullPath(Path::Combine(solution->BasePath(), project->FilePath()));
             std::string projectBasePath = Path::GetDirectoryName(projectFilePath);
+            inputFilePaths.push_back(projectFilePath);
             std::unique_ptr<dom::Document> projectDoc = dom::ReadDocument(projectFilePath);
             std::unique_ptr<dom::Element> projectElement(new dom::Element(U"project"));
             projectElement->SetAttribute(U"id", project->Guid());
@@ -117,6 +125,7 @@ std::unique_ptr<dom::Document> GenerateSolutionXml(const std::string& solutionFi
                         {
                             std::string ppFilePath = GetFullPath(Path::Combine(projectBasePath, ToUtf8(ppFileName)));
                             ppFiles.push_back(std::make_pair(ppFilePath, ToUtf8(ppFileName)));
+                            inputFilePaths.push_back(ppFilePath);
                         }
                     }
                 }
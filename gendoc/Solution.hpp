@@ -9,7 +9,8 @@
 
 namespace gendoc { namespace solution {
 
-std::unique_ptr<gendoc::dom::Document> GenerateSolutionXml(const std::string& solutionFilePath, const std::string& solutionXmlFilePath, bool verbose);
+std::unique_ptr<gendoc::dom::Document> GenerateSolutionXml(const std::string& solutionFilePath, const std::string& solutionXmlFilePath, bool verbose,
+    std::vector<std::string>& inputFilePaths);
 std::unique_ptr<gendoc::dom::Document> ReadSolutionXml(const std::string& solutionXmlFilePath);
 
 } } // namespace gendoc::solution
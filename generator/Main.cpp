@@ -67,6 +67,7 @@ int main(int argc, const char** argv)
             std::cout << "options:\n";
             std::cout << "-L <dir1>;<dir2>;...: add <dir1>, <dir2>, ... to library reference directories" << std::endl;
             std::cout << "-F                  : force code generation" << std::endl;
+            std::cout << "-D                  : generate first-character dispatch tables for alternatives" << std::endl;
             return 1;
         }
         std::vector<std::string> projectFilePaths;
@@ -96,6 +97,10 @@ int main(int argc, const char** argv)
             {
                 gendoc::syntax::SetForceCodeGen(true);
             }
+            else if (arg == "-D")
+            {
+                gendoc::syntax::SetFirstCharDispatch(true);
+            }
             else if (prevWasL)
             {
                 prevWasL = false;
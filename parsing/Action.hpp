@@ -123,6 +123,7 @@ public:
     gendoc::codedom::CompoundStatement* FailCode() const { return failCode.get(); }
     void SetAction(ParsingAction* action_) { action = std::unique_ptr<ParsingAction>(action_); }
     void SetFailureAction(FailureAction* failureAction_) { failureAction = std::unique_ptr<FailureAction>(failureAction_); }
+    bool HasFailureAction() const { return failureAction != nullptr; }
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData) override;
     void Accept(Visitor& visitor) override;
 private:
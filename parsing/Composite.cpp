@@ -7,6 +7,7 @@
 #include <gendoc/parsing/Scanner.hpp>
 #include <gendoc/parsing/Visitor.hpp>
 #include <gendoc/parsing/Exception.hpp>
+#include <gendoc/parsing/Primitive.hpp>
 
 namespace gendoc { namespace parsing {
 
@@ -38,12 +39,36 @@ void OptionalParser::Accept(Visitor& visitor)
     visitor.EndVisit(*this);
 }
 
+// When the scanner does not skip between repetitions, a repeated character set matches the whole run of its characters at once.
+
+int ParseCharSetRun(CharSetParser* charSet, Scanner& scanner)
+{
+    const char32_t* pos = scanner.Start() + scanner.GetSpan().Start();
+    const char32_t* runEnd = charSet->SkipRun(pos, scanner.DecodedEnd());
+    while (runEnd == scanner.DecodedEnd() && runEnd != scanner.End())
+    {
+        scanner.Decode(runEnd);
+        runEnd = charSet->SkipRun(runEnd, scanner.DecodedEnd());
+    }
+    scanner.Advance(runEnd);
+    return static_cast<int>(runEnd - pos);
+}
+
 PositiveParser::PositiveParser(Parser* child_): UnaryParser(U"positive", child_, child_->Info() + U"+")
 {
 }
 
 Match PositiveParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
+    if (Child()->IsCharSetParser() && !scanner.SkipsBetweenTokens())
+    {
+        int length = ParseCharSetRun(static_cast<CharSetParser*>(Child()), scanner);
+        if (length > 0)
+        {
+            return Match(true, length);
+        }
+        return Match::Nothing();
+    }
     Match match = Child()->Parse(scanner, stack, parsingData);
     if (match.Hit())
     {
@@ -79,6 +104,10 @@ KleeneStarParser::KleeneStarParser(Parser* child_): UnaryParser(U"kleene", child
 
 Match KleeneStarParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
+    if (Child()->IsCharSetParser() && !scanner.SkipsBetweenTokens())
+    {
+        return Match(true, ParseCharSetRun(static_cast<CharSetParser*>(Child()), scanner));
+    }
     Match match = Match::Empty();
     bool first = true;
     for (;;)
@@ -135,6 +164,7 @@ Match ExpectationParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData
     }
     else
     {
+        scanner.DecodeAll();
         throw ExpectationFailure(Child()->Info(), scanner.FileName(), expectationSpan, scanner.Start(), scanner.End());
     }
 }
@@ -224,6 +254,25 @@ AlternativeParser::AlternativeParser(Parser* left_, Parser* right_): BinaryParse
 Match AlternativeParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
     Span save = scanner.GetSpan();
+    if (!dispatchTable.empty())
+    {
+        int index = endDispatchIndex;
+        if (!scanner.AtEnd())
+        {
+            char32_t c = scanner.GetChar();
+            index = c < numDispatchChars ? int(c) : nonAsciiDispatchIndex;
+        }
+        for (Parser* branch : dispatchTable[index])
+        {
+            Match match = branch->Parse(scanner, stack, parsingData);
+            if (match.Hit())
+            {
+                return match;
+            }
+            scanner.SetSpan(save);
+        }
+        return Match::Nothing();
+    }
     Match leftMatch = Left()->Parse(scanner, stack, parsingData);
     if (leftMatch.Hit())
     {
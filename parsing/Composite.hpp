@@ -6,6 +6,7 @@
 #ifndef GENDOC_PARSING_COMPOSITE_INCLUDED
 #define GENDOC_PARSING_COMPOSITE_INCLUDED
 #include <gendoc/parsing/Parser.hpp>
+#include <vector>
 
 namespace gendoc { namespace parsing {
 
@@ -89,12 +90,24 @@ public:
     void Accept(Visitor& visitor) override;
 };
 
+const int numDispatchChars = 128;
+const int nonAsciiDispatchIndex = numDispatchChars;
+const int endDispatchIndex = numDispatchChars + 1;
+const int dispatchTableSize = numDispatchChars + 2;
+
+typedef std::vector<std::vector<Parser*>> DispatchTable;
+
 class AlternativeParser : public BinaryParser
 {
 public:
     AlternativeParser(Parser* left_, Parser* right_);
+    bool IsAlternativeParser() const override { return true; }
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData) override;
     void Accept(Visitor& visitor) override;
+    bool HasDispatchTable() const { return !dispatchTable.empty(); }
+    void SetDispatchTable(DispatchTable&& dispatchTable_) { dispatchTable = std::move(dispatchTable_); }
+private:
+    DispatchTable dispatchTable;
 };
 
 class DifferenceParser : public BinaryParser
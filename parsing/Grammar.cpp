@@ -135,23 +135,16 @@ void Grammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, c
 
 Match Grammar::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
-    if (startRule)
+    Match match = Match::Nothing();
+    if (contentParser)
     {
-        if (!contentParser)
-        {
-            if (skipRule)
-            {
-                contentParser = new SequenceParser(new SequenceParser(new OptionalParser(skipRule), startRule), new OptionalParser(skipRule));
-                Own(contentParser);
-            }
-            else
-            {
-                contentParser = startRule;
-            }
-        }
-        return contentParser->Parse(scanner, stack, parsingData);
+        match = contentParser->Parse(scanner, stack, parsingData);
+    }
+    if (!match.Hit() || !scanner.AtEnd())
+    {
+        scanner.DecodeAll();
     }
-    return Match::Nothing();
+    return match;
 }
 
 void Grammar::Parse(const char32_t* start, const char32_t* end, int fileIndex, const std::string& fileName)
@@ -193,6 +186,22 @@ void Grammar::ResolveSkipRule()
     }
 }
 
+void Grammar::CreateContentParser()
+{
+    if (startRule && !contentParser)
+    {
+        if (skipRule)
+        {
+            contentParser = new SequenceParser(new SequenceParser(new OptionalParser(skipRule), startRule), new OptionalParser(skipRule));
+            Own(contentParser);
+        }
+        else
+        {
+            contentParser = startRule;
+        }
+    }
+}
+
 void Grammar::Link()
 {
     if (!linked && !linking)
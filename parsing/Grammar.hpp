@@ -54,6 +54,7 @@ public:
     void AddRuleLink(RuleLink* ruleLink);
     void ResolveStartRule();
     void ResolveSkipRule();
+    void CreateContentParser();
 private:
     ParsingDomain* parsingDomain;
     Namespace* ns;
@@ -19,6 +19,7 @@ public:
     KeywordParser(const std::u32string& keyword_, const std::u32string& continuationRuleName_);
     const std::u32string& Keyword() const { return keyword; }
     const std::u32string& ContinuationRuleName() const { return continuationRuleName; }
+    Rule* ContinuationRule() const { return continuationRule; }
     void SetContinuationRule(Rule* continuationRule_);
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData) override;
     void Accept(Visitor& visitor) override;
@@ -41,6 +42,7 @@ public:
     const std::u32string& KeywordVecName() const { return keywordVecName; }
     std::u32string& KeywordVecName() { return keywordVecName; }
     const KeywordSet& Keywords() const { return keywords; }
+    Rule* SelectorRule() const { return selectorRule; }
     void SetSelectorRule(Rule* selectorRule_) { selectorRule = selectorRule_; }
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData) override;
     void Accept(Visitor& visitor) override;
@@ -14,7 +14,12 @@
 #include <gendoc/parsing/ParsingDomain.hpp>
 #include <gendoc/parsing/Namespace.hpp>
 #include <gendoc/parsing/Primitive.hpp>
+#include <gendoc/parsing/Composite.hpp>
+#include <gendoc/parsing/Scanner.hpp>
 #include <gendoc/util/Unicode.hpp>
+#include <bitset>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace gendoc { namespace parsing {
 
@@ -43,6 +48,7 @@ void LinkerVisitor::EndVisit(Grammar& grammar)
     {
         currentGrammar->ResolveStartRule();
         currentGrammar->ResolveSkipRule();
+        currentGrammar->CreateContentParser();
     }
 }
 
@@ -181,4 +187,531 @@ void ExpandCode(ParsingDomain* parsingDomain)
     parsingDomain->GlobalNamespace()->Accept(visitor);
 }
 
+class RuleCollectorVisitor : public Visitor
+{
+public:
+    void BeginVisit(Grammar& grammar) override
+    {
+        for (Rule* rule : grammar.Rules())
+        {
+            rules.push_back(rule);
+        }
+        if (grammar.SkipRule())
+        {
+            skipRules.push_back(grammar.SkipRule());
+        }
+    }
+    const std::vector<Rule*>& Rules() const { return rules; }
+    const std::vector<Rule*>& SkipRules() const { return skipRules; }
+private:
+    std::vector<Rule*> rules;
+    std::vector<Rule*> skipRules;
+};
+
+class RuleReferenceVisitor : public Visitor
+{
+public:
+    RuleReferenceVisitor() : hasActions(false) {}
+    void BeginVisit(ActionParser& parser) override
+    {
+        hasActions = true;
+    }
+    void Visit(NonterminalParser& parser) override
+    {
+        AddReference(parser.GetRule());
+    }
+    void Visit(KeywordParser& parser) override
+    {
+        AddReference(parser.ContinuationRule());
+    }
+    void Visit(KeywordListParser& parser) override
+    {
+        AddReference(parser.SelectorRule());
+    }
+    bool HasActions() const { return hasActions; }
+    const std::vector<Rule*>& References() const { return references; }
+private:
+    bool hasActions;
+    std::vector<Rule*> references;
+    void AddReference(Rule* rule)
+    {
+        if (rule)
+        {
+            references.push_back(rule);
+        }
+    }
+};
+
+std::vector<Rule*> GetRules(ParsingDomain* parsingDomain)
+{
+    RuleCollectorVisitor collector;
+    parsingDomain->GlobalNamespace()->Accept(collector);
+    return collector.Rules();
+}
+
+// Memoizes the rules whose result depends on the input alone: rules without actions, attributes, values or locals that reference only such rules.
+// Rules with actions, among them the Expression, Declaration and Class rules of the C++ grammars, are always reparsed. Their values are AST nodes
+// owned by the enclosing rule, which cannot be cloned for a replay, and their actions read and change the ParsingContext, so a result stored
+// for an offset is not valid when the rule is tried again at that offset. The rules that qualify are mostly skip rules that are cheap to reparse,
+// so the memo table lookups can cost more than they save.
+
+std::vector<Rule*> EnableMemoization(ParsingDomain* parsingDomain)
+{
+    RuleCollectorVisitor collector;
+    parsingDomain->GlobalNamespace()->Accept(collector);
+    std::unordered_set<Rule*> pureRules;
+    std::unordered_map<Rule*, std::vector<Rule*>> references;
+    for (Rule* rule : collector.Rules())
+    {
+        if (rule->Id() == -1 || rule->Specialized() || !rule->Definition()) continue;
+        RuleReferenceVisitor visitor;
+        rule->Definition()->Accept(visitor);
+        if (visitor.HasActions()) continue;
+        pureRules.insert(rule);
+        references[rule] = visitor.References();
+    }
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (Rule* rule : collector.Rules())
+        {
+            if (pureRules.find(rule) == pureRules.cend()) continue;
+            for (Rule* referencedRule : references[rule])
+            {
+                if (pureRules.find(referencedRule) == pureRules.cend())
+                {
+                    pureRules.erase(rule);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+    std::vector<Rule*> memoizedRules;
+    for (Rule* rule : collector.Rules())
+    {
+        if (pureRules.find(rule) != pureRules.cend())
+        {
+            rule->SetMemoize(true);
+            memoizedRules.push_back(rule);
+        }
+    }
+    return memoizedRules;
+}
+
+struct FirstSet
+{
+    FirstSet() : chars(), nonAscii(false), nullable(false), opaque(false) {}
+    static FirstSet Any()
+    {
+        FirstSet any;
+        any.chars.set();
+        any.nonAscii = true;
+        any.nullable = true;
+        any.opaque = true;
+        return any;
+    }
+    void Add(char32_t c)
+    {
+        if (c < numDispatchChars)
+        {
+            chars.set(c);
+        }
+        else
+        {
+            nonAscii = true;
+        }
+    }
+    void Merge(const FirstSet& that)
+    {
+        chars |= that.chars;
+        nonAscii = nonAscii || that.nonAscii;
+        opaque = opaque || that.opaque;
+    }
+    bool Includes(int dispatchIndex) const
+    {
+        if (nullable || opaque) return true;
+        if (dispatchIndex < numDispatchChars) return chars.test(dispatchIndex);
+        if (dispatchIndex == nonAsciiDispatchIndex) return nonAscii;
+        return false;
+    }
+    bool operator==(const FirstSet& that) const { return chars == that.chars && nonAscii == that.nonAscii && nullable == that.nullable && opaque == that.opaque; }
+    bool operator!=(const FirstSet& that) const { return !(*this == that); }
+    std::bitset<numDispatchChars> chars;
+    bool nonAscii;
+    bool nullable;
+    bool opaque;
+};
+
+class FirstSetVisitor : public Visitor
+{
+public:
+    FirstSetVisitor(const std::unordered_map<Rule*, FirstSet>& ruleFirstSets_, std::unordered_map<Parser*, FirstSet>& probedFirstSets_) :
+        ruleFirstSets(ruleFirstSets_), probedFirstSets(probedFirstSets_), parserFirstSets(nullptr)
+    {
+    }
+    void SetSkipFirstSet(const FirstSet& skipFirstSet_) { skipFirstSet = skipFirstSet_; }
+    void SetParserFirstSets(std::unordered_map<Parser*, FirstSet>* parserFirstSets_) { parserFirstSets = parserFirstSets_; }
+    const std::vector<AlternativeParser*>& Alternatives() const { return alternatives; }
+    FirstSet GetFirstSet(Parser* parser)
+    {
+        parser->Accept(*this);
+        return Pop();
+    }
+    void Visit(CharParser& parser) override
+    {
+        FirstSet firstSet;
+        firstSet.Add(parser.GetChar());
+        Push(parser, firstSet);
+    }
+    void Visit(StringParser& parser) override
+    {
+        FirstSet firstSet;
+        if (parser.GetString().empty())
+        {
+            firstSet.nullable = true;
+        }
+        else
+        {
+            firstSet.Add(parser.GetString()[0]);
+        }
+        Push(parser, firstSet);
+    }
+    void Visit(CharSetParser& parser) override { Probe(parser); }
+    void Visit(EmptyParser& parser) override
+    {
+        FirstSet firstSet;
+        firstSet.nullable = true;
+        Push(parser, firstSet);
+    }
+    void Visit(SpaceParser& parser) override { Probe(parser); }
+    void Visit(LetterParser& parser) override { Probe(parser); }
+    void Visit(UpperLetterParser& parser) override { Probe(parser); }
+    void Visit(LowerLetterParser& parser) override { Probe(parser); }
+    void Visit(TitleLetterParser& parser) override { Probe(parser); }
+    void Visit(ModifierLetterParser& parser) override { Probe(parser); }
+    void Visit(OtherLetterParser& parser) override { Probe(parser); }
+    void Visit(CasedLetterParser& parser) override { Probe(parser); }
+    void Visit(DigitParser& parser) override { Probe(parser); }
+    void Visit(HexDigitParser& parser) override { Probe(parser); }
+    void Visit(MarkParser& parser) override { Probe(parser); }
+    void Visit(NonspacingMarkParser& parser) override { Probe(parser); }
+    void Visit(SpacingMarkParser& parser) override { Probe(parser); }
+    void Visit(EnclosingMarkParser& parser) override { Probe(parser); }
+    void Visit(NumberParser& parser) override { Probe(parser); }
+    void Visit(DecimalNumberParser& parser) override { Probe(parser); }
+    void Visit(LetterNumberParser& parser) override { Probe(parser); }
+    void Visit(OtherNumberParser& parser) override { Probe(parser); }
+    void Visit(PunctuationParser& parser) override { Probe(parser); }
+    void Visit(ConnectorPunctuationParser& parser) override { Probe(parser); }
+    void Visit(DashPunctuationParser& parser) override { Probe(parser); }
+    void Visit(OpenPunctuationParser& parser) override { Probe(parser); }
+    void Visit(ClosePunctuationParser& parser) override { Probe(parser); }
+    void Visit(InitialPunctuationParser& parser) override { Probe(parser); }
+    void Visit(FinalPunctuationParser& parser) override { Probe(parser); }
+    void Visit(OtherPunctuationParser& parser) override { Probe(parser); }
+    void Visit(SymbolParser& parser) override { Probe(parser); }
+    void Visit(MathSymbolParser& parser) override { Probe(parser); }
+    void Visit(CurrencySymbolParser& parser) override { Probe(parser); }
+    void Visit(ModifierSymbolParser& parser) override { Probe(parser); }
+    void Visit(OtherSymbolParser& parser) override { Probe(parser); }
+    void Visit(SeparatorParser& parser) override { Probe(parser); }
+    void Visit(SpaceSeparatorParser& parser) override { Probe(parser); }
+    void Visit(LineSeparatorParser& parser) override { Probe(parser); }
+    void Visit(ParagraphSeparatorParser& parser) override { Probe(parser); }
+    void Visit(OtherParser& parser) override { Probe(parser); }
+    void Visit(ControlParser& parser) override { Probe(parser); }
+    void Visit(FormatParser& parser) override { Probe(parser); }
+    void Visit(SurrogateParser& parser) override { Probe(parser); }
+    void Visit(PrivateUseParser& parser) override { Probe(parser); }
+    void Visit(UnassignedParser& parser) override { Probe(parser); }
+    void Visit(GraphicParser& parser) override { Probe(parser); }
+    void Visit(BaseCharParser& parser) override { Probe(parser); }
+    void Visit(AlphabeticParser& parser) override { Probe(parser); }
+    void Visit(IdStartParser& parser) override { Probe(parser); }
+    void Visit(IdContParser& parser) override { Probe(parser); }
+    void Visit(AnyCharParser& parser) override { Probe(parser); }
+    void Visit(RangeParser& parser) override
+    {
+        FirstSet firstSet;
+        for (uint32_t c = parser.Start(); c <= parser.End() && c < numDispatchChars; ++c)
+        {
+            firstSet.Add(c);
+        }
+        if (parser.End() >= numDispatchChars)
+        {
+            firstSet.nonAscii = true;
+        }
+        Push(parser, firstSet);
+    }
+    void EndVisit(OptionalParser& parser) override
+    {
+        FirstSet firstSet = Pop();
+        firstSet.nullable = true;
+        Push(parser, firstSet);
+    }
+    void EndVisit(PositiveParser& parser) override
+    {
+        Push(parser, Pop());
+    }
+    void EndVisit(KleeneStarParser& parser) override
+    {
+        FirstSet firstSet = Pop();
+        firstSet.nullable = true;
+        Push(parser, firstSet);
+    }
+    void EndVisit(ActionParser& parser) override
+    {
+        FirstSet firstSet = Pop();
+        if (firstSet.nullable || parser.HasFailureAction())
+        {
+            firstSet = FirstSet::Any();
+        }
+        Push(parser, firstSet);
+    }
+    void EndVisit(ExpectationParser& parser) override
+    {
+        Pop();
+        Push(parser, FirstSet::Any());
+    }
+    void EndVisit(TokenParser& parser) override
+    {
+        Push(parser, Pop());
+    }
+    void EndVisit(GroupingParser& parser) override
+    {
+        Push(parser, Pop());
+    }
+    void EndVisit(SequenceParser& parser) override
+    {
+        FirstSet right = Pop();
+        FirstSet left = Pop();
+        FirstSet firstSet = left;
+        if (left.nullable)
+        {
+            firstSet.Merge(skipFirstSet);
+            firstSet.Merge(right);
+            firstSet.nullable = right.nullable;
+        }
+        Push(parser, firstSet);
+    }
+    void EndVisit(AlternativeParser& parser) override
+    {
+        FirstSet right = Pop();
+        FirstSet left = Pop();
+        left.Merge(right);
+        left.nullable = left.nullable || right.nullable;
+        Push(parser, left);
+        if (parserFirstSets)
+        {
+            alternatives.push_back(&parser);
+        }
+    }
+    void EndVisit(DifferenceParser& parser) override
+    {
+        Pop();
+        Push(parser, Pop());
+    }
+    void EndVisit(ExclusiveOrParser& parser) override
+    {
+        FirstSet right = Pop();
+        FirstSet left = Pop();
+        left.Merge(right);
+        left.nullable = left.nullable || right.nullable;
+        Push(parser, left);
+    }
+    void EndVisit(IntersectionParser& parser) override
+    {
+        Pop();
+        Push(parser, Pop());
+    }
+    void EndVisit(ListParser& parser) override
+    {
+        Pop();
+        Push(parser, Pop());
+    }
+    void Visit(NonterminalParser& parser) override
+    {
+        Push(parser, GetRuleFirstSet(parser.GetRule()));
+    }
+    void Visit(KeywordParser& parser) override
+    {
+        FirstSet firstSet;
+        if (parser.Keyword().empty())
+        {
+            firstSet.nullable = true;
+        }
+        else
+        {
+            firstSet.Add(parser.Keyword()[0]);
+        }
+        Push(parser, firstSet);
+    }
+    void Visit(KeywordListParser& parser) override
+    {
+        Push(parser, GetRuleFirstSet(parser.SelectorRule()));
+    }
+private:
+    const std::unordered_map<Rule*, FirstSet>& ruleFirstSets;
+    std::unordered_map<Parser*, FirstSet>& probedFirstSets;
+    std::unordered_map<Parser*, FirstSet>* parserFirstSets;
+    std::vector<AlternativeParser*> alternatives;
+    std::vector<FirstSet> stack;
+    FirstSet skipFirstSet;
+    void Push(Parser& parser, const FirstSet& firstSet)
+    {
+        stack.push_back(firstSet);
+        if (parserFirstSets)
+        {
+            (*parserFirstSets)[&parser] = firstSet;
+        }
+    }
+    FirstSet Pop()
+    {
+        FirstSet firstSet = stack.back();
+        stack.pop_back();
+        return firstSet;
+    }
+    FirstSet GetRuleFirstSet(Rule* rule)
+    {
+        std::unordered_map<Rule*, FirstSet>::const_iterator it = ruleFirstSets.find(rule);
+        if (it != ruleFirstSets.cend())
+        {
+            return it->second;
+        }
+        return FirstSet::Any();
+    }
+    void Probe(Parser& parser)
+    {
+        std::unordered_map<Parser*, FirstSet>::const_iterator it = probedFirstSets.find(&parser);
+        if (it != probedFirstSets.cend())
+        {
+            Push(parser, it->second);
+            return;
+        }
+        FirstSet firstSet;
+        firstSet.nonAscii = true;
+        ObjectStack objectStack;
+        char32_t c = 0;
+        Scanner emptyScanner(&c, &c, "", 0, nullptr);
+        if (parser.Parse(emptyScanner, objectStack, nullptr).Hit())
+        {
+            firstSet.nullable = true;
+        }
+        for (int i = 0; i < numDispatchChars; ++i)
+        {
+            c = char32_t(i);
+            Scanner scanner(&c, &c + 1, "", 0, nullptr);
+            Match match = parser.Parse(scanner, objectStack, nullptr);
+            if (match.Hit())
+            {
+                if (match.Length() > 0)
+                {
+                    firstSet.chars.set(i);
+                }
+                else
+                {
+                    firstSet.nullable = true;
+                }
+            }
+        }
+        probedFirstSets[&parser] = firstSet;
+        Push(parser, firstSet);
+    }
+};
+
+void CollectBranches(Parser* parser, std::vector<Parser*>& branches)
+{
+    if (parser->IsAlternativeParser())
+    {
+        AlternativeParser* alternative = static_cast<AlternativeParser*>(parser);
+        CollectBranches(alternative->Left(), branches);
+        CollectBranches(alternative->Right(), branches);
+    }
+    else
+    {
+        branches.push_back(parser);
+    }
+}
+
+void CreateDispatchTables(ParsingDomain* parsingDomain)
+{
+    RuleCollectorVisitor collector;
+    parsingDomain->GlobalNamespace()->Accept(collector);
+    std::vector<Rule*> rules;
+    std::unordered_map<Rule*, FirstSet> ruleFirstSets;
+    for (Rule* rule : collector.Rules())
+    {
+        if (rule->Definition())
+        {
+            rules.push_back(rule);
+            ruleFirstSets[rule] = FirstSet();
+        }
+    }
+    std::unordered_map<Parser*, FirstSet> probedFirstSets;
+    FirstSetVisitor visitor(ruleFirstSets, probedFirstSets);
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        FirstSet skipFirstSet;
+        for (Rule* skipRule : collector.SkipRules())
+        {
+            std::unordered_map<Rule*, FirstSet>::const_iterator it = ruleFirstSets.find(skipRule);
+            skipFirstSet.Merge(it != ruleFirstSets.cend() ? it->second : FirstSet::Any());
+        }
+        skipFirstSet.opaque = false;
+        visitor.SetSkipFirstSet(skipFirstSet);
+        for (Rule* rule : rules)
+        {
+            FirstSet firstSet = visitor.GetFirstSet(rule->Definition());
+            FirstSet& ruleFirstSet = ruleFirstSets[rule];
+            if (firstSet != ruleFirstSet)
+            {
+                ruleFirstSet = firstSet;
+                changed = true;
+            }
+        }
+    }
+    std::unordered_map<Parser*, FirstSet> parserFirstSets;
+    visitor.SetParserFirstSets(&parserFirstSets);
+    for (Rule* rule : rules)
+    {
+        visitor.GetFirstSet(rule->Definition());
+    }
+    std::unordered_set<Parser*> chainedAlternatives;
+    for (AlternativeParser* alternative : visitor.Alternatives())
+    {
+        chainedAlternatives.insert(alternative->Left());
+        chainedAlternatives.insert(alternative->Right());
+    }
+    for (AlternativeParser* alternative : visitor.Alternatives())
+    {
+        if (chainedAlternatives.find(alternative) != chainedAlternatives.cend()) continue;
+        std::vector<Parser*> branches;
+        CollectBranches(alternative, branches);
+        DispatchTable dispatchTable(dispatchTableSize);
+        bool pruned = false;
+        for (int i = 0; i < dispatchTableSize; ++i)
+        {
+            for (Parser* branch : branches)
+            {
+                if (parserFirstSets[branch].Includes(i))
+                {
+                    dispatchTable[i].push_back(branch);
+                }
+                else
+                {
+                    pruned = true;
+                }
+            }
+        }
+        if (pruned)
+        {
+            alternative->SetDispatchTable(std::move(dispatchTable));
+        }
+    }
+}
+
 } } // namespace gendoc::parsing
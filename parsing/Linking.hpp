@@ -6,6 +6,7 @@
 #ifndef GENDOC_PARSING_LINKING_INCLUDED
 #define GENDOC_PARSING_LINKING_INCLUDED
 #include <gendoc/parsing/Visitor.hpp>
+#include <vector>
 
 namespace gendoc { namespace parsing {
 
@@ -33,7 +34,10 @@ private:
 };
 
 void Link(ParsingDomain* parsingDomain);
+std::vector<Rule*> GetRules(ParsingDomain* parsingDomain);
 void ExpandCode(ParsingDomain* parsingDomain);
+std::vector<Rule*> EnableMemoization(ParsingDomain* parsingDomain);
+void CreateDispatchTables(ParsingDomain* parsingDomain);
 
 } } // namespace gendoc::parsing
 
@@ -8,7 +8,11 @@
 #include <gendoc/parsing/Match.hpp>
 #include <gendoc/parsing/ParsingData.hpp>
 #include <gendoc/parsing/ParsingObject.hpp>
-#include <stack>
+#include <gendoc/util/Error.hpp>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <stddef.h>
 
 namespace gendoc { namespace parsing {
 
@@ -18,8 +22,6 @@ public:
     virtual ~Object();
 };
 
-typedef std::stack<std::unique_ptr<Object>> ObjectStack;
-
 template<typename ValueType>
 class ValueObject: public Object
 {
@@ -32,6 +34,72 @@ private:
     ValueType value;
 };
 
+const size_t inlineValueSize = 2 * sizeof(void*);
+
+struct ObjectStackSlot
+{
+    ObjectStackSlot() : object(), data() {}
+    std::unique_ptr<Object> object;
+    alignas(alignof(double)) unsigned char data[inlineValueSize];
+};
+
+template<typename ValueType>
+struct IsInlineValue
+{
+    static const bool value = std::is_trivially_copyable<ValueType>::value && sizeof(ValueType) <= inlineValueSize && alignof(ValueType) <= alignof(double);
+};
+
+template<typename ValueType, bool inlineValue>
+struct ValueSlot;
+
+template<typename ValueType>
+struct ValueSlot<ValueType, true>
+{
+    static void Store(ObjectStackSlot& slot, const ValueType& value) { new (slot.data) ValueType(value); }
+    static ValueType Load(ObjectStackSlot& slot) { return *reinterpret_cast<ValueType*>(slot.data); }
+};
+
+template<typename ValueType>
+struct ValueSlot<ValueType, false>
+{
+    static void Store(ObjectStackSlot& slot, const ValueType& value) { slot.object.reset(new ValueObject<ValueType>(value)); }
+    static ValueType Load(ObjectStackSlot& slot) { ValueType value = *static_cast<ValueObject<ValueType>*>(slot.object.get()); slot.object.reset(); return value; }
+};
+
+// Stack of rule attributes and values used by generated parsers. Pointers, bools, enums and other small trivially copyable values
+// are stored in the slot itself; other values are boxed in a ValueObject. Slots are kept when popped, so once the stack has grown to
+// its working depth pushing and popping inline values does not allocate.
+
+class ObjectStack
+{
+public:
+    ObjectStack() : count(0) {}
+    ObjectStack(const ObjectStack&) = delete;
+    ObjectStack& operator=(const ObjectStack&) = delete;
+    template<typename ValueType>
+    void Push(const ValueType& value)
+    {
+        if (count == slots.size())
+        {
+            slots.emplace_back();
+        }
+        ValueSlot<ValueType, IsInlineValue<ValueType>::value>::Store(slots[count], value);
+        ++count;
+    }
+    template<typename ValueType>
+    ValueType Pop()
+    {
+        Assert(count > 0, "object stack is empty");
+        --count;
+        return ValueSlot<ValueType, IsInlineValue<ValueType>::value>::Load(slots[count]);
+    }
+    bool Empty() const { return count == 0; }
+    size_t Count() const { return count; }
+private:
+    std::vector<ObjectStackSlot> slots;
+    size_t count;
+};
+
 class Scanner;
 
 class Parser: public ParsingObject
@@ -45,6 +113,8 @@ public:
     virtual bool IsEmptyWithAction() const { return false; }
     virtual bool IsGroupingParser() const { return false; }
     virtual bool IsGroupingWithAction() const { return false; }
+    virtual bool IsAlternativeParser() const { return false; }
+    virtual bool IsCharSetParser() const { return false; }
 private:
     std::u32string info;
 };
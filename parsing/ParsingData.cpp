@@ -4,6 +4,7 @@
 // =================================
 
 #include <gendoc/parsing/ParsingData.hpp>
+#include <gendoc/parsing/Rule.hpp>
 
 namespace gendoc { namespace parsing {
 
@@ -11,9 +12,70 @@ Context::~Context()
 {
 }
 
-ParsingData::ParsingData(int numRules)
+ContextPool::~ContextPool()
+{
+    for (void* mem : freeList)
+    {
+        ::operator delete(mem);
+    }
+}
+
+ParsingData::ParsingData(int numRules) : maxMemoEntries(defaultMaxMemoEntries)
 {
     ruleData.resize(numRules);
 }
 
+ParsingData::~ParsingData()
+{
+    for (RuleData& data : ruleData)
+    {
+        if (data.context)
+        {
+            data.contextPool.Free(data.context);
+        }
+        for (Context* context : data.contextStack)
+        {
+            if (context)
+            {
+                data.contextPool.Free(context);
+            }
+        }
+        if (data.rule)
+        {
+            data.rule->AddMemoStatistics(data.memoHits, data.memoMisses);
+            data.rule->UpdatePeakContextDepth(data.peakContextDepth);
+        }
+    }
+}
+
+inline uint64_t MemoKey(int ruleId, int start, bool inToken)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(start)) << 32) | (static_cast<uint64_t>(static_cast<uint32_t>(ruleId)) << 1) | (inToken ? 1 : 0);
+}
+
+const MemoEntry* ParsingData::GetMemo(Rule* rule, int start, bool inToken)
+{
+    int ruleId = rule->Id();
+    Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id");
+    RuleData& data = ruleData[ruleId];
+    data.rule = rule;
+    std::unordered_map<uint64_t, MemoEntry>::const_iterator it = memoTable.find(MemoKey(ruleId, start, inToken));
+    if (it != memoTable.cend())
+    {
+        ++data.memoHits;
+        return &it->second;
+    }
+    ++data.memoMisses;
+    return nullptr;
+}
+
+void ParsingData::SetMemo(Rule* rule, int start, bool inToken, const MemoEntry& entry)
+{
+    if (memoTable.size() >= maxMemoEntries)
+    {
+        memoTable.clear();
+    }
+    memoTable[MemoKey(rule->Id(), start, inToken)] = entry;
+}
+
 } } // namespace gendoc::parsing
@@ -7,53 +7,119 @@
 #define GENDOC_PARSING_PARSING_DATA_INCLUDED
 #include <gendoc/util/Error.hpp>
 #include <memory>
-#include <stack>
+#include <new>
+#include <unordered_map>
 #include <vector>
+#include <stdint.h>
 
 namespace gendoc { namespace parsing {
 
+class Rule;
+
 struct Context
 {
     virtual ~Context();
 };
 
-class ContextStack
+// Recycles the storage of a rule's contexts. All contexts of a rule have the same type, so a freed block is handed out again as is.
+
+class ContextPool
 {
 public:
-    void Push(Context* context) { stack.push(std::unique_ptr<Context>(context)); }
-    Context* Pop() { Assert(!stack.empty(), "context stack is empty"); Context* context = stack.top().release(); stack.pop(); return context; }
+    ContextPool() {}
+    ContextPool(ContextPool&&) = default;
+    ContextPool(const ContextPool&) = delete;
+    ContextPool& operator=(const ContextPool&) = delete;
+    ~ContextPool();
+    void* Allocate(size_t size)
+    {
+        if (freeList.empty())
+        {
+            return ::operator new(size);
+        }
+        void* mem = freeList.back();
+        freeList.pop_back();
+        return mem;
+    }
+    void Free(Context* context)
+    {
+        void* mem = dynamic_cast<void*>(context);
+        context->~Context();
+        freeList.push_back(mem);
+    }
 private:
-    std::stack<std::unique_ptr<Context>> stack;
+    std::vector<void*> freeList;
 };
 
 struct RuleData
 {
-    std::unique_ptr<Context> context;
-    ContextStack contextStack;
+    RuleData() : context(nullptr), peakContextDepth(0), rule(nullptr), memoHits(0), memoMisses(0) {}
+    Context* context;
+    std::vector<Context*> contextStack;
+    ContextPool contextPool;
+    int peakContextDepth;
+    Rule* rule;
+    int64_t memoHits;
+    int64_t memoMisses;
+};
+
+struct MemoEntry
+{
+    MemoEntry() : hit(false), length(-1), lineNumber(-1), start(-1), end(-1) {}
+    bool hit;
+    int length;
+    int32_t lineNumber;
+    int32_t start;
+    int32_t end;
 };
 
+const int defaultMaxMemoEntries = 1 << 20;
+
 class ParsingData
 {
 public:
     ParsingData(int numRules);
-    void PushContext(int ruleId, Context* context) 
-    { 
-        Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id"); 
-        ruleData[ruleId].contextStack.Push(ruleData[ruleId].context.release()); 
-        ruleData[ruleId].context.reset(context);
+    ~ParsingData();
+    ParsingData(const ParsingData&) = delete;
+    ParsingData& operator=(const ParsingData&) = delete;
+    template<typename ContextType>
+    ContextType* PushContext(int ruleId, Rule* rule)
+    {
+        Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id");
+        RuleData& data = ruleData[ruleId];
+        ContextType* context = new (data.contextPool.Allocate(sizeof(ContextType))) ContextType();
+        data.contextStack.push_back(data.context);
+        data.context = context;
+        data.rule = rule;
+        int depth = int(data.contextStack.size());
+        if (depth > data.peakContextDepth)
+        {
+            data.peakContextDepth = depth;
+        }
+        return context;
     }
-    void PopContext(int ruleId) 
-    { 
-        Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id"); 
-        ruleData[ruleId].context.reset(ruleData[ruleId].contextStack.Pop());  
+    void PopContext(int ruleId)
+    {
+        Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id");
+        RuleData& data = ruleData[ruleId];
+        Assert(!data.contextStack.empty(), "context stack is empty");
+        data.contextPool.Free(data.context);
+        data.context = data.contextStack.back();
+        data.contextStack.pop_back();
     }
     Context* GetContext(int ruleId) const 
     { 
         Assert(ruleId >= 0 && ruleId < ruleData.size(), "invalid rule id"); 
-        return ruleData[ruleId].context.get();  
+        return ruleData[ruleId].context;
     }
+    const MemoEntry* GetMemo(Rule* rule, int start, bool inToken);
+    void SetMemo(Rule* rule, int start, bool inToken, const MemoEntry& entry);
+    int MaxMemoEntries() const { return maxMemoEntries; }
+    void SetMaxMemoEntries(int maxMemoEntries_) { maxMemoEntries = maxMemoEntries_; }
 private:
     std::vector<RuleData> ruleData;
+    std::unordered_map<uint64_t, MemoEntry> memoTable;
+    int maxMemoEntries;
 };
 
 } } // namespace gendoc::parsing
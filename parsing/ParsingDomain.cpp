@@ -8,6 +8,7 @@
 #include <gendoc/parsing/Scope.hpp>
 #include <gendoc/parsing/Grammar.hpp>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 
 namespace gendoc { namespace parsing {
@@ -26,6 +27,7 @@ private:
     typedef std::unordered_set<std::unique_ptr<ParsingDomain>> ParsingDomainSet;
     typedef ParsingDomainSet::const_iterator ParsingDomainSetIt;
     ParsingDomainSet parsingDomains;
+    std::mutex mtx;
 };
 
 ParsingDomainRepository::ParsingDomainRepository()
@@ -34,6 +36,7 @@ ParsingDomainRepository::ParsingDomainRepository()
 
 void ParsingDomainRepository::Register(ParsingDomain* parsingDomain)
 {
+    std::lock_guard<std::mutex> lock(mtx);
     if (!parsingDomain->IsOwned())
     {
         parsingDomain->SetOwned();
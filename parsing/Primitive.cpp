@@ -8,7 +8,12 @@
 #include <gendoc/parsing/Visitor.hpp>
 #include <gendoc/parsing/Rule.hpp>
 #include <gendoc/util/Unicode.hpp>
+#include <algorithm>
 #include <cctype>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GENDOC_PARSING_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace gendoc { namespace parsing {
 
@@ -67,11 +72,13 @@ void StringParser::Accept(Visitor& visitor)
 CharSetParser::CharSetParser(const std::u32string& s_): Parser(U"charSet", U"[" + s_ + U"]"), s(s_), inverse(false) 
 { 
     InitRanges(); 
+    Compile();
 }
 
 CharSetParser::CharSetParser(const std::u32string& s_, bool inverse_): Parser(U"charSet", U"[" + s_ + U"]"), s(s_), inverse(inverse_) 
 { 
     InitRanges();
+    Compile();
 }
 
 void CharSetParser::InitRanges()
@@ -105,21 +112,109 @@ void CharSetParser::InitRanges()
     }
 }
 
-Match CharSetParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
+struct CharRangeStartLess
 {
-    if (!scanner.AtEnd())
+    bool operator()(const CharRange& left, const CharRange& right) const
     {
-        char32_t c = scanner.GetChar();
-        bool found = false;
-        for (const CharRange& range : ranges)
+        return left.start < right.start;
+    }
+    bool operator()(char32_t c, const CharRange& range) const
+    {
+        return c < range.start;
+    }
+};
+
+// Sorts and merges the ranges so that non-ASCII characters can be found by binary search,
+// and sets a bit for each ASCII character included in the ranges.
+
+void CharSetParser::Compile()
+{
+    std::vector<CharRange> merged;
+    std::sort(ranges.begin(), ranges.end(), CharRangeStartLess());
+    for (const CharRange& range : ranges)
+    {
+        if (range.start > range.end) continue;
+        if (!merged.empty() && uint64_t(range.start) <= uint64_t(merged.back().end) + 1)
         {
-            if (range.Includes(c))
+            merged.back().end = std::max(merged.back().end, range.end);
+        }
+        else
+        {
+            merged.push_back(range);
+        }
+    }
+    ranges = std::move(merged);
+    asciiBits[0] = 0;
+    asciiBits[1] = 0;
+    for (const CharRange& range : ranges)
+    {
+        if (range.start >= 128) break;
+        char32_t last = std::min(range.end, char32_t(127));
+        for (char32_t c = range.start; c <= last; ++c)
+        {
+            asciiBits[c >> 6] |= uint64_t(1) << (c & 63);
+        }
+    }
+}
+
+bool CharSetParser::IncludesNonAscii(char32_t c) const
+{
+    std::vector<CharRange>::const_iterator it = std::upper_bound(ranges.begin(), ranges.end(), c, CharRangeStartLess());
+    if (it == ranges.begin()) return false;
+    --it;
+    return it->Includes(c);
+}
+
+#ifdef GENDOC_PARSING_SSE2
+
+const int maxSimdRanges = 4;
+
+#endif
+
+// Returns a pointer to the first character in [begin, end) that does not belong to the set.
+
+const char32_t* CharSetParser::SkipRun(const char32_t* begin, const char32_t* end) const
+{
+    const char32_t* p = begin;
+#ifdef GENDOC_PARSING_SSE2
+    int n = int(ranges.size());
+    if (n <= maxSimdRanges)
+    {
+        const __m128i bias = _mm_set1_epi32(INT_MIN);
+        __m128i firsts[maxSimdRanges];
+        __m128i lasts[maxSimdRanges];
+        for (int i = 0; i < n; ++i)
+        {
+            firsts[i] = _mm_set1_epi32(int(uint32_t(ranges[i].start) ^ 0x80000000u));
+            lasts[i] = _mm_set1_epi32(int(uint32_t(ranges[i].end) ^ 0x80000000u));
+        }
+        int allMatch = inverse ? 0 : 0xFFFF;
+        while (end - p >= 4)
+        {
+            __m128i chars = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), bias);
+            __m128i outside = _mm_set1_epi32(-1);
+            for (int i = 0; i < n; ++i)
             {
-                found = true;
-                break;
+                __m128i outsideRange = _mm_or_si128(_mm_cmplt_epi32(chars, firsts[i]), _mm_cmpgt_epi32(chars, lasts[i]));
+                outside = _mm_and_si128(outside, outsideRange);
             }
+            if ((0xFFFF ^ _mm_movemask_epi8(outside)) != allMatch) break;
+            p += 4;
         }
-        if (found != inverse)
+    }
+#endif
+    while (p != end && Includes(*p))
+    {
+        ++p;
+    }
+    return p;
+}
+
+Match CharSetParser::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
+{
+    if (!scanner.AtEnd())
+    {
+        if (Includes(scanner.GetChar()))
         {
             ++scanner;
             return Match::One();
@@ -7,6 +7,7 @@
 #define GENDOC_PARSING_PRIMITIVE_INCLUDED
 #include <gendoc/parsing/Parser.hpp>
 #include <limits.h>
+#include <stdint.h>
 #include <bitset>
 
 namespace gendoc { namespace parsing {
@@ -51,13 +52,26 @@ public:
     CharSetParser(const std::u32string& s_, bool inverse_);
     const std::u32string& Set() const { return s; }
     bool Inverse() const { return inverse; }
+    bool IsCharSetParser() const override { return true; }
+    bool Includes(char32_t c) const
+    {
+        if (c < 128)
+        {
+            return (((asciiBits[c >> 6] >> (c & 63)) & 1) != 0) != inverse;
+        }
+        return IncludesNonAscii(c) != inverse;
+    }
+    const char32_t* SkipRun(const char32_t* begin, const char32_t* end) const;
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData) override;
     void Accept(Visitor& visitor) override;
 private:
     std::u32string s;
     bool inverse;
     std::vector<CharRange> ranges;
+    uint64_t asciiBits[2];
     void InitRanges();
+    void Compile();
+    bool IncludesNonAscii(char32_t c) const;
 };
 
 class EmptyParser : public Parser
@@ -29,6 +29,10 @@ AttrOrVariable::AttrOrVariable(const std::u32string& typeName_, const std::u32st
 Rule::Rule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser* definition_) :
     Parser(name_, U"<" + name_ + U">", ObjectKind::rule),
     id(id_),
+    memoize(false),
+    memoHits(0),
+    memoMisses(0),
+    peakContextDepth(0),
     grammar(nullptr),
     definition(definition_),
     inheritedAttributes(),
@@ -44,6 +48,10 @@ Rule::Rule(const std::u32string& name_, Scope* enclosingScope_, int id_, Parser*
 Rule::Rule(const std::u32string& name_, Scope* enclosingScope_, Parser* definition_) :
     Parser(name_, U"<" + name_ + U">", ObjectKind::rule),
     id(-1),
+    memoize(false),
+    memoHits(0),
+    memoMisses(0),
+    peakContextDepth(0),
     grammar(nullptr),
     definition(definition_),
     inheritedAttributes(),
@@ -59,6 +67,10 @@ Rule::Rule(const std::u32string& name_, Scope* enclosingScope_, Parser* definiti
 Rule::Rule(const std::u32string& name_, Scope* enclosingScope_) : 
     Parser(name_, U"<" + name_ + U">", ObjectKind::rule),
     id(-1),
+    memoize(false),
+    memoHits(0),
+    memoMisses(0),
+    peakContextDepth(0),
     grammar(nullptr),
     definition(),
     inheritedAttributes(),
@@ -195,9 +207,21 @@ void Rule::ExpandCode()
     }
 }
 
+void Rule::UpdatePeakContextDepth(int depth)
+{
+    int peak = peakContextDepth;
+    while (depth > peak && !peakContextDepth.compare_exchange_weak(peak, depth))
+    {
+    }
+}
+
 Match Rule::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
 {
     bool writeToLog = !scanner.Skipping() && scanner.Log();
+    if (memoize && !writeToLog && parsingData && !scanner.CountSourceLines())
+    {
+        return ParseMemoized(scanner, stack, parsingData);
+    }
     if (writeToLog)
     {
         scanner.Log()->WriteBeginRule(ToUtf8(Name()));
@@ -227,6 +251,35 @@ Match Rule::Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData
     return match;
 }
 
+Match Rule::ParseMemoized(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData)
+{
+    Span start = scanner.GetSpan();
+    bool inToken = scanner.InToken();
+    const MemoEntry* memoEntry = parsingData->GetMemo(this, start.Start(), inToken);
+    if (memoEntry)
+    {
+        if (memoEntry->hit)
+        {
+            scanner.SetSpan(Span(start.FileIndex(), memoEntry->lineNumber, memoEntry->start, memoEntry->end));
+            return Match(true, memoEntry->length);
+        }
+        return Match::Nothing();
+    }
+    Match match = definition ? definition->Parse(scanner, stack, parsingData) : Match::Nothing();
+    MemoEntry entry;
+    entry.hit = match.Hit();
+    entry.length = match.Length();
+    if (match.Hit())
+    {
+        const Span& stop = scanner.GetSpan();
+        entry.lineNumber = stop.LineNumber();
+        entry.start = stop.Start();
+        entry.end = stop.End();
+    }
+    parsingData->SetMemo(this, start.Start(), inToken, entry);
+    return match;
+}
+
 void Rule::Accept(Visitor& visitor)
 {
     visitor.BeginVisit(*this);
@@ -6,6 +6,7 @@
 #ifndef GENDOC_PARSING_RULE_INCLUDED
 #define GENDOC_PARSING_RULE_INCLUDED
 #include <gendoc/parsing/Parser.hpp>
+#include <atomic>
 
 namespace gendoc { namespace parsing {
 
@@ -57,14 +58,26 @@ public:
     virtual void Link() {}
     void ExpandCode();
     Match Parse(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData) override;
+    Match ParseMemoized(Scanner& scanner, ObjectStack& stack, ParsingData* parsingData);
     virtual void Enter(ObjectStack& stack) {}
     virtual void Leave(ObjectStack& stack, bool matched) {}
     virtual void Enter(ObjectStack& stack, ParsingData* parsingData) {}
     virtual void Leave(ObjectStack& stack, ParsingData* parsingData, bool matched) {}
     virtual void Accept(Visitor& visitor);
     int Id() const { return id; }
+    bool Memoize() const { return memoize; }
+    void SetMemoize(bool memoize_) { memoize = memoize_; }
+    int64_t MemoHits() const { return memoHits; }
+    int64_t MemoMisses() const { return memoMisses; }
+    void AddMemoStatistics(int64_t hits, int64_t misses) { memoHits += hits; memoMisses += misses; }
+    int PeakContextDepth() const { return peakContextDepth; }
+    void UpdatePeakContextDepth(int depth);
 private:
     int id;
+    bool memoize;
+    std::atomic<int64_t> memoHits;
+    std::atomic<int64_t> memoMisses;
+    std::atomic<int> peakContextDepth;
     Grammar* grammar;
     Parser* definition;
     AttrOrVariableVec inheritedAttributes;
@@ -7,6 +7,7 @@
 #include <gendoc/parsing/Parser.hpp>
 #include <gendoc/parsing/Exception.hpp>
 #include <gendoc/parsing/Rule.hpp>
+#include <gendoc/util/Unicode.hpp>
 #include <algorithm>
 #include <cctype>
 
@@ -27,26 +28,50 @@ std::u32string NarrowString(const char32_t* start, const char32_t* end)
     return s;
 }
 
-bool countSourceLines = false;;
-int numParsedSourceLines = 0;
+using gendoc::unicode::LazyUtf32Text;
 
-void SetCountSourceLines(bool count)
+thread_local LazyUtf32Text* currentLazyText = nullptr;
+
+LazyTextScope::LazyTextScope(LazyUtf32Text* text) : prevText(currentLazyText)
 {
-    countSourceLines = count;
+    currentLazyText = text;
 }
 
-int GetParsedSourceLines()
+LazyTextScope::~LazyTextScope()
 {
-    return numParsedSourceLines;
+    currentLazyText = prevText;
+}
+
+LazyUtf32Text* GetLazyText(const char32_t* start, const char32_t* end)
+{
+    LazyUtf32Text* text = currentLazyText;
+    if (text && text->Start() == start && text->End() == end)
+    {
+        return text;
+    }
+    return nullptr;
 }
 
 Scanner::Scanner(const char32_t* start_, const char32_t* end_, const std::string& fileName_, int fileIndex_, Parser* skipper_):
-    start(start_), end(end_), skipper(skipper_), skipping(false), tokenCounter(0), fileName(fileName_), span(fileIndex_),
-    log(nullptr), atBeginningOfLine(true), parsingData(nullptr)
+    start(start_), end(end_), lazyText(GetLazyText(start_, end_)), decodedEnd(lazyText ? lazyText->DecodedEnd() : end_), skipper(skipper_), skipping(false), tokenCounter(0), fileName(fileName_), span(fileIndex_),
+    log(nullptr), atBeginningOfLine(true), parsingData(nullptr), countSourceLines(false), numParsedSourceLines(0)
 {
-    if (countSourceLines)
+}
+
+void Scanner::Decode(const char32_t* pos) const
+{
+    if (lazyText)
+    {
+        decodedEnd = lazyText->Decode(pos);
+    }
+}
+
+void Scanner::DecodeAll() const
+{
+    if (lazyText)
     {
-        numParsedSourceLines = 0;
+        lazyText->DecodeAll();
+        decodedEnd = end;
     }
 }
 
@@ -69,6 +94,26 @@ void Scanner::operator++()
     }
 }
 
+void Scanner::Advance(const char32_t* to)
+{
+    if (countSourceLines)
+    {
+        while (start + span.Start() < to)
+        {
+            operator++();
+        }
+        return;
+    }
+    const char32_t* from = start + span.Start();
+    int n = static_cast<int>(to - from);
+    int numNewLines = static_cast<int>(std::count(from, to, U'\n'));
+    span = Span(span.FileIndex(), span.LineNumber() + numNewLines, span.Start() + n, span.End() + n);
+    if (numNewLines > 0)
+    {
+        atBeginningOfLine = true;
+    }
+}
+
 void Scanner::Skip()
 {
     if (tokenCounter == 0 && skipper)
@@ -89,6 +134,7 @@ void Scanner::Skip()
 
 int Scanner::LineEndIndex(int maxLineLength)
 {
+    DecodeAll();
     int lineEndIndex = span.Start();
     int contentLength = static_cast<int>(end - start);
     int end = contentLength;
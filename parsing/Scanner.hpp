@@ -12,13 +12,16 @@
 #include <vector>
 #include <stack>
 
+namespace gendoc { namespace unicode {
+
+class LazyUtf32Text;
+
+} } // namespace gendoc::unicode
+
 namespace gendoc { namespace parsing {
 
 class Rule;
 
-void SetCountSourceLines(bool count);
-int GetParsedSourceLines();
-
 class Span
 {
 public:
@@ -63,17 +66,45 @@ class Parser;
 class XmlLog;
 class ExpectationFailure;
 
+// While a scope is active, the scanners created on this thread for the text of the given LazyUtf32Text decode it on demand instead of
+// requiring it to be decoded in advance. Offsets, line numbers and the start and end pointers are the same as for fully decoded text.
+
+class LazyTextScope
+{
+public:
+    LazyTextScope(gendoc::unicode::LazyUtf32Text* text);
+    LazyTextScope(const LazyTextScope&) = delete;
+    LazyTextScope& operator=(const LazyTextScope&) = delete;
+    ~LazyTextScope();
+private:
+    gendoc::unicode::LazyUtf32Text* prevText;
+};
+
 class Scanner
 {
 public:
     Scanner(const char32_t* start_, const char32_t* end_, const std::string& fileName_, int fileIndex_, Parser* skipper_);
     const char32_t* Start() const { return start; }
     const char32_t* End() const { return end; }
-    char32_t GetChar() const { return start[span.Start()]; }
+    char32_t GetChar() const
+    {
+        const char32_t* pos = start + span.Start();
+        if (pos >= decodedEnd)
+        {
+            Decode(pos);
+        }
+        return *pos;
+    }
+    const char32_t* DecodedEnd() const { return decodedEnd; }
+    void Decode(const char32_t* pos) const;
+    void DecodeAll() const;
     void operator++();
+    void Advance(const char32_t* to);
     bool AtEnd() const { return start + span.Start() >= end; }
     void BeginToken() { ++tokenCounter; }
     void EndToken() { --tokenCounter; }
+    bool InToken() const { return tokenCounter != 0; }
+    bool SkipsBetweenTokens() const { return tokenCounter == 0 && skipper != nullptr; }
     void Skip();
     const std::string& FileName() const { return fileName; }
     const Span& GetSpan() const { return span; }
@@ -84,9 +115,15 @@ public:
     int LineEndIndex(int maxLineLength);
     std::string RestOfLine(int maxLineLength);
     void SetParsingData(ParsingData* parsingData_) { parsingData = parsingData_; }
+    ParsingData* GetParsingData() const { return parsingData; }
+    bool CountSourceLines() const { return countSourceLines; }
+    void SetCountSourceLines(bool countSourceLines_) { countSourceLines = countSourceLines_; }
+    int ParsedSourceLines() const { return numParsedSourceLines; }
 private:
     const char32_t* start;
     const char32_t* end;
+    gendoc::unicode::LazyUtf32Text* lazyText;
+    mutable const char32_t* decodedEnd;
     Parser* skipper;
     bool skipping;
     int tokenCounter;
@@ -95,6 +132,8 @@ private:
     XmlLog* log;
     bool atBeginningOfLine;
     ParsingData* parsingData;
+    bool countSourceLines;
+    int numParsedSourceLines;
 };
 
 } } // namespace gendoc::parsing
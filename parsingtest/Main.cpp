@@ -0,0 +1,223 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/xpath/XPathEvaluate.hpp>
+#include <gendoc/xpath/XPathFunction.hpp>
+#include <gendoc/xpath/InitDone.hpp>
+#include <gendoc/dom/Parser.hpp>
+#include <gendoc/parsing/InitDone.hpp>
+#include <gendoc/parsing/Exception.hpp>
+#include <gendoc/util/InitDone.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/MappedInputFile.hpp>
+#include <gendoc/util/Parallel.hpp>
+#include <gendoc/util/Path.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Stress test of the grammars that are shared between threads: each work item parses an XML document with the shared Xml grammar
+// and compiles and evaluates XPath expressions with the shared XPath grammar. The items are first run on one thread and then
+// several times on many threads, and every result must be the same as the result of the single-threaded run.
+
+using namespace gendoc::xpath;
+using namespace gendoc::dom;
+using namespace gendoc::parsing;
+using namespace gendoc::util;
+using namespace gendoc::unicode;
+
+struct InitDone
+{
+    InitDone()
+    {
+        gendoc::util::Init();
+        gendoc::parsing::Init();
+        gendoc::xpath::Init();
+    }
+    ~InitDone()
+    {
+        gendoc::xpath::Done();
+        gendoc::parsing::Done();
+        gendoc::util::Done();
+    }
+};
+
+const char32_t* queries[] =
+{
+    U"//*", U"/*/*", U"//@*", U"//text()", U"//*[@Include]", U"//*[count(*) = 0]", U"//*[count(*) > 1]", U"//*[last()]/@*",
+    U"count(//*)", U"string(/*/@*[1])", U"boolean(//*[@Condition])", U"number(count(//@*))"
+};
+
+const int numQueries = sizeof(queries) / sizeof(queries[0]);
+
+std::u32string ResultToString(XPathObject* result)
+{
+    switch (result->Type())
+    {
+        case XPathObjectType::nodeSet:
+        {
+            XPathNodeSet* nodeSet = static_cast<XPathNodeSet*>(result);
+            std::u32string s = ToUtf32(std::to_string(nodeSet->Length()));
+            for (int i = 0; i < nodeSet->Length(); ++i)
+            {
+                s.append(U"|").append(StringValue((*nodeSet)[i]));
+            }
+            return s;
+        }
+        case XPathObjectType::boolean:
+        {
+            return static_cast<XPathBoolean*>(result)->Value() ? U"true" : U"false";
+        }
+        case XPathObjectType::number:
+        {
+            return ToUtf32(std::to_string(static_cast<XPathNumber*>(result)->Value()));
+        }
+        case XPathObjectType::string:
+        {
+            return static_cast<XPathString*>(result)->Value();
+        }
+        default:
+        {
+            throw std::runtime_error("unknown XPath object type");
+        }
+    }
+}
+
+// Item i parses document i % number of documents. The position predicate makes the expression text differ from item to item,
+// so that most expressions miss the compiled expression cache and are parsed by the shared grammar.
+
+class StressWork : public ParallelWork
+{
+public:
+    StressWork(const std::vector<std::string>& filePaths_, const std::vector<std::u32string>& contents_, std::vector<std::u32string>& results_);
+    void Run(int itemIndex, int threadIndex) override;
+private:
+    const std::vector<std::string>& filePaths;
+    const std::vector<std::u32string>& contents;
+    std::vector<std::u32string>& results;
+};
+
+StressWork::StressWork(const std::vector<std::string>& filePaths_, const std::vector<std::u32string>& contents_, std::vector<std::u32string>& results_) :
+    filePaths(filePaths_), contents(contents_), results(results_)
+{
+}
+
+void StressWork::Run(int itemIndex, int threadIndex)
+{
+    int documentIndex = itemIndex % static_cast<int>(contents.size());
+    std::unique_ptr<Document> document = ParseDocument(contents[documentIndex], filePaths[documentIndex]);
+    std::u32string result;
+    for (int i = 0; i < numQueries; ++i)
+    {
+        std::u32string query = queries[i];
+        if (query.find(U'(') == std::u32string::npos)
+        {
+            query = U"(" + query + U")[position() <= " + ToUtf32(std::to_string(itemIndex + 1)) + U"]";
+        }
+        std::unique_ptr<XPathObject> queryResult = Evaluate(query, document.get());
+        result.append(query).append(U"=").append(ResultToString(queryResult.get())).append(U"\n");
+    }
+    results[itemIndex] = result;
+}
+
+int main(int argc, const char** argv)
+{
+    InitDone initDone;
+    try
+    {
+        int numThreads = 8;
+        int numItems = 400;
+        int numRounds = 5;
+        bool prevWasThreads = false;
+        bool prevWasItems = false;
+        std::vector<std::string> filePaths;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (prevWasThreads)
+            {
+                numThreads = std::stoi(arg);
+                prevWasThreads = false;
+            }
+            else if (prevWasItems)
+            {
+                numItems = std::stoi(arg);
+                prevWasItems = false;
+            }
+            else if (arg == "--threads" || arg == "-t")
+            {
+                prevWasThreads = true;
+            }
+            else if (arg == "--items" || arg == "-n")
+            {
+                prevWasItems = true;
+            }
+            else if (!arg.empty() && arg[0] == '-')
+            {
+                throw std::runtime_error("unknown option '" + arg + "'");
+            }
+            else
+            {
+                filePaths.push_back(GetFullPath(arg));
+            }
+        }
+        if (filePaths.empty() || numThreads < 1 || numItems < 1)
+        {
+            std::cout << "usage: parsingtest [options] <xml file>..." << std::endl;
+            std::cout << "Parses the XML files and evaluates XPath expressions against them from many threads using the shared grammars, " <<
+                "and checks that the results are the same as those of a single-threaded run." << std::endl;
+            std::cout << "options:" << std::endl;
+            std::cout << "--threads N | -t N: use N threads (default 8)" << std::endl;
+            std::cout << "--items N | -n N: run N work items in each round (default 400)" << std::endl;
+            return 1;
+        }
+        std::vector<std::u32string> contents;
+        for (const std::string& filePath : filePaths)
+        {
+            contents.push_back(ToUtf32(ReadFile(filePath)));
+        }
+        std::vector<std::u32string> expected(numItems);
+        StressWork singleThreadWork(filePaths, contents, expected);
+        ParallelFor(numItems, 1, singleThreadWork);
+        int numFailed = 0;
+        for (int round = 0; round < numRounds; ++round)
+        {
+            std::vector<std::u32string> results(numItems);
+            StressWork work(filePaths, contents, results);
+            ParallelFor(numItems, numThreads, work);
+            int roundFailed = 0;
+            for (int i = 0; i < numItems; ++i)
+            {
+                if (results[i] != expected[i])
+                {
+                    if (roundFailed == 0)
+                    {
+                        std::cout << "round " << round << ": item " << i << " differs from the single-threaded result" << std::endl;
+                    }
+                    ++roundFailed;
+                }
+            }
+            std::cout << "round " << round << ": " << numItems << " items on " << numThreads << " threads, " << roundFailed << " differ" << std::endl;
+            numFailed += roundFailed;
+        }
+        if (numFailed > 0)
+        {
+            return 1;
+        }
+        std::cout << "all rounds same" << std::endl;
+    }
+    catch (const ParsingException& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
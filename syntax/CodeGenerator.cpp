@@ -95,6 +95,13 @@ void SetForceCodeGen(bool force)
     forceCodeGen = force;
 }
 
+bool firstCharDispatch = false;
+
+void SetFirstCharDispatch(bool dispatch)
+{
+    firstCharDispatch = dispatch;
+}
+
 void GenerateCode(ParserFileContent* parserFile)
 {
     const std::string& filePath = parserFile->FilePath();
@@ -134,6 +141,10 @@ void GenerateCode(ParserFileContent* parserFile)
     cppFormatter.WriteLine("#include <gendoc/parsing/Exception.hpp>");
     cppFormatter.WriteLine("#include <gendoc/parsing/StdLib.hpp>");
     cppFormatter.WriteLine("#include <gendoc/parsing/XmlLog.hpp>");
+    if (firstCharDispatch)
+    {
+        cppFormatter.WriteLine("#include <gendoc/parsing/Linking.hpp>");
+    }
     cppFormatter.WriteLine("#include <gendoc/util/Unicode.hpp>");
 
     int n = int(parserFile->IncludeDirectives().size());
@@ -210,7 +221,7 @@ void GenerateCode(ParserFileContent* parserFile)
             for (int i = 0; i < n; ++i)
             {
                 Grammar* grammar = content.Grammars()[i];
-                CodeGeneratorVisitor visitor(cppFormatter, hppFormatter);
+                CodeGeneratorVisitor visitor(cppFormatter, hppFormatter, firstCharDispatch);
                 grammar->Accept(visitor);
             }
         }
@@ -11,6 +11,7 @@
 namespace gendoc { namespace syntax {
 
 void SetForceCodeGen(bool force);
+void SetFirstCharDispatch(bool dispatch);
 void GenerateCode(const std::vector<std::unique_ptr<ParserFileContent>>& parserFiles);
 
 } } // namespace gendoc::syntax
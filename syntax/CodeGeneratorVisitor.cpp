@@ -49,8 +49,8 @@ private:
     int keywordRuleListNumber;
 };
 
-CodeGeneratorVisitor::CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_): 
-    cppFormatter(cppFormatter_), hppFormatter(hppFormatter_)
+CodeGeneratorVisitor::CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_, bool firstCharDispatch_): 
+    cppFormatter(cppFormatter_), hppFormatter(hppFormatter_), firstCharDispatch(firstCharDispatch_)
 {
 }
 
@@ -88,7 +88,16 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
     cppFormatter.WriteLine(grammarPtrType + " " + ToUtf8(grammar.Name()) + "::Create()");
     cppFormatter.WriteLine("{");
     cppFormatter.IncIndent();
-    cppFormatter.WriteLine("return Create(new gendoc::parsing::ParsingDomain());");
+    if (firstCharDispatch)
+    {
+        cppFormatter.WriteLine(grammarPtrType + " grammar = Create(new gendoc::parsing::ParsingDomain());");
+        cppFormatter.WriteLine("gendoc::parsing::CreateDispatchTables(grammar->GetParsingDomain());");
+        cppFormatter.WriteLine("return grammar;");
+    }
+    else
+    {
+        cppFormatter.WriteLine("return Create(new gendoc::parsing::ParsingDomain());");
+    }
     cppFormatter.DecIndent();
     cppFormatter.WriteLine("}");
     cppFormatter.NewLine();
@@ -149,7 +158,7 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
             for (int i = 0; i < n; ++i)
             {
                 const AttrOrVariable& attr = grammar.StartRule()->InheritedAttributes()[i];
-                cppFormatter.WriteLine("stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<" + ToUtf8(attr.TypeName()) + ">(" + ToUtf8(attr.Name()) + ")));");
+                cppFormatter.WriteLine("stack.Push<" + ToUtf8(attr.TypeName()) + ">(" + ToUtf8(attr.Name()) + ");");
             }
 
             cppFormatter.WriteLine("gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());");
@@ -180,9 +189,7 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
 
             if (valueTypeName != "void")
             {
-                cppFormatter.WriteLine("std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());");
-                cppFormatter.WriteLine(valueTypeName + " result = *static_cast<gendoc::parsing::ValueObject<" + valueTypeName + ">*>(value.get());");
-                cppFormatter.WriteLine("stack.pop();");
+                cppFormatter.WriteLine(valueTypeName + " result = stack.Pop<" + valueTypeName + ">();");
                 cppFormatter.WriteLine("return result;");
             }
             cppFormatter.DecIndent();
@@ -230,15 +237,19 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
             cppFormatter.WriteLine("void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override");
             cppFormatter.WriteLine("{");
             cppFormatter.IncIndent();
-            cppFormatter.WriteLine("parsingData->PushContext(Id(), new Context());");
-            cppFormatter.WriteLine("Context* context = static_cast<Context*>(parsingData->GetContext(Id()));");
             m = int(rule->InheritedAttributes().size());
+            if (m > 0)
+            {
+                cppFormatter.WriteLine("Context* context = parsingData->PushContext<Context>(Id(), this);");
+            }
+            else
+            {
+                cppFormatter.WriteLine("parsingData->PushContext<Context>(Id(), this);");
+            }
             for (int i = m - 1; i >= 0; --i)
             {
                 const AttrOrVariable& attr = rule->InheritedAttributes()[i];
-                cppFormatter.WriteLine("std::unique_ptr<gendoc::parsing::Object> " + ToUtf8(attr.Name()) + "_value = std::move(stack.top());");
-                cppFormatter.WriteLine("context->" + ToUtf8(attr.Name()) + " = *static_cast<gendoc::parsing::ValueObject<" + ToUtf8(attr.TypeName()) + ">*>(" + ToUtf8(attr.Name()) + "_value.get());");
-                cppFormatter.WriteLine("stack.pop();");
+                cppFormatter.WriteLine("context->" + ToUtf8(attr.Name()) + " = stack.Pop<" + ToUtf8(attr.TypeName()) + ">();");
             }
             cppFormatter.DecIndent();
             cppFormatter.WriteLine("}");
@@ -252,7 +263,7 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
                 cppFormatter.WriteLine("if (matched)");
                 cppFormatter.WriteLine("{");
                 cppFormatter.IncIndent();
-                cppFormatter.WriteLine("stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<" + ToUtf8(rule->ValueTypeName()) + ">(context->value)));");
+                cppFormatter.WriteLine("stack.Push<" + ToUtf8(rule->ValueTypeName()) + ">(context->value);");
                 cppFormatter.DecIndent();
                 cppFormatter.WriteLine("}");
             }
@@ -336,9 +347,9 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
                         {
                             gendoc::codedom::CppObject* argument = nonterminal->Arguments()[j];
                             std::string argumentTypeName = ToUtf8(nonterminal->GetRule()->InheritedAttributes()[j].TypeName());
-                            cppFormatter.Write("stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<" + argumentTypeName + ">(");
+                            cppFormatter.Write("stack.Push<" + argumentTypeName + ">(");
                             argument->Print(cppFormatter);
-                            cppFormatter.WriteLine(")));");
+                            cppFormatter.WriteLine(");");
                         }
                         cppFormatter.DecIndent();
                         cppFormatter.WriteLine("}");
@@ -352,10 +363,7 @@ void CodeGeneratorVisitor::BeginVisit(Grammar& grammar)
                         cppFormatter.WriteLine("if (matched)");
                         cppFormatter.WriteLine("{");
                         cppFormatter.IncIndent();
-                        cppFormatter.WriteLine("std::unique_ptr<gendoc::parsing::Object> " + ToUtf8(nonterminal->ValueFieldName()) + "_value = std::move(stack.top());");
-                        cppFormatter.WriteLine("context->" + ToUtf8(nonterminal->ValueFieldName()) + " = *static_cast<gendoc::parsing::ValueObject<" + 
-                            ToUtf8(nonterminal->GetRule()->ValueTypeName()) + ">*>(" + ToUtf8(nonterminal->ValueFieldName()) + "_value.get());");
-                        cppFormatter.WriteLine("stack.pop();");
+                        cppFormatter.WriteLine("context->" + ToUtf8(nonterminal->ValueFieldName()) + " = stack.Pop<" + ToUtf8(nonterminal->GetRule()->ValueTypeName()) + ">();");
                         cppFormatter.DecIndent();
                         cppFormatter.WriteLine("}");
                         cppFormatter.DecIndent();
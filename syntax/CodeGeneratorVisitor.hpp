@@ -20,7 +20,7 @@ using namespace gendoc::parsing;
 class CodeGeneratorVisitor : public gendoc::parsing::Visitor
 {
 public:
-    CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_);
+    CodeGeneratorVisitor(CodeFormatter& cppFormatter_, CodeFormatter& hppFormatter_, bool firstCharDispatch_);
     void BeginVisit(Grammar& grammar) override;
     void EndVisit(Grammar& grammar) override;
     void Visit(CharParser& parser) override;
@@ -116,6 +116,7 @@ public:
 private:
     CodeFormatter& cppFormatter;
     CodeFormatter& hppFormatter;
+    bool firstCharDispatch;
     std::string CharSetStr();
 };
 
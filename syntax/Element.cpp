@@ -111,7 +111,7 @@ void Element::Parse(const char32_t* start, const char32_t* end, int fileIndex, c
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<gendoc::parsing::Grammar*>(grammar)));
+    stack.Push<gendoc::parsing::Grammar*>(grammar);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -141,11 +141,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->grammar = stack.Pop<gendoc::parsing::Grammar*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -183,9 +180,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromaliasName_value = std::move(stack.top());
-            context->fromaliasName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromaliasName_value.get());
-            stack.pop();
+            context->fromaliasName = stack.Pop<std::u32string>();
         }
     }
     void PostruleName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -193,9 +188,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromruleName_value = std::move(stack.top());
-            context->fromruleName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromruleName_value.get());
-            stack.pop();
+            context->fromruleName = stack.Pop<std::u32string>();
         }
     }
     void Postqualified_id(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -203,9 +196,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromqualified_id_value = std::move(stack.top());
-            context->fromqualified_id = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromqualified_id_value.get());
-            stack.pop();
+            context->fromqualified_id = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -229,11 +220,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->rule = stack.Pop<gendoc::parsing::Rule*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -249,12 +237,12 @@ public:
     void PreParameterList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->rule)));
+        stack.Push<gendoc::parsing::Rule*>(context->rule);
     }
     void PreReturnType(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->rule)));
+        stack.Push<gendoc::parsing::Rule*>(context->rule);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -274,11 +262,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->rule = stack.Pop<gendoc::parsing::Rule*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -294,12 +279,12 @@ public:
     void PreVariable(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->rule)));
+        stack.Push<gendoc::parsing::Rule*>(context->rule);
     }
     void PreParameter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->rule)));
+        stack.Push<gendoc::parsing::Rule*>(context->rule);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -319,11 +304,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->rule = stack.Pop<gendoc::parsing::Rule*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -349,9 +331,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -359,9 +339,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -384,11 +362,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->rule = stack.Pop<gendoc::parsing::Rule*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -414,9 +389,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
     void PostDeclarator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -424,9 +397,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDeclarator_value = std::move(stack.top());
-            context->fromDeclarator = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromDeclarator_value.get());
-            stack.pop();
+            context->fromDeclarator = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -449,11 +420,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->rule = stack.Pop<gendoc::parsing::Rule*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -477,9 +445,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTypeId_value = std::move(stack.top());
-            context->fromTypeId = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::TypeId*>*>(fromTypeId_value.get());
-            stack.pop();
+            context->fromTypeId = stack.Pop<gendoc::codedom::TypeId*>();
         }
     }
 private:
@@ -501,15 +467,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -530,9 +495,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromidentifier_value = std::move(stack.top());
-            context->fromidentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromidentifier_value.get());
-            stack.pop();
+            context->fromidentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -554,15 +517,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -585,9 +547,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromfirst_value = std::move(stack.top());
-            context->fromfirst = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromfirst_value.get());
-            stack.pop();
+            context->fromfirst = stack.Pop<std::u32string>();
         }
     }
     void Postrest(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -595,9 +555,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromrest_value = std::move(stack.top());
-            context->fromrest = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromrest_value.get());
-            stack.pop();
+            context->fromrest = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -620,11 +578,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> array_value = std::move(stack.top());
-        context->array = *static_cast<gendoc::parsing::ValueObject<std::vector<std::u32string>*>*>(array_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->array = stack.Pop<std::vector<std::u32string>*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -647,9 +602,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromstr_value = std::move(stack.top());
-            context->fromstr = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromstr_value.get());
-            stack.pop();
+            context->fromstr = stack.Pop<std::u32string>();
         }
     }
 private:
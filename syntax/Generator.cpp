@@ -54,8 +54,13 @@ void Generate(const std::string& projectFilePath, const std::vector<std::string>
     ProjectFile* projectFileGrammar = ProjectFile::Create(projectParsingDomain.get());
     LibraryFile* libraryFileGrammar = LibraryFile::Create(projectParsingDomain.get());
     ParserFile* parserFileGrammar = ParserFile::Create(projectParsingDomain.get());
-    std::u32string projectFileContent = ToUtf32(ReadFile(projectFilePath));
-    std::unique_ptr<Project> project(projectFileGrammar->Parse(&projectFileContent[0], &projectFileContent[0] + projectFileContent.length(), 0, projectFilePath));
+    MappedInputFile projectFile(projectFilePath);
+    LazyUtf32Text projectFileContent(projectFile.Begin(), projectFile.End());
+    std::unique_ptr<Project> project;
+    {
+        gendoc::parsing::LazyTextScope lazyTextScope(&projectFileContent);
+        project.reset(projectFileGrammar->Parse(projectFileContent.Start(), projectFileContent.End(), 0, projectFilePath));
+    }
     std::cout << "Compiling project '" << project->Name() << "'...\n";
     std::unique_ptr<gendoc::parsing::ParsingDomain> parsingDomain(new gendoc::parsing::ParsingDomain());
     parsingDomain->SetOwned();
@@ -67,8 +72,10 @@ void Generate(const std::string& projectFilePath, const std::vector<std::string>
         std::string relativeReferenceFilePath = referenceFiles[i];
         std::string referenceFilePath = ResolveReferenceFilePath(relativeReferenceFilePath, project->BasePath(), libraryDirectories);
         std::cout << "> " << referenceFilePath << "\n";
-        std::u32string libraryFileContent = ToUtf32(ReadFile(referenceFilePath));
-        libraryFileGrammar->Parse(&libraryFileContent[0], &libraryFileContent[0] + libraryFileContent.length(), i, referenceFilePath, parsingDomain.get());
+        MappedInputFile libraryFile(referenceFilePath);
+        LazyUtf32Text libraryFileContent(libraryFile.Begin(), libraryFile.End());
+        gendoc::parsing::LazyTextScope lazyTextScope(&libraryFileContent);
+        libraryFileGrammar->Parse(libraryFileContent.Start(), libraryFileContent.End(), i, referenceFilePath, parsingDomain.get());
     }
     std::cout << "Parsing source files...\n";
     std::vector<std::unique_ptr<ParserFileContent>> parserFiles;
@@ -79,8 +86,10 @@ void Generate(const std::string& projectFilePath, const std::vector<std::string>
     {
         std::string sourceFilePath = sourceFiles[i];
         std::cout << "> " << sourceFilePath << "\n";
-        std::u32string sourceFileContent = ToUtf32(ReadFile(sourceFilePath));
-        std::unique_ptr<ParserFileContent> parserFileContent(parserFileGrammar->Parse(&sourceFileContent[0], &sourceFileContent[0] + sourceFileContent.length(), i, sourceFilePath, i, parsingDomain.get()));
+        MappedInputFile sourceFile(sourceFilePath);
+        LazyUtf32Text sourceFileContent(sourceFile.Begin(), sourceFile.End());
+        gendoc::parsing::LazyTextScope lazyTextScope(&sourceFileContent);
+        std::unique_ptr<ParserFileContent> parserFileContent(parserFileGrammar->Parse(sourceFileContent.Start(), sourceFileContent.End(), i, sourceFilePath, i, parsingDomain.get()));
         parserFiles.push_back(std::move(parserFileContent));
     }
     std::cout << "Linking...\n";
@@ -51,8 +51,8 @@ gendoc::parsing::Grammar* GrammarGrammar::Parse(const char32_t* start, const cha
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<gendoc::parsing::Scope*>(enclosingScope)));
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<ParsingDomain*>(parsingDomain)));
+    stack.Push<gendoc::parsing::Scope*>(enclosingScope);
+    stack.Push<ParsingDomain*>(parsingDomain);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -70,9 +70,7 @@ gendoc::parsing::Grammar* GrammarGrammar::Parse(const char32_t* start, const cha
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::parsing::Grammar* result = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(value.get());
-    stack.pop();
+    gendoc::parsing::Grammar* result = stack.Pop<gendoc::parsing::Grammar*>();
     return result;
 }
 
@@ -88,21 +86,16 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain_value = std::move(stack.top());
-        context->parsingDomain = *static_cast<gendoc::parsing::ValueObject<ParsingDomain*>*>(parsingDomain_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain = stack.Pop<ParsingDomain*>();
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->value)));
+            stack.Push<gendoc::parsing::Grammar*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -127,15 +120,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromname_value = std::move(stack.top());
-            context->fromname = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromname_value.get());
-            stack.pop();
+            context->fromname = stack.Pop<std::u32string>();
         }
     }
     void PreGrammarContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->value)));
+        stack.Push<gendoc::parsing::Grammar*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -158,11 +149,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->grammar = stack.Pop<gendoc::parsing::Grammar*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -190,31 +178,29 @@ public:
     void PreStartClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->grammar)));
+        stack.Push<gendoc::parsing::Grammar*>(context->grammar);
     }
     void PreSkipClause(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->grammar)));
+        stack.Push<gendoc::parsing::Grammar*>(context->grammar);
     }
     void PreRuleLink(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->grammar)));
+        stack.Push<gendoc::parsing::Grammar*>(context->grammar);
     }
     void PreRule(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->grammar->GetScope())));
+        stack.Push<gendoc::parsing::Scope*>(context->grammar->GetScope());
     }
     void PostRule(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRule_value = std::move(stack.top());
-            context->fromRule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(fromRule_value.get());
-            stack.pop();
+            context->fromRule = stack.Pop<gendoc::parsing::Rule*>();
         }
     }
 private:
@@ -236,11 +222,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->grammar = stack.Pop<gendoc::parsing::Grammar*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -263,9 +246,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromstrt_value = std::move(stack.top());
-            context->fromstrt = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromstrt_value.get());
-            stack.pop();
+            context->fromstrt = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -287,11 +268,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->grammar = stack.Pop<gendoc::parsing::Grammar*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -314,9 +292,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromskp_value = std::move(stack.top());
-            context->fromskp = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromskp_value.get());
-            stack.pop();
+            context->fromskp = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -52,7 +52,7 @@ void LibraryFile::Parse(const char32_t* start, const char32_t* end, int fileInde
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<gendoc::parsing::ParsingDomain*>(parsingDomain)));
+    stack.Push<gendoc::parsing::ParsingDomain*>(parsingDomain);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -82,11 +82,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain_value = std::move(stack.top());
-        context->parsingDomain = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>*>(parsingDomain_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain = stack.Pop<gendoc::parsing::ParsingDomain*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -100,7 +97,7 @@ public:
     void PreNamespaceContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>(context->parsingDomain)));
+        stack.Push<gendoc::parsing::ParsingDomain*>(context->parsingDomain);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -120,11 +117,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain_value = std::move(stack.top());
-        context->parsingDomain = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>*>(parsingDomain_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain = stack.Pop<gendoc::parsing::ParsingDomain*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -148,22 +142,20 @@ public:
     void PreGrammar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->parsingDomain->CurrentNamespace()->GetScope())));
+        stack.Push<gendoc::parsing::Scope*>(context->parsingDomain->CurrentNamespace()->GetScope());
     }
     void PostGrammar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGrammar_value = std::move(stack.top());
-            context->fromGrammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(fromGrammar_value.get());
-            stack.pop();
+            context->fromGrammar = stack.Pop<gendoc::parsing::Grammar*>();
         }
     }
     void PreNamespace(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>(context->parsingDomain)));
+        stack.Push<gendoc::parsing::ParsingDomain*>(context->parsingDomain);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -184,11 +176,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain_value = std::move(stack.top());
-        context->parsingDomain = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>*>(parsingDomain_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain = stack.Pop<gendoc::parsing::ParsingDomain*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -220,15 +209,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromns_value = std::move(stack.top());
-            context->fromns = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromns_value.get());
-            stack.pop();
+            context->fromns = stack.Pop<std::u32string>();
         }
     }
     void PreNamespaceContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>(context->parsingDomain)));
+        stack.Push<gendoc::parsing::ParsingDomain*>(context->parsingDomain);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -250,18 +237,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->value)));
+            stack.Push<gendoc::parsing::Grammar*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -285,15 +269,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromgrammarName_value = std::move(stack.top());
-            context->fromgrammarName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromgrammarName_value.get());
-            stack.pop();
+            context->fromgrammarName = stack.Pop<std::u32string>();
         }
     }
     void PreGrammarContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>(context->value)));
+        stack.Push<gendoc::parsing::Grammar*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -315,11 +297,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> grammar_value = std::move(stack.top());
-        context->grammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(grammar_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->grammar = stack.Pop<gendoc::parsing::Grammar*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -341,16 +320,14 @@ public:
     void PreRule(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->grammar->GetScope())));
+        stack.Push<gendoc::parsing::Scope*>(context->grammar->GetScope());
     }
     void PostRule(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRule_value = std::move(stack.top());
-            context->fromRule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(fromRule_value.get());
-            stack.pop();
+            context->fromRule = stack.Pop<gendoc::parsing::Rule*>();
         }
     }
 private:
@@ -373,18 +350,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->value)));
+            stack.Push<gendoc::parsing::Rule*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -407,15 +381,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromruleName_value = std::move(stack.top());
-            context->fromruleName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromruleName_value.get());
-            stack.pop();
+            context->fromruleName = stack.Pop<std::u32string>();
         }
     }
     void PreSignature(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->value)));
+        stack.Push<gendoc::parsing::Rule*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
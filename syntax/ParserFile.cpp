@@ -54,8 +54,8 @@ ParserFileContent* ParserFile::Parse(const char32_t* start, const char32_t* end,
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<int>(id_)));
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<gendoc::parsing::ParsingDomain*>(parsingDomain_)));
+    stack.Push<int>(id_);
+    stack.Push<gendoc::parsing::ParsingDomain*>(parsingDomain_);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -73,9 +73,7 @@ ParserFileContent* ParserFile::Parse(const char32_t* start, const char32_t* end,
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    ParserFileContent* result = *static_cast<gendoc::parsing::ValueObject<ParserFileContent*>*>(value.get());
-    stack.pop();
+    ParserFileContent* result = stack.Pop<ParserFileContent*>();
     return result;
 }
 
@@ -91,21 +89,16 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain__value = std::move(stack.top());
-        context->parsingDomain_ = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::ParsingDomain*>*>(parsingDomain__value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> id__value = std::move(stack.top());
-        context->id_ = *static_cast<gendoc::parsing::ValueObject<int>*>(id__value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain_ = stack.Pop<gendoc::parsing::ParsingDomain*>();
+        context->id_ = stack.Pop<int>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParserFileContent*>(context->value)));
+            stack.Push<ParserFileContent*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -127,13 +120,13 @@ public:
     void PreIncludeDirectives(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParserFileContent*>(context->value)));
+        stack.Push<ParserFileContent*>(context->value);
     }
     void PreNamespaceContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParserFileContent*>(context->value)));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingDomain*>(context->parsingDomain_)));
+        stack.Push<ParserFileContent*>(context->value);
+        stack.Push<ParsingDomain*>(context->parsingDomain_);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -155,11 +148,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<gendoc::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parserFileContent = stack.Pop<ParserFileContent*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -173,7 +163,7 @@ public:
     void PreIncludeDirective(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParserFileContent*>(context->parserFileContent)));
+        stack.Push<ParserFileContent*>(context->parserFileContent);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -193,11 +183,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<gendoc::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parserFileContent = stack.Pop<ParserFileContent*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -222,9 +209,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFileAttribute_value = std::move(stack.top());
-            context->fromFileAttribute = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromFileAttribute_value.get());
-            stack.pop();
+            context->fromFileAttribute = stack.Pop<std::u32string>();
         }
     }
     void PostIncludeFileName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -232,9 +217,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIncludeFileName_value = std::move(stack.top());
-            context->fromIncludeFileName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIncludeFileName_value.get());
-            stack.pop();
+            context->fromIncludeFileName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -257,15 +240,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -297,15 +279,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -338,14 +319,9 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain_value = std::move(stack.top());
-        context->parsingDomain = *static_cast<gendoc::parsing::ValueObject<ParsingDomain*>*>(parsingDomain_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<gendoc::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain = stack.Pop<ParsingDomain*>();
+        context->parserFileContent = stack.Pop<ParserFileContent*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -403,9 +379,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFileAttribute_value = std::move(stack.top());
-            context->fromFileAttribute = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromFileAttribute_value.get());
-            stack.pop();
+            context->fromFileAttribute = stack.Pop<std::u32string>();
         }
     }
     void PostUsingDeclaration(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -413,9 +387,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDeclaration_value = std::move(stack.top());
-            context->fromUsingDeclaration = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>*>(fromUsingDeclaration_value.get());
-            stack.pop();
+            context->fromUsingDeclaration = stack.Pop<gendoc::codedom::UsingObject*>();
         }
     }
     void PostUsingDirective(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -423,9 +395,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUsingDirective_value = std::move(stack.top());
-            context->fromUsingDirective = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>*>(fromUsingDirective_value.get());
-            stack.pop();
+            context->fromUsingDirective = stack.Pop<gendoc::codedom::UsingObject*>();
         }
     }
     void PostNamespaceAliasDefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -433,32 +403,28 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNamespaceAliasDefinition_value = std::move(stack.top());
-            context->fromNamespaceAliasDefinition = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::UsingObject*>*>(fromNamespaceAliasDefinition_value.get());
-            stack.pop();
+            context->fromNamespaceAliasDefinition = stack.Pop<gendoc::codedom::UsingObject*>();
         }
     }
     void PreGrammar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->parserFileContent->CurrentScope())));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingDomain*>(context->parsingDomain)));
+        stack.Push<gendoc::parsing::Scope*>(context->parserFileContent->CurrentScope());
+        stack.Push<ParsingDomain*>(context->parsingDomain);
     }
     void PostGrammar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGrammar_value = std::move(stack.top());
-            context->fromGrammar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Grammar*>*>(fromGrammar_value.get());
-            stack.pop();
+            context->fromGrammar = stack.Pop<gendoc::parsing::Grammar*>();
         }
     }
     void PreNamespace(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParserFileContent*>(context->parserFileContent)));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingDomain*>(context->parsingDomain)));
+        stack.Push<ParserFileContent*>(context->parserFileContent);
+        stack.Push<ParsingDomain*>(context->parsingDomain);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -485,14 +451,9 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> parsingDomain_value = std::move(stack.top());
-        context->parsingDomain = *static_cast<gendoc::parsing::ValueObject<ParsingDomain*>*>(parsingDomain_value.get());
-        stack.pop();
-        std::unique_ptr<gendoc::parsing::Object> parserFileContent_value = std::move(stack.top());
-        context->parserFileContent = *static_cast<gendoc::parsing::ValueObject<ParserFileContent*>*>(parserFileContent_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->parsingDomain = stack.Pop<ParsingDomain*>();
+        context->parserFileContent = stack.Pop<ParserFileContent*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -524,16 +485,14 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromns_value = std::move(stack.top());
-            context->fromns = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromns_value.get());
-            stack.pop();
+            context->fromns = stack.Pop<std::u32string>();
         }
     }
     void PreNamespaceContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParserFileContent*>(context->parserFileContent)));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<ParsingDomain*>(context->parsingDomain)));
+        stack.Push<ParserFileContent*>(context->parserFileContent);
+        stack.Push<ParsingDomain*>(context->parsingDomain);
     }
 private:
     struct Context : gendoc::parsing::Context
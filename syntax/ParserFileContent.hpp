@@ -17,6 +17,8 @@ public:
     ParserFileContent(int id_, gendoc::parsing::ParsingDomain* parsingDomain_);
     void SetFilePath(const std::string& filePath_) { filePath = filePath_; }
     void SetRelativeFilePath(const std::string& relativeFilePath_) { relativeFilePath = relativeFilePath_; }
+    void SetContent(std::u32string&& content_) { content = std::move(content_); }
+    std::u32string ReleaseContent() { return std::move(content); }
     void AddIncludeDirective(const std::string& includeDirective_, const std::string& fileAttribute_);
     void AddUsingObject(gendoc::codedom::UsingObject* usingObjectSubject);
     void AddGrammar(gendoc::parsing::Grammar* grammar);
@@ -33,6 +35,7 @@ private:
     int id;
     std::string filePath;
     std::string relativeFilePath;
+    std::u32string content;
     gendoc::parsing::ParsingDomain* parsingDomain;
     std::vector<std::pair<std::string, std::string>> includeDirectives;
     std::vector<std::unique_ptr<gendoc::parsing::UsingObject>> usingObjects;
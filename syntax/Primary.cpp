@@ -57,7 +57,7 @@ gendoc::parsing::Parser* Primary::Parse(const char32_t* start, const char32_t* e
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<gendoc::parsing::Scope*>(enclosingScope)));
+    stack.Push<gendoc::parsing::Scope*>(enclosingScope);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -75,9 +75,7 @@ gendoc::parsing::Parser* Primary::Parse(const char32_t* start, const char32_t* e
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::parsing::Parser* result = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(value.get());
-    stack.pop();
+    gendoc::parsing::Parser* result = stack.Pop<gendoc::parsing::Parser*>();
     return result;
 }
 
@@ -92,18 +90,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -173,9 +168,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRuleCall_value = std::move(stack.top());
-            context->fromRuleCall = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromRuleCall_value.get());
-            stack.pop();
+            context->fromRuleCall = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostPrimitive(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -183,69 +176,59 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPrimitive_value = std::move(stack.top());
-            context->fromPrimitive = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromPrimitive_value.get());
-            stack.pop();
+            context->fromPrimitive = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PreGrouping(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->enclosingScope)));
+        stack.Push<gendoc::parsing::Scope*>(context->enclosingScope);
     }
     void PostGrouping(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGrouping_value = std::move(stack.top());
-            context->fromGrouping = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromGrouping_value.get());
-            stack.pop();
+            context->fromGrouping = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PreToken(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->enclosingScope)));
+        stack.Push<gendoc::parsing::Scope*>(context->enclosingScope);
     }
     void PostToken(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromToken_value = std::move(stack.top());
-            context->fromToken = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromToken_value.get());
-            stack.pop();
+            context->fromToken = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PreExpectation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+        stack.Push<gendoc::parsing::Parser*>(context->value);
     }
     void PostExpectation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpectation_value = std::move(stack.top());
-            context->fromExpectation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromExpectation_value.get());
-            stack.pop();
+            context->fromExpectation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PreAction(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+        stack.Push<gendoc::parsing::Parser*>(context->value);
     }
     void PostAction(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAction_value = std::move(stack.top());
-            context->fromAction = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromAction_value.get());
-            stack.pop();
+            context->fromAction = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -273,15 +256,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -325,9 +307,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromntWithArgs_value = std::move(stack.top());
-            context->fromntWithArgs = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromntWithArgs_value.get());
-            stack.pop();
+            context->fromntWithArgs = stack.Pop<std::u32string>();
         }
     }
     void PostExpressionList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -335,9 +315,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpressionList_value = std::move(stack.top());
-            context->fromExpressionList = *static_cast<gendoc::parsing::ValueObject<std::vector<gendoc::codedom::CppObject*>>*>(fromExpressionList_value.get());
-            stack.pop();
+            context->fromExpressionList = stack.Pop<std::vector<gendoc::codedom::CppObject*>>();
         }
     }
     void Postnt(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -345,9 +323,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromnt_value = std::move(stack.top());
-            context->fromnt = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromnt_value.get());
-            stack.pop();
+            context->fromnt = stack.Pop<std::u32string>();
         }
     }
     void PostAlias(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -355,9 +331,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAlias_value = std::move(stack.top());
-            context->fromAlias = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromAlias_value.get());
-            stack.pop();
+            context->fromAlias = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -382,15 +356,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -411,9 +384,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -435,15 +406,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -464,9 +434,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdentifier_value = std::move(stack.top());
-            context->fromIdentifier = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromIdentifier_value.get());
-            stack.pop();
+            context->fromIdentifier = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -489,18 +457,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -520,16 +485,14 @@ public:
     void PreAlternative(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->enclosingScope)));
+        stack.Push<gendoc::parsing::Scope*>(context->enclosingScope);
     }
     void PostAlternative(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAlternative_value = std::move(stack.top());
-            context->fromAlternative = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromAlternative_value.get());
-            stack.pop();
+            context->fromAlternative = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -553,18 +516,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -584,16 +544,14 @@ public:
     void PreAlternative(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->enclosingScope)));
+        stack.Push<gendoc::parsing::Scope*>(context->enclosingScope);
     }
     void PostAlternative(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAlternative_value = std::move(stack.top());
-            context->fromAlternative = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromAlternative_value.get());
-            stack.pop();
+            context->fromAlternative = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -617,18 +575,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> child_value = std::move(stack.top());
-        context->child = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(child_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->child = stack.Pop<gendoc::parsing::Parser*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -662,18 +617,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> child_value = std::move(stack.top());
-        context->child = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(child_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->child = stack.Pop<gendoc::parsing::Parser*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -696,9 +648,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromaction_value = std::move(stack.top());
-            context->fromaction = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>*>(fromaction_value.get());
-            stack.pop();
+            context->fromaction = stack.Pop<gendoc::codedom::CompoundStatement*>();
         }
     }
     void PostfailureAction(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -706,9 +656,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromfailureAction_value = std::move(stack.top());
-            context->fromfailureAction = *static_cast<gendoc::parsing::ValueObject<gendoc::codedom::CompoundStatement*>*>(fromfailureAction_value.get());
-            stack.pop();
+            context->fromfailureAction = stack.Pop<gendoc::codedom::CompoundStatement*>();
         }
     }
 private:
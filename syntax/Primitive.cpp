@@ -67,9 +67,7 @@ gendoc::parsing::Parser* Primitive::Parse(const char32_t* start, const char32_t*
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::parsing::Parser* result = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(value.get());
-    stack.pop();
+    gendoc::parsing::Parser* result = stack.Pop<gendoc::parsing::Parser*>();
     return result;
 }
 
@@ -83,15 +81,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -589,9 +586,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromChar_value = std::move(stack.top());
-            context->fromChar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromChar_value.get());
-            stack.pop();
+            context->fromChar = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostString(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -599,9 +594,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromString_value = std::move(stack.top());
-            context->fromString = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromString_value.get());
-            stack.pop();
+            context->fromString = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostCharSet(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -609,9 +602,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCharSet_value = std::move(stack.top());
-            context->fromCharSet = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromCharSet_value.get());
-            stack.pop();
+            context->fromCharSet = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostKeyword(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -619,9 +610,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromKeyword_value = std::move(stack.top());
-            context->fromKeyword = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromKeyword_value.get());
-            stack.pop();
+            context->fromKeyword = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostKeywordList(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -629,9 +618,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromKeywordList_value = std::move(stack.top());
-            context->fromKeywordList = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromKeywordList_value.get());
-            stack.pop();
+            context->fromKeywordList = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostRange(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -639,9 +626,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRange_value = std::move(stack.top());
-            context->fromRange = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromRange_value.get());
-            stack.pop();
+            context->fromRange = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostEmpty(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -649,9 +634,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEmpty_value = std::move(stack.top());
-            context->fromEmpty = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromEmpty_value.get());
-            stack.pop();
+            context->fromEmpty = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostSpace(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -659,9 +642,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSpace_value = std::move(stack.top());
-            context->fromSpace = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromSpace_value.get());
-            stack.pop();
+            context->fromSpace = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostAnyChar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -669,9 +650,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAnyChar_value = std::move(stack.top());
-            context->fromAnyChar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromAnyChar_value.get());
-            stack.pop();
+            context->fromAnyChar = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -679,9 +658,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLetter_value = std::move(stack.top());
-            context->fromLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromLetter_value.get());
-            stack.pop();
+            context->fromLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostDigit(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -689,9 +666,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDigit_value = std::move(stack.top());
-            context->fromDigit = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromDigit_value.get());
-            stack.pop();
+            context->fromDigit = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostHexDigit(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -699,9 +674,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromHexDigit_value = std::move(stack.top());
-            context->fromHexDigit = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromHexDigit_value.get());
-            stack.pop();
+            context->fromHexDigit = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostUpperLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -709,9 +682,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUpperLetter_value = std::move(stack.top());
-            context->fromUpperLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromUpperLetter_value.get());
-            stack.pop();
+            context->fromUpperLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostLowerLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -719,9 +690,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLowerLetter_value = std::move(stack.top());
-            context->fromLowerLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromLowerLetter_value.get());
-            stack.pop();
+            context->fromLowerLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostTitleLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -729,9 +698,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromTitleLetter_value = std::move(stack.top());
-            context->fromTitleLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromTitleLetter_value.get());
-            stack.pop();
+            context->fromTitleLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostModifierLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -739,9 +706,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromModifierLetter_value = std::move(stack.top());
-            context->fromModifierLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromModifierLetter_value.get());
-            stack.pop();
+            context->fromModifierLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostOtherLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -749,9 +714,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOtherLetter_value = std::move(stack.top());
-            context->fromOtherLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromOtherLetter_value.get());
-            stack.pop();
+            context->fromOtherLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostCasedLetter(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -759,9 +722,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCasedLetter_value = std::move(stack.top());
-            context->fromCasedLetter = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromCasedLetter_value.get());
-            stack.pop();
+            context->fromCasedLetter = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostMark(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -769,9 +730,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromMark_value = std::move(stack.top());
-            context->fromMark = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromMark_value.get());
-            stack.pop();
+            context->fromMark = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostNonspacingMark(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -779,9 +738,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNonspacingMark_value = std::move(stack.top());
-            context->fromNonspacingMark = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromNonspacingMark_value.get());
-            stack.pop();
+            context->fromNonspacingMark = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostEnclosingMark(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -789,9 +746,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEnclosingMark_value = std::move(stack.top());
-            context->fromEnclosingMark = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromEnclosingMark_value.get());
-            stack.pop();
+            context->fromEnclosingMark = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostSpacingMark(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -799,9 +754,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSpacingMark_value = std::move(stack.top());
-            context->fromSpacingMark = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromSpacingMark_value.get());
-            stack.pop();
+            context->fromSpacingMark = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostNumber(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -809,9 +762,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNumber_value = std::move(stack.top());
-            context->fromNumber = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromNumber_value.get());
-            stack.pop();
+            context->fromNumber = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostDecimalNumber(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -819,9 +770,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDecimalNumber_value = std::move(stack.top());
-            context->fromDecimalNumber = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromDecimalNumber_value.get());
-            stack.pop();
+            context->fromDecimalNumber = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostLetterNumber(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -829,9 +778,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLetterNumber_value = std::move(stack.top());
-            context->fromLetterNumber = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromLetterNumber_value.get());
-            stack.pop();
+            context->fromLetterNumber = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostOtherNumber(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -839,9 +786,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOtherNumber_value = std::move(stack.top());
-            context->fromOtherNumber = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromOtherNumber_value.get());
-            stack.pop();
+            context->fromOtherNumber = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -849,9 +794,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPunctuation_value = std::move(stack.top());
-            context->fromPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromPunctuation_value.get());
-            stack.pop();
+            context->fromPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostConnectorPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -859,9 +802,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromConnectorPunctuation_value = std::move(stack.top());
-            context->fromConnectorPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromConnectorPunctuation_value.get());
-            stack.pop();
+            context->fromConnectorPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostDashPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -869,9 +810,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromDashPunctuation_value = std::move(stack.top());
-            context->fromDashPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromDashPunctuation_value.get());
-            stack.pop();
+            context->fromDashPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostOpenPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -879,9 +818,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOpenPunctuation_value = std::move(stack.top());
-            context->fromOpenPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromOpenPunctuation_value.get());
-            stack.pop();
+            context->fromOpenPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostClosePunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -889,9 +826,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromClosePunctuation_value = std::move(stack.top());
-            context->fromClosePunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromClosePunctuation_value.get());
-            stack.pop();
+            context->fromClosePunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostInitialPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -899,9 +834,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromInitialPunctuation_value = std::move(stack.top());
-            context->fromInitialPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromInitialPunctuation_value.get());
-            stack.pop();
+            context->fromInitialPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostFinalPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -909,9 +842,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFinalPunctuation_value = std::move(stack.top());
-            context->fromFinalPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromFinalPunctuation_value.get());
-            stack.pop();
+            context->fromFinalPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostOtherPunctuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -919,9 +850,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOtherPunctuation_value = std::move(stack.top());
-            context->fromOtherPunctuation = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromOtherPunctuation_value.get());
-            stack.pop();
+            context->fromOtherPunctuation = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostSymbol(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -929,9 +858,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSymbol_value = std::move(stack.top());
-            context->fromSymbol = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromSymbol_value.get());
-            stack.pop();
+            context->fromSymbol = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostMathSymbol(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -939,9 +866,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromMathSymbol_value = std::move(stack.top());
-            context->fromMathSymbol = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromMathSymbol_value.get());
-            stack.pop();
+            context->fromMathSymbol = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostCurrencySymbol(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -949,9 +874,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCurrencySymbol_value = std::move(stack.top());
-            context->fromCurrencySymbol = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromCurrencySymbol_value.get());
-            stack.pop();
+            context->fromCurrencySymbol = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostModifierSymbol(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -959,9 +882,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromModifierSymbol_value = std::move(stack.top());
-            context->fromModifierSymbol = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromModifierSymbol_value.get());
-            stack.pop();
+            context->fromModifierSymbol = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostOtherSymbol(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -969,9 +890,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOtherSymbol_value = std::move(stack.top());
-            context->fromOtherSymbol = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromOtherSymbol_value.get());
-            stack.pop();
+            context->fromOtherSymbol = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostSeparator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -979,9 +898,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSeparator_value = std::move(stack.top());
-            context->fromSeparator = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromSeparator_value.get());
-            stack.pop();
+            context->fromSeparator = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostSpaceSeparator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -989,9 +906,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSpaceSeparator_value = std::move(stack.top());
-            context->fromSpaceSeparator = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromSpaceSeparator_value.get());
-            stack.pop();
+            context->fromSpaceSeparator = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostLineSeparator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -999,9 +914,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLineSeparator_value = std::move(stack.top());
-            context->fromLineSeparator = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromLineSeparator_value.get());
-            stack.pop();
+            context->fromLineSeparator = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostParagraphSeparator(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1009,9 +922,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromParagraphSeparator_value = std::move(stack.top());
-            context->fromParagraphSeparator = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromParagraphSeparator_value.get());
-            stack.pop();
+            context->fromParagraphSeparator = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostOther(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1019,9 +930,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOther_value = std::move(stack.top());
-            context->fromOther = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromOther_value.get());
-            stack.pop();
+            context->fromOther = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostControl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1029,9 +938,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromControl_value = std::move(stack.top());
-            context->fromControl = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromControl_value.get());
-            stack.pop();
+            context->fromControl = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostFormat(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1039,9 +946,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFormat_value = std::move(stack.top());
-            context->fromFormat = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromFormat_value.get());
-            stack.pop();
+            context->fromFormat = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostSurrogate(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1049,9 +954,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSurrogate_value = std::move(stack.top());
-            context->fromSurrogate = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromSurrogate_value.get());
-            stack.pop();
+            context->fromSurrogate = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostPrivateUse(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1059,9 +962,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPrivateUse_value = std::move(stack.top());
-            context->fromPrivateUse = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromPrivateUse_value.get());
-            stack.pop();
+            context->fromPrivateUse = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostUnassigned(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1069,9 +970,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUnassigned_value = std::move(stack.top());
-            context->fromUnassigned = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromUnassigned_value.get());
-            stack.pop();
+            context->fromUnassigned = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostGraphic(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1079,9 +978,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromGraphic_value = std::move(stack.top());
-            context->fromGraphic = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromGraphic_value.get());
-            stack.pop();
+            context->fromGraphic = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostBaseChar(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1089,9 +986,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromBaseChar_value = std::move(stack.top());
-            context->fromBaseChar = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromBaseChar_value.get());
-            stack.pop();
+            context->fromBaseChar = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostAlphabetic(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1099,9 +994,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAlphabetic_value = std::move(stack.top());
-            context->fromAlphabetic = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromAlphabetic_value.get());
-            stack.pop();
+            context->fromAlphabetic = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostIdStart(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1109,9 +1002,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdStart_value = std::move(stack.top());
-            context->fromIdStart = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromIdStart_value.get());
-            stack.pop();
+            context->fromIdStart = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
     void PostIdCont(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1119,9 +1010,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromIdCont_value = std::move(stack.top());
-            context->fromIdCont = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromIdCont_value.get());
-            stack.pop();
+            context->fromIdCont = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -1196,15 +1085,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1225,9 +1113,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromchr_value = std::move(stack.top());
-            context->fromchr = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromchr_value.get());
-            stack.pop();
+            context->fromchr = stack.Pop<char32_t>();
         }
     }
 private:
@@ -1249,15 +1135,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1278,9 +1163,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromstr_value = std::move(stack.top());
-            context->fromstr = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromstr_value.get());
-            stack.pop();
+            context->fromstr = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1304,15 +1187,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1347,9 +1229,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCharSetRange_value = std::move(stack.top());
-            context->fromCharSetRange = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromCharSetRange_value.get());
-            stack.pop();
+            context->fromCharSetRange = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1373,15 +1253,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1413,9 +1292,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromfirst_value = std::move(stack.top());
-            context->fromfirst = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromfirst_value.get());
-            stack.pop();
+            context->fromfirst = stack.Pop<char32_t>();
         }
     }
     void Postlast(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1423,9 +1300,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromlast_value = std::move(stack.top());
-            context->fromlast = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromlast_value.get());
-            stack.pop();
+            context->fromlast = stack.Pop<char32_t>();
         }
     }
 private:
@@ -1448,15 +1323,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<char32_t>(context->value)));
+            stack.Push<char32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1484,9 +1358,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromescape_value = std::move(stack.top());
-            context->fromescape = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromescape_value.get());
-            stack.pop();
+            context->fromescape = stack.Pop<char32_t>();
         }
     }
 private:
@@ -1508,15 +1380,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1537,9 +1408,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromKeywordBody_value = std::move(stack.top());
-            context->fromKeywordBody = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromKeywordBody_value.get());
-            stack.pop();
+            context->fromKeywordBody = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -1561,15 +1430,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1599,9 +1467,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromstr_value = std::move(stack.top());
-            context->fromstr = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromstr_value.get());
-            stack.pop();
+            context->fromstr = stack.Pop<std::u32string>();
         }
     }
     void Postcontinuation(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1609,9 +1475,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromcontinuation_value = std::move(stack.top());
-            context->fromcontinuation = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromcontinuation_value.get());
-            stack.pop();
+            context->fromcontinuation = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1634,15 +1498,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1663,9 +1526,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromKeywordListBody_value = std::move(stack.top());
-            context->fromKeywordListBody = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromKeywordListBody_value.get());
-            stack.pop();
+            context->fromKeywordListBody = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -1688,15 +1549,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1719,15 +1579,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromselector_value = std::move(stack.top());
-            context->fromselector = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromselector_value.get());
-            stack.pop();
+            context->fromselector = stack.Pop<std::u32string>();
         }
     }
     void PreStringArray(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::vector<std::u32string>*>(&context->keywords)));
+        stack.Push<std::vector<std::u32string>*>(&context->keywords);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1749,15 +1607,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1780,9 +1637,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> froms_value = std::move(stack.top());
-            context->froms = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(froms_value.get());
-            stack.pop();
+            context->froms = stack.Pop<uint32_t>();
         }
     }
     void Poste(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1790,9 +1645,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frome_value = std::move(stack.top());
-            context->frome = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(frome_value.get());
-            stack.pop();
+            context->frome = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -1815,15 +1668,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<uint32_t>(context->value)));
+            stack.Push<uint32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1853,9 +1705,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromx_value = std::move(stack.top());
-            context->fromx = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromx_value.get());
-            stack.pop();
+            context->fromx = stack.Pop<uint32_t>();
         }
     }
     void Postd(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1863,9 +1713,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromd_value = std::move(stack.top());
-            context->fromd = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromd_value.get());
-            stack.pop();
+            context->fromd = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -1888,15 +1736,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1928,15 +1775,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1968,15 +1814,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2008,15 +1853,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2048,15 +1892,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2088,15 +1931,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2128,15 +1970,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2168,15 +2009,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2208,15 +2048,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2248,15 +2087,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2288,15 +2126,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2328,15 +2165,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2368,15 +2204,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2408,15 +2243,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2448,15 +2282,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2488,15 +2321,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2528,15 +2360,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2568,15 +2399,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2608,15 +2438,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2648,15 +2477,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2688,15 +2516,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2728,15 +2555,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2768,15 +2594,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2808,15 +2633,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2848,15 +2672,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2888,15 +2711,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2928,15 +2750,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2968,15 +2789,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3008,15 +2828,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3048,15 +2867,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3088,15 +2906,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3128,15 +2945,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3168,15 +2984,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3208,15 +3023,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3248,15 +3062,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3288,15 +3101,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3328,15 +3140,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3368,15 +3179,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3408,15 +3218,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3448,15 +3257,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3488,15 +3296,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3528,15 +3335,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3568,15 +3374,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3608,15 +3413,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3648,15 +3452,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3688,15 +3491,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3728,15 +3530,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -3768,15 +3569,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Parser*>(context->value)));
+            stack.Push<gendoc::parsing::Parser*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -66,9 +66,7 @@ Project* ProjectFile::Parse(const char32_t* start, const char32_t* end, int file
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    Project* result = *static_cast<gendoc::parsing::ValueObject<Project*>*>(value.get());
-    stack.pop();
+    Project* result = stack.Pop<Project*>();
     return result;
 }
 
@@ -82,15 +80,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->value)));
+            stack.Push<Project*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -113,15 +110,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromprojectName_value = std::move(stack.top());
-            context->fromprojectName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromprojectName_value.get());
-            stack.pop();
+            context->fromprojectName = stack.Pop<std::u32string>();
         }
     }
     void PreProjectFileContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Project*>(context->value)));
+        stack.Push<Project*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -142,11 +137,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> project_value = std::move(stack.top());
-        context->project = *static_cast<gendoc::parsing::ValueObject<Project*>*>(project_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->project = stack.Pop<Project*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -178,9 +170,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromSource_value = std::move(stack.top());
-            context->fromSource = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromSource_value.get());
-            stack.pop();
+            context->fromSource = stack.Pop<std::u32string>();
         }
     }
     void PostReference(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -188,9 +178,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromReference_value = std::move(stack.top());
-            context->fromReference = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromReference_value.get());
-            stack.pop();
+            context->fromReference = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -213,15 +201,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -242,9 +229,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFilePath_value = std::move(stack.top());
-            context->fromFilePath = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromFilePath_value.get());
-            stack.pop();
+            context->fromFilePath = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -266,15 +251,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -295,9 +279,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFilePath_value = std::move(stack.top());
-            context->fromFilePath = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromFilePath_value.get());
-            stack.pop();
+            context->fromFilePath = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -319,15 +301,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -51,7 +51,7 @@ gendoc::parsing::Rule* Rule::Parse(const char32_t* start, const char32_t* end, i
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<gendoc::parsing::Scope*>(enclosingScope)));
+    stack.Push<gendoc::parsing::Scope*>(enclosingScope);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -69,9 +69,7 @@ gendoc::parsing::Rule* Rule::Parse(const char32_t* start, const char32_t* end, i
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    gendoc::parsing::Rule* result = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(value.get());
-    stack.pop();
+    gendoc::parsing::Rule* result = stack.Pop<gendoc::parsing::Rule*>();
     return result;
 }
 
@@ -86,18 +84,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->value)));
+            stack.Push<gendoc::parsing::Rule*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -119,22 +114,20 @@ public:
     void PreRuleHeader(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->enclosingScope)));
+        stack.Push<gendoc::parsing::Scope*>(context->enclosingScope);
     }
     void PostRuleHeader(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRuleHeader_value = std::move(stack.top());
-            context->fromRuleHeader = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(fromRuleHeader_value.get());
-            stack.pop();
+            context->fromRuleHeader = stack.Pop<gendoc::parsing::Rule*>();
         }
     }
     void PreRuleBody(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->value)));
+        stack.Push<gendoc::parsing::Rule*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -157,18 +150,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> enclosingScope_value = std::move(stack.top());
-        context->enclosingScope = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Scope*>*>(enclosingScope_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->enclosingScope = stack.Pop<gendoc::parsing::Scope*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->value)));
+            stack.Push<gendoc::parsing::Rule*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -192,15 +182,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromname_value = std::move(stack.top());
-            context->fromname = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromname_value.get());
-            stack.pop();
+            context->fromname = stack.Pop<std::u32string>();
         }
     }
     void PreSignature(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Rule*>(context->value)));
+        stack.Push<gendoc::parsing::Rule*>(context->value);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -222,11 +210,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> rule_value = std::move(stack.top());
-        context->rule = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Rule*>*>(rule_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->rule = stack.Pop<gendoc::parsing::Rule*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -248,16 +233,14 @@ public:
     void Predefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<gendoc::parsing::Scope*>(context->rule->GetScope())));
+        stack.Push<gendoc::parsing::Scope*>(context->rule->GetScope());
     }
     void Postdefinition(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromdefinition_value = std::move(stack.top());
-            context->fromdefinition = *static_cast<gendoc::parsing::ValueObject<gendoc::parsing::Parser*>*>(fromdefinition_value.get());
-            stack.pop();
+            context->fromdefinition = stack.Pop<gendoc::parsing::Parser*>();
         }
     }
 private:
@@ -0,0 +1,96 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/util/Atom.hpp>
+#include <stdexcept>
+
+namespace gendoc { namespace util {
+
+void AtomTable::Init()
+{
+    instance.reset(new AtomTable());
+}
+
+void AtomTable::Done()
+{
+    instance.reset();
+}
+
+std::unique_ptr<AtomTable> AtomTable::instance;
+
+AtomTable::AtomTable()
+{
+    shards[0].strings.push_back(&emptyString);
+}
+
+inline int ShardIndex(const std::u32string& s)
+{
+    return static_cast<int>(std::hash<std::u32string>()(s) & (numAtomShards - 1));
+}
+
+Atom AtomTable::MakeAtom(const std::u32string& s)
+{
+    if (s.empty())
+    {
+        return emptyAtom;
+    }
+    int shardIndex = ShardIndex(s);
+    Shard& shard = shards[shardIndex];
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.atomMap.find(s);
+    if (it != shard.atomMap.cend())
+    {
+        return it->second;
+    }
+    Atom index = static_cast<Atom>(shard.strings.size());
+    if (index >= (noAtom >> atomShardBits))
+    {
+        throw std::runtime_error("atom table full");
+    }
+    Atom atom = (index << atomShardBits) | static_cast<Atom>(shardIndex);
+    auto result = shard.atomMap.insert(std::make_pair(s, atom));
+    shard.strings.push_back(&result.first->first);
+    return atom;
+}
+
+Atom AtomTable::GetAtom(const std::u32string& s)
+{
+    if (s.empty())
+    {
+        return emptyAtom;
+    }
+    Shard& shard = shards[ShardIndex(s)];
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto it = shard.atomMap.find(s);
+    if (it != shard.atomMap.cend())
+    {
+        return it->second;
+    }
+    return noAtom;
+}
+
+std::u32string AtomTable::GetString(Atom atom)
+{
+    Shard& shard = shards[atom & (numAtomShards - 1)];
+    Atom index = atom >> atomShardBits;
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    if (index >= shard.strings.size())
+    {
+        throw std::runtime_error("invalid atom");
+    }
+    return *shard.strings[index];
+}
+
+void AtomInit()
+{
+    AtomTable::Init();
+}
+
+void AtomDone()
+{
+    AtomTable::Done();
+}
+
+} } // namespace gendoc::util
@@ -0,0 +1,76 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef GENDOC_UTIL_ATOM_INCLUDED
+#define GENDOC_UTIL_ATOM_INCLUDED
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+namespace gendoc { namespace util {
+
+// An atom is a 32-bit number that identifies an interned string: two strings are equal if and only if their atoms are equal.
+// The empty string is always atom 0. The table is shared by all threads.
+// The strings are divided into shards by their hash code, each shard having its own lock, so that threads interning different strings
+// seldom wait for each other. The low bits of an atom are the number of its shard and the high bits its index in that shard.
+
+typedef uint32_t Atom;
+
+const Atom emptyAtom = 0;
+const Atom noAtom = 0xFFFFFFFF;
+
+const int atomShardBits = 6;
+const int numAtomShards = 1 << atomShardBits;
+
+class AtomTable
+{
+public:
+    static void Init();
+    static void Done();
+    static AtomTable& Instance() { return *instance; }
+    Atom MakeAtom(const std::u32string& s);
+    Atom GetAtom(const std::u32string& s);
+    std::u32string GetString(Atom atom);
+private:
+    AtomTable();
+    static std::unique_ptr<AtomTable> instance;
+    struct Shard
+    {
+        std::mutex mtx;
+        std::unordered_map<std::u32string, Atom> atomMap;
+        std::vector<const std::u32string*> strings;
+    };
+    Shard shards[numAtomShards];
+    std::u32string emptyString;
+};
+
+// Returns the atom of string s, interning s first if necessary.
+
+inline Atom MakeAtom(const std::u32string& s)
+{
+    return AtomTable::Instance().MakeAtom(s);
+}
+
+// Returns the atom of string s, or noAtom if s has not been interned.
+
+inline Atom GetAtom(const std::u32string& s)
+{
+    return AtomTable::Instance().GetAtom(s);
+}
+
+inline std::u32string GetAtomString(Atom atom)
+{
+    return AtomTable::Instance().GetString(atom);
+}
+
+void AtomInit();
+void AtomDone();
+
+} } // namespace gendoc::util
+
+#endif // GENDOC_UTIL_ATOM_INCLUDED
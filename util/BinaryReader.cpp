@@ -11,7 +11,11 @@ namespace gendoc { namespace util {
 using namespace gendoc::unicode;
 
 BinaryReader::BinaryReader(const std::string& fileName_) : 
-    fileName(fileName_), file(fileName), begin(reinterpret_cast<const uint8_t*>(file.Begin())), end(reinterpret_cast<const uint8_t*>(file.End())), pos(0)
+    fileName(fileName_), file(new MappedInputFile(fileName)), begin(reinterpret_cast<const uint8_t*>(file->Begin())), end(reinterpret_cast<const uint8_t*>(file->End())), pos(0)
+{
+}
+
+BinaryReader::BinaryReader(const std::string& fileName_, const uint8_t* begin_, const uint8_t* end_) : fileName(fileName_), file(), begin(begin_), end(end_), pos(0)
 {
 }
 
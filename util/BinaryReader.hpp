@@ -7,6 +7,7 @@
 #define GENDOC_UTIL_BINARY_READER_INCLUDED
 #include <gendoc/util/MappedInputFile.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <memory>
 
 namespace gendoc { namespace util {
 
@@ -14,6 +15,7 @@ class BinaryReader
 {
 public:
     BinaryReader(const std::string& fileName_);
+    BinaryReader(const std::string& fileName_, const uint8_t* begin_, const uint8_t* end_);
     const std::string& FileName() const { return fileName; }
     virtual ~BinaryReader();
     bool ReadBool();
@@ -40,7 +42,7 @@ public:
     void Skip(uint32_t size);
 private:
     std::string fileName;
-    MappedInputFile file;
+    std::unique_ptr<MappedInputFile> file;
     const uint8_t* begin;
     const uint8_t* end;
     uint32_t pos;
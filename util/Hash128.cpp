@@ -0,0 +1,103 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/util/Hash128.hpp>
+#include <gendoc/util/TextUtils.hpp>
+#include <cstring>
+
+namespace gendoc { namespace util {
+
+inline uint64_t RotateLeft64(uint64_t x, int n)
+{
+    return (x << n) | (x >> (64 - n));
+}
+
+inline uint64_t FinalMix64(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xFF51AFD7ED558CCDu;
+    k ^= k >> 33;
+    k *= 0xC4CEB9FE1A85EC53u;
+    k ^= k >> 33;
+    return k;
+}
+
+inline uint64_t ReadBlock64(const uint8_t* p)
+{
+    uint64_t x;
+    std::memcpy(&x, p, sizeof(x));
+    return x;
+}
+
+std::string GetHash128Digest(const void* data, size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const uint64_t c1 = 0x87C37B91114253D5u;
+    const uint64_t c2 = 0x4CF5AD432745937Fu;
+    uint64_t h1 = 0u;
+    uint64_t h2 = 0u;
+    size_t numBlocks = size / 16;
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+        uint64_t k1 = ReadBlock64(bytes + 16 * i);
+        uint64_t k2 = ReadBlock64(bytes + 16 * i + 8);
+        k1 *= c1;
+        k1 = RotateLeft64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = RotateLeft64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5u + 0x52DCE729u;
+        k2 *= c2;
+        k2 = RotateLeft64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = RotateLeft64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5u + 0x38495AB5u;
+    }
+    const uint8_t* tail = bytes + 16 * numBlocks;
+    int tailSize = static_cast<int>(size & 15);
+    uint64_t k1 = 0u;
+    uint64_t k2 = 0u;
+    for (int i = tailSize - 1; i >= 8; --i)
+    {
+        k2 ^= uint64_t(tail[i]) << (8 * (i - 8));
+    }
+    if (tailSize > 8)
+    {
+        k2 *= c2;
+        k2 = RotateLeft64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+    }
+    for (int i = tailSize < 8 ? tailSize - 1 : 7; i >= 0; --i)
+    {
+        k1 ^= uint64_t(tail[i]) << (8 * i);
+    }
+    if (tailSize > 0)
+    {
+        k1 *= c1;
+        k1 = RotateLeft64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+    h1 ^= uint64_t(size);
+    h2 ^= uint64_t(size);
+    h1 += h2;
+    h2 += h1;
+    h1 = FinalMix64(h1);
+    h2 = FinalMix64(h2);
+    h1 += h2;
+    h2 += h1;
+    return ToHexString(h1) + ToHexString(h2);
+}
+
+std::string GetHash128Digest(const std::u32string& message)
+{
+    return GetHash128Digest(message.c_str(), message.length() * sizeof(message[0]));
+}
+
+} } // namespace gendoc::util
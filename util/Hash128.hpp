@@ -0,0 +1,20 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef GENDOC_UTIL_HASH128_INCLUDED
+#define GENDOC_UTIL_HASH128_INCLUDED
+#include <stdint.h>
+#include <string>
+
+namespace gendoc { namespace util {
+
+// Fast non-cryptographic 128-bit hash (MurmurHash3 x64 variant). Returns the hash as 32 hexadecimal digits.
+
+std::string GetHash128Digest(const void* data, size_t size);
+std::string GetHash128Digest(const std::u32string& message);
+
+} } // namespace gendoc::util
+
+#endif // GENDOC_UTIL_HASH128_INCLUDED
@@ -5,16 +5,19 @@
 
 #include <gendoc/util/InitDone.hpp>
 #include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/Atom.hpp>
 
 namespace gendoc { namespace util {
 
 void Init()
 {
     gendoc::unicode::UnicodeInit();
+    AtomInit();
 }
 
 void Done()
 {
+    AtomDone();
     gendoc::unicode::UnicodeDone();
 }
 
@@ -0,0 +1,76 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/util/Parallel.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace gendoc { namespace util {
+
+int GetNumberOfJobs(int numJobs)
+{
+    if (numJobs <= 0)
+    {
+        numJobs = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    return std::max(1, numJobs);
+}
+
+ParallelWork::~ParallelWork()
+{
+}
+
+void RunParallelWork(ParallelWork* work, int threadIndex, int numItems, std::atomic<int>* nextItem, std::vector<std::exception_ptr>* exceptions)
+{
+    int i = (*nextItem)++;
+    while (i < numItems)
+    {
+        try
+        {
+            work->Run(i, threadIndex);
+        }
+        catch (...)
+        {
+            (*exceptions)[i] = std::current_exception();
+        }
+        i = (*nextItem)++;
+    }
+}
+
+void ParallelFor(int numItems, int numThreads, ParallelWork& work)
+{
+    numThreads = std::min(numThreads, numItems);
+    if (numThreads <= 1)
+    {
+        for (int i = 0; i < numItems; ++i)
+        {
+            work.Run(i, 0);
+        }
+        return;
+    }
+    std::atomic<int> nextItem(0);
+    std::vector<std::exception_ptr> exceptions(numItems);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.push_back(std::thread(RunParallelWork, &work, t, numItems, &nextItem, &exceptions));
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    for (const std::exception_ptr& ex : exceptions)
+    {
+        if (ex)
+        {
+            std::rethrow_exception(ex);
+        }
+    }
+}
+
+} } // namespace gendoc::util
@@ -0,0 +1,26 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef GENDOC_UTIL_PARALLEL_INCLUDED
+#define GENDOC_UTIL_PARALLEL_INCLUDED
+
+namespace gendoc { namespace util {
+
+int GetNumberOfJobs(int numJobs);
+
+class ParallelWork
+{
+public:
+    virtual ~ParallelWork();
+    virtual void Run(int itemIndex, int threadIndex) = 0;
+};
+
+// Calls work.Run(itemIndex, threadIndex) for each itemIndex in [0, numItems) using numThreads threads.
+// Items are handed out in increasing order. If any call throws, the exception of the lowest failed item is rethrown after all threads have finished.
+void ParallelFor(int numItems, int numThreads, ParallelWork& work);
+
+} } // namespace gendoc::util
+
+#endif // GENDOC_UTIL_PARALLEL_INCLUDED
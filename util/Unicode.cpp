@@ -7,7 +7,10 @@
 #include <gendoc/util/TextUtils.hpp>
 #include <boost/filesystem.hpp>
 #include <cctype>
-#include <mutex>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GENDOC_UTIL_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace gendoc { namespace unicode {
 
@@ -197,161 +200,168 @@ void Utf8ToUtf32Engine::Put(uint8_t x)
     }
 }
 
-std::u32string ToUtf32(const std::string& utf8Str)
+inline char32_t DecodeUtf8Char(const char*& p, const char* end)
 {
-    std::u32string result;
-    const char* p = utf8Str.c_str();
-    int bytesRemaining = int(utf8Str.length());
-    while (bytesRemaining > 0)
+    uint8_t x = static_cast<uint8_t>(*p);
+    if ((x & 0x80u) == 0u)
     {
-        char c = *p;
-        uint8_t x = static_cast<uint8_t>(c);
-        if ((x & 0x80u) == 0u)
+        ++p;
+        return static_cast<char32_t>(static_cast<uint32_t>(x));
+    }
+    else if ((x & 0xE0u) == 0xC0u)
+    {
+        if (end - p < 2)
         {
-            result.append(1, static_cast<char32_t>(static_cast<uint32_t>(x)));
-            --bytesRemaining;
-            ++p;
+            throw UnicodeException("invalid UTF-8 sequence");
         }
-        else if ((x & 0xE0u) == 0xC0u)
+        uint8_t b1 = static_cast<uint8_t>(p[1]);
+        if ((b1 & 0xC0u) != 0x80u)
         {
-            if (bytesRemaining < 2)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            char32_t u = static_cast<char32_t>(static_cast<uint32_t>(0u));
-            uint8_t b1 = static_cast<uint8_t>(p[1]);
-            if ((b1 & 0xC0u) != 0x80u)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            uint8_t shift = 0u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b1 & 1u;
-                b1 = b1 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b0 = x;
-            for (uint8_t i = 0u; i < 5u; ++i)
-            {
-                uint8_t bit = b0 & 1u;
-                b0 = b0 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            result.append(1, u);
-            bytesRemaining = bytesRemaining - 2;
-            p = p + 2;
+            throw UnicodeException("invalid UTF-8 sequence");
         }
-        else if ((x & 0xF0u) == 0xE0u)
+        p = p + 2;
+        return static_cast<char32_t>(((static_cast<uint32_t>(x) & 0x1Fu) << 6u) | (static_cast<uint32_t>(b1) & 0x3Fu));
+    }
+    else if ((x & 0xF0u) == 0xE0u)
+    {
+        if (end - p < 3)
         {
-            if (bytesRemaining < 3)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            char32_t u = static_cast<char32_t>(static_cast<uint32_t>(0u));
-            uint8_t b2 = static_cast<uint8_t>(p[2]);
-            if ((b2 & 0xC0u) != 0x80u)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            uint8_t shift = 0u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b2 & 1u;
-                b2 = b2 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b1 = static_cast<uint8_t>(p[1]);
-            if ((b1 & 0xC0u) != 0x80u)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b1 & 1u;
-                b1 = b1 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b0 = x;
-            for (uint8_t i = 0u; i < 4u; ++i)
-            {
-                uint8_t bit = b0 & 1u;
-                b0 = b0 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            result.append(1, u);
-            bytesRemaining = bytesRemaining - 3;
-            p = p + 3;
+            throw UnicodeException("invalid UTF-8 sequence");
         }
-        else if ((x & 0xF8u) == 0xF0u)
+        uint8_t b1 = static_cast<uint8_t>(p[1]);
+        uint8_t b2 = static_cast<uint8_t>(p[2]);
+        if ((b1 & 0xC0u) != 0x80u || (b2 & 0xC0u) != 0x80u)
         {
-            if (bytesRemaining < 4)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            char32_t u = static_cast<char32_t>(static_cast<uint32_t>(0u));
-            uint8_t b3 = static_cast<uint8_t>(p[3]);
-            if ((b3 & 0xC0u) != 0x80u)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            uint8_t shift = 0u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b3 & 1u;
-                b3 = b3 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b2 = static_cast<uint8_t>(p[2]);
-            if ((b2 & 0xC0u) != 0x80u)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b2 & 1u;
-                b2 = b2 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b1 = static_cast<uint8_t>(p[1]);
-            if ((b1 & 0xC0u) != 0x80u)
-            {
-                throw UnicodeException("invalid UTF-8 sequence");
-            }
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                uint8_t bit = b1 & 1u;
-                b1 = b1 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            uint8_t b0 = x;
-            for (uint8_t i = 0u; i < 3u; ++i)
-            {
-                uint8_t bit = b0 & 1u;
-                b0 = b0 >> 1u;
-                u = static_cast<char32_t>(static_cast<uint32_t>(u) | (static_cast<uint32_t>(bit) << shift));
-                ++shift;
-            }
-            result.append(1, u);
-            bytesRemaining = bytesRemaining - 4;
-            p = p + 4;
+            throw UnicodeException("invalid UTF-8 sequence");
         }
-        else
+        p = p + 3;
+        return static_cast<char32_t>(((static_cast<uint32_t>(x) & 0x0Fu) << 12u) | ((static_cast<uint32_t>(b1) & 0x3Fu) << 6u) | (static_cast<uint32_t>(b2) & 0x3Fu));
+    }
+    else if ((x & 0xF8u) == 0xF0u)
+    {
+        if (end - p < 4)
+        {
+            throw UnicodeException("invalid UTF-8 sequence");
+        }
+        uint8_t b1 = static_cast<uint8_t>(p[1]);
+        uint8_t b2 = static_cast<uint8_t>(p[2]);
+        uint8_t b3 = static_cast<uint8_t>(p[3]);
+        if ((b1 & 0xC0u) != 0x80u || (b2 & 0xC0u) != 0x80u || (b3 & 0xC0u) != 0x80u)
         {
             throw UnicodeException("invalid UTF-8 sequence");
         }
+        p = p + 4;
+        return static_cast<char32_t>(((static_cast<uint32_t>(x) & 0x07u) << 18u) | ((static_cast<uint32_t>(b1) & 0x3Fu) << 12u) | 
+            ((static_cast<uint32_t>(b2) & 0x3Fu) << 6u) | (static_cast<uint32_t>(b3) & 0x3Fu));
     }
+    else
+    {
+        throw UnicodeException("invalid UTF-8 sequence");
+    }
+}
+
+// Decodes UTF-8 from p until end or until q reaches qEnd, and returns the new q. Blocks of 16 ASCII bytes are widened to UTF-32 with SSE2.
+// A block containing other bytes is decoded one character at a time.
+
+char32_t* DecodeUtf8(const char*& p, const char* end, char32_t* q, const char32_t* qEnd)
+{
+#ifdef GENDOC_UTIL_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    while (end - p >= 16 && qEnd - q >= 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        if (_mm_movemask_epi8(bytes) == 0)
+        {
+            __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            __m128i high = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(q), _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(q + 4), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(q + 8), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(q + 12), _mm_unpackhi_epi16(high, zero));
+            p = p + 16;
+            q = q + 16;
+        }
+        else
+        {
+            const char* blockEnd = p + 16;
+            while (p < blockEnd)
+            {
+                *q++ = DecodeUtf8Char(p, end);
+            }
+        }
+    }
+#endif
+    while (p != end && q != qEnd)
+    {
+        *q++ = DecodeUtf8Char(p, end);
+    }
+    return q;
+}
+
+std::u32string ToUtf32(const char* begin, const char* end)
+{
+    std::u32string result;
+    result.resize(end - begin);
+    const char* p = begin;
+    char32_t* q = DecodeUtf8(p, end, &result[0], result.data() + result.length());
+    result.resize(q - result.data());
     return result;
 }
 
+// Every byte that is not a continuation byte starts a code point.
+
+int CountUtf8CodePoints(const char* begin, const char* end)
+{
+    int n = 0;
+    for (const char* p = begin; p != end; ++p)
+    {
+        if ((static_cast<uint8_t>(*p) & 0xC0u) != 0x80u)
+        {
+            ++n;
+        }
+    }
+    return n;
+}
+
+const int lazyDecodeBlockSize = 4096;
+
+LazyUtf32Text::LazyUtf32Text(const char* begin_, const char* end_) : next(begin_), end(end_), text(CountUtf8CodePoints(begin_, end_), U'\0'), decodedEnd(&text[0])
+{
+}
+
+const char32_t* LazyUtf32Text::Decode(const char32_t* pos)
+{
+    const char32_t* textEnd = End();
+    if (pos < decodedEnd || decodedEnd == textEnd)
+    {
+        return decodedEnd;
+    }
+    const char32_t* decodeEnd = textEnd;
+    if (textEnd - pos > lazyDecodeBlockSize)
+    {
+        decodeEnd = pos + lazyDecodeBlockSize;
+    }
+    decodedEnd = DecodeUtf8(next, end, decodedEnd, decodeEnd);
+    if (decodedEnd != decodeEnd)
+    {
+        throw UnicodeException("invalid UTF-8 sequence");
+    }
+    return decodedEnd;
+}
+
+void LazyUtf32Text::DecodeAll()
+{
+    if (decodedEnd != End())
+    {
+        Decode(End() - 1);
+    }
+}
+
+std::u32string ToUtf32(const std::string& utf8Str)
+{
+    return ToUtf32(utf8Str.data(), utf8Str.data() + utf8Str.length());
+}
+
 std::u32string ToUtf32(const std::u16string& utf16Str)
 {
     std::u32string result;
@@ -441,93 +451,90 @@ std::u16string ToUtf16(const std::string& utf8Str)
     return ToUtf16(ToUtf32(utf8Str));
 }
 
+inline void EncodeUtf8Char(char32_t c, char*& q)
+{
+    uint32_t x = static_cast<uint32_t>(c);
+    if (x < 0x80u)
+    {
+        *q++ = static_cast<char>(x);
+    }
+    else if (x < 0x800u)
+    {
+        *q++ = static_cast<char>(0xC0u | (x >> 6u));
+        *q++ = static_cast<char>(0x80u | (x & 0x3Fu));
+    }
+    else if (x < 0x10000u)
+    {
+        *q++ = static_cast<char>(0xE0u | (x >> 12u));
+        *q++ = static_cast<char>(0x80u | ((x >> 6u) & 0x3Fu));
+        *q++ = static_cast<char>(0x80u | (x & 0x3Fu));
+    }
+    else if (x < 0x110000u)
+    {
+        *q++ = static_cast<char>(0xF0u | (x >> 18u));
+        *q++ = static_cast<char>(0x80u | ((x >> 12u) & 0x3Fu));
+        *q++ = static_cast<char>(0x80u | ((x >> 6u) & 0x3Fu));
+        *q++ = static_cast<char>(0x80u | (x & 0x3Fu));
+    }
+    else
+    {
+        throw UnicodeException("invalid UTF-32 code point");
+    }
+}
+
+inline int Utf8Length(const char32_t* p, const char32_t* end)
+{
+    int length = 0;
+    while (p != end)
+    {
+        uint32_t x = static_cast<uint32_t>(*p++);
+        length += 1 + (x >= 0x80u) + (x >= 0x800u) + (x >= 0x10000u);
+    }
+    return length;
+}
+
+// The result is sized exactly before encoding, so the returned string carries no spare capacity.
+// Blocks of 16 ASCII code points are narrowed to bytes with SSE2. A block containing other code points is encoded one character at a time.
+
 std::string ToUtf8(const std::u32string& utf32Str)
 {
     std::string result;
-    for (char32_t c : utf32Str)
-    {
-        uint32_t x = static_cast<uint32_t>(c);
-        if (x < 0x80u)
+    const char32_t* p = utf32Str.data();
+    const char32_t* end = p + utf32Str.length();
+    result.resize(Utf8Length(p, end));
+    if (result.empty()) return result;
+    char* q = &result[0];
+#ifdef GENDOC_UTIL_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonAsciiBits = _mm_set1_epi32(~0x7F);
+    while (end - p >= 16)
+    {
+        __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4));
+        __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+        __m128i c3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 12));
+        __m128i all = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, nonAsciiBits), zero)) == 0xFFFF)
         {
-            result.append(1, static_cast<char>(x & 0x7Fu));
+            __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(q), bytes);
+            p = p + 16;
+            q = q + 16;
         }
-        else if (x < 0x800u)
-        {
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xC0u;
-            for (uint8_t i = 0u; i < 5u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char>(b0));
-            result.append(1, static_cast<char>(b1));
-        }
-        else if (x < 0x10000u)
-        {
-            uint8_t b2 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b2 = b2 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b0 = 0xE0u;
-            for (uint8_t i = 0u; i < 4u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char>(b0));
-            result.append(1, static_cast<char>(b1));
-            result.append(1, static_cast<char>(b2));
-        }
-        else if (x < 0x110000u)
+        else
         {
-            uint8_t b3 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b3 = b3 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b2 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
-            {
-                b2 = b2 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            uint8_t b1 = 0x80u;
-            for (uint8_t i = 0u; i < 6u; ++i)
+            const char32_t* blockEnd = p + 16;
+            while (p < blockEnd)
             {
-                b1 = b1 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
+                EncodeUtf8Char(*p++, q);
             }
-            uint8_t b0 = 0xF0u;
-            for (uint8_t i = 0u; i < 3u; ++i)
-            {
-                b0 = b0 | (static_cast<uint8_t>(x & 1u) << i);
-                x = x >> 1u;
-            }
-            result.append(1, static_cast<char>(b0));
-            result.append(1, static_cast<char>(b1));
-            result.append(1, static_cast<char>(b2));
-            result.append(1, static_cast<char>(b3));
-        }
-        else
-        {
-            throw UnicodeException("invalid UTF-32 code point");
         }
     }
+#endif
+    while (p != end)
+    {
+        EncodeUtf8Char(*p++, q);
+    }
     return result;
 }
 
@@ -1058,7 +1065,7 @@ std::unique_ptr<GeneralCategoryTable> GeneralCategoryTable::instance;
 GeneralCategoryTable::GeneralCategoryTable()
 {
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lu, "Lu", "Uppercase Letter"));
-    generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lu, "Ll", "Lowercase Letter"));
+    generalCategories.push_back(GeneralCategory(GeneralCategoryId::Ll, "Ll", "Lowercase Letter"));
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lt, "Lt", "Titlecase Letter"));
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::LC, "LC", "Cased Letter"));
     generalCategories.push_back(GeneralCategory(GeneralCategoryId::Lm, "Lm", "Modifier Letter"));
@@ -2012,8 +2019,22 @@ std::string GenDocUcdFilePath()
     return (boost::filesystem::path(GenDocRoot()) / boost::filesystem::path("unicode") / boost::filesystem::path("gendoc_ucd.bin")).generic_string();
 }
 
-CharacterTable::CharacterTable() : headerRead(false), extendedHeaderStart(0), extendedHeaderEnd(0), extendedHeaderRead(false)
+CharacterTable::CharacterTable() : numPages(0), extendedHeaderStart(0), extendedHeaderEnd(0), numExtendedPages(0)
+{
+    for (int i = 0; i < numCharacterInfoPages; ++i)
+    {
+        pages[i].store(nullptr, std::memory_order_relaxed);
+        extendedPages[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+CharacterTable::~CharacterTable()
 {
+    for (int i = 0; i < numCharacterInfoPages; ++i)
+    {
+        delete pages[i].load(std::memory_order_relaxed);
+        delete extendedPages[i].load(std::memory_order_relaxed);
+    }
 }
 
 void CharacterTable::Write()
@@ -2021,21 +2042,20 @@ void CharacterTable::Write()
     std::string ucdFilePath = GenDocUcdFilePath();
     BinaryWriter writer(ucdFilePath);
     WriteHeader(writer);
-    int n = pages.size();
-    for (int i = 0; i < n; ++i)
+    for (int i = 0; i < numPages; ++i)
     {
-        CharacterInfoPage* page = pages[i].get();
+        CharacterInfoPage* page = pages[i].load(std::memory_order_relaxed);
         page->Write(writer);
     }
     extendedHeaderStart = writer.Pos();
-    int nx = extendedPages.size();
+    int nx = numExtendedPages;
     extendedHeader.AllocatePages(nx);
     extendedHeader.Write(writer);
     extendedHeaderEnd = writer.Pos();
     for (int i = 0; i < nx; ++i)
     {
         extendedHeader.SetPageStart(i, writer.Pos());
-        ExtendedCharacterInfoPage* extendedPage = extendedPages[i].get();
+        ExtendedCharacterInfoPage* extendedPage = extendedPages[i].load(std::memory_order_relaxed);
         extendedPage->Write(writer);
     }
     writer.Seek(extendedHeaderStart);
@@ -2056,7 +2076,6 @@ void CharacterTable::WriteHeader(BinaryWriter& writer)
 
 void CharacterTable::ReadHeader(BinaryReader& reader)
 {
-    headerRead = true;
     uint8_t magic[8];
     for (int i = 0; i < 8; ++i)
     {
@@ -2079,53 +2098,94 @@ void CharacterTable::ReadHeader(BinaryReader& reader)
 
 void CharacterTable::ReadExtendedHeader(BinaryReader& reader)
 {
-    extendedHeaderRead = true;
     extendedHeader.Read(reader);
 }
 
-std::mutex mtx;
+// Maps gendoc_ucd.bin once and reads its headers. Pages are then decoded directly from the mapped file.
 
-const CharacterInfo& CharacterTable::GetCharacterInfo(char32_t codePoint)
+void CharacterTable::OpenUcdFile()
 {
-    if (codePoint > 0x10FFFF)
+    ucdFilePath = GenDocUcdFilePath();
+    std::unique_ptr<MappedInputFile> file(new MappedInputFile(ucdFilePath));
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(file->Begin());
+    const uint8_t* end = reinterpret_cast<const uint8_t*>(file->End());
+    BinaryReader headerReader(ucdFilePath, begin, end);
+    ReadHeader(headerReader);
+    if (extendedHeaderStart > static_cast<size_t>(end - begin))
     {
-        throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+        throw UnicodeException("invalid gendoc_ucd.bin extended header start");
     }
-    int pageIndex = codePoint / numInfosInPage;
-    if (pages.size() <= pageIndex)
+    BinaryReader extendedHeaderReader(ucdFilePath, begin + extendedHeaderStart, end);
+    ReadExtendedHeader(extendedHeaderReader);
+    ucdFile = std::move(file);
+}
+
+// Pages are published with a compare-and-swap, so lookups never take a lock. 
+// If two threads decode the same page at the same time, the loser deletes its copy.
+
+CharacterInfoPage* CharacterTable::LoadPage(int pageIndex)
+{
+    std::call_once(ucdFileOpened, &CharacterTable::OpenUcdFile, this);
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(ucdFile->Begin());
+    size_t pageStart = headerSize + characterInfoPageSize * pageIndex;
+    if (pageStart + characterInfoPageSize > extendedHeaderStart)
+    {
+        throw UnicodeException("gendoc_ucd.bin does not contain character info page " + std::to_string(pageIndex));
+    }
+    BinaryReader reader(ucdFilePath, begin + pageStart, begin + pageStart + characterInfoPageSize);
+    std::unique_ptr<CharacterInfoPage> page(new CharacterInfoPage());
+    page->Read(reader);
+    CharacterInfoPage* expected = nullptr;
+    if (pages[pageIndex].compare_exchange_strong(expected, page.get(), std::memory_order_acq_rel, std::memory_order_acquire))
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        while (pages.size() <= pageIndex)
+        return page.release();
+    }
+    return expected;
+}
+
+ExtendedCharacterInfoPage* CharacterTable::LoadExtendedPage(int pageIndex)
+{
+    std::call_once(ucdFileOpened, &CharacterTable::OpenUcdFile, this);
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(ucdFile->Begin());
+    const uint8_t* end = reinterpret_cast<const uint8_t*>(ucdFile->End());
+    uint32_t pageStart = extendedHeader.GetPageStart(pageIndex);
+    if (pageStart > static_cast<size_t>(end - begin))
+    {
+        throw UnicodeException("invalid gendoc_ucd.bin extended page start");
+    }
+    BinaryReader reader(ucdFilePath, begin + pageStart, end);
+    std::unique_ptr<ExtendedCharacterInfoPage> extendedPage(new ExtendedCharacterInfoPage());
+    extendedPage->Read(reader);
+    ExtendedCharacterInfoPage* expected = nullptr;
+    if (extendedPages[pageIndex].compare_exchange_strong(expected, extendedPage.get(), std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        return extendedPage.release();
+    }
+    return expected;
+}
+
+// Decodes every character info page and every extended character info page up front, so that the whole cost is paid at startup
+// instead of at the first lookups. gendoc calls this when given --load-unicode.
+
+void CharacterTable::LoadAll()
+{
+    std::call_once(ucdFileOpened, &CharacterTable::OpenUcdFile, this);
+    int n = static_cast<int>((extendedHeaderStart - headerSize) / characterInfoPageSize);
+    for (int i = 0; i < n && i < numCharacterInfoPages; ++i)
+    {
+        if (!pages[i].load(std::memory_order_acquire))
         {
-            pages.push_back(std::unique_ptr<CharacterInfoPage>());
+            LoadPage(i);
         }
     }
-    CharacterInfoPage* page = pages[pageIndex].get();
-    if (!page)
+    int nx = extendedHeader.NumPages();
+    for (int i = 0; i < nx && i < numCharacterInfoPages; ++i)
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        if (!page)
+        if (!extendedPages[i].load(std::memory_order_acquire))
         {
-            std::string ucdFilePath = GenDocUcdFilePath();
-            BinaryReader reader(ucdFilePath);
-            uint32_t pageStart = 0;
-            if (!headerRead)
-            {
-                ReadHeader(reader);
-                pageStart = characterInfoPageSize * pageIndex;
-            }
-            else
-            {
-                pageStart = headerSize + characterInfoPageSize * pageIndex;
-            }
-            reader.Skip(pageStart);
-            page = new CharacterInfoPage();
-            page->Read(reader);
-            pages[pageIndex] = std::move(std::unique_ptr<CharacterInfoPage>(page));
+            LoadExtendedPage(i);
         }
     }
-    int infoIndex = codePoint % numInfosInPage;
-    return page->GetCharacterInfo(infoIndex);
 }
 
 CharacterInfo& CharacterTable::CreateCharacterInfo(char32_t codePoint)
@@ -2135,12 +2195,13 @@ CharacterInfo& CharacterTable::CreateCharacterInfo(char32_t codePoint)
         throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
     }
     int pageIndex = codePoint / numInfosInPage;
-    while (pages.size() <= pageIndex)
+    while (numPages <= pageIndex)
     {
-        pages.push_back(std::unique_ptr<CharacterInfoPage>(new CharacterInfoPage()));
+        pages[numPages].store(new CharacterInfoPage(), std::memory_order_release);
+        ++numPages;
     }
     int infoIndex = codePoint % numInfosInPage;
-    CharacterInfoPage* page = pages[pageIndex].get();
+    CharacterInfoPage* page = pages[pageIndex].load(std::memory_order_relaxed);
     return page->GetCharacterInfo(infoIndex);
 }
 
@@ -2151,48 +2212,10 @@ const ExtendedCharacterInfo& CharacterTable::GetExtendedCharacterInfo(char32_t c
         throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
     }
     int pageIndex = codePoint / numInfosInPage;
-    if (extendedPages.size() <= pageIndex)
-    {
-        std::lock_guard<std::mutex> lock(mtx);
-        while (extendedPages.size() <= pageIndex)
-        {
-            extendedPages.push_back(std::unique_ptr<ExtendedCharacterInfoPage>());
-        }
-    }
-    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].get();
+    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].load(std::memory_order_acquire);
     if (!extendedPage)
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        if (!extendedPage)
-        {
-            std::string ucdFilePath = GenDocUcdFilePath();
-            BinaryReader reader(ucdFilePath);
-            uint32_t start = 0;
-            uint32_t pageStart = 0;
-            if (!headerRead)
-            {
-                ReadHeader(reader);
-                start = extendedHeaderStart - headerSize;
-            }
-            else
-            {
-                start = extendedHeaderStart;
-            }
-            if (!extendedHeaderRead)
-            {
-                reader.Skip(start);
-                ReadExtendedHeader(reader);
-                pageStart = extendedHeader.GetPageStart(pageIndex) - extendedHeaderEnd;
-            }
-            else
-            {
-                pageStart = extendedHeader.GetPageStart(pageIndex);
-            }
-            reader.Skip(pageStart);
-            extendedPage = new ExtendedCharacterInfoPage();
-            extendedPage->Read(reader);
-            extendedPages[pageIndex] = std::move(std::unique_ptr<ExtendedCharacterInfoPage>(extendedPage));
-        }
+        extendedPage = LoadExtendedPage(pageIndex);
     }
     int infoIndex = codePoint % numInfosInPage;
     return extendedPage->GetExtendedCharacterInfo(infoIndex);
@@ -2205,12 +2228,13 @@ ExtendedCharacterInfo& CharacterTable::CreateExtendedCharacterInfo(char32_t code
         throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
     }
     int pageIndex = codePoint / numInfosInPage;
-    while (extendedPages.size() <= pageIndex)
+    while (numExtendedPages <= pageIndex)
     {
-        extendedPages.push_back(std::unique_ptr<ExtendedCharacterInfoPage>(new ExtendedCharacterInfoPage()));
+        extendedPages[numExtendedPages].store(new ExtendedCharacterInfoPage(), std::memory_order_release);
+        ++numExtendedPages;
     }
     int infoIndex = codePoint % numInfosInPage;
-    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].get();
+    ExtendedCharacterInfoPage* extendedPage = extendedPages[pageIndex].load(std::memory_order_relaxed);
     return extendedPage->GetExtendedCharacterInfo(infoIndex);
 }
 
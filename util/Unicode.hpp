@@ -7,6 +7,8 @@
 #define GENDOC_UNICODE_UNICODE_INCLUDED
 #include <gendoc/util/BinaryWriter.hpp>
 #include <gendoc/util/BinaryReader.hpp>
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -39,6 +41,29 @@ private:
     uint8_t bytes[4];
 };
 
+// UTF-32 text of UTF-8 input that is decoded on demand. The code points are counted when the text is created, so End() and the offsets
+// into the text are those of the fully decoded text, but the characters are decoded only when Decode is called for them.
+
+class LazyUtf32Text
+{
+public:
+    LazyUtf32Text(const char* begin_, const char* end_);
+    LazyUtf32Text(const LazyUtf32Text&) = delete;
+    LazyUtf32Text& operator=(const LazyUtf32Text&) = delete;
+    const char32_t* Start() const { return text.c_str(); }
+    const char32_t* End() const { return text.c_str() + text.length(); }
+    const char32_t* DecodedEnd() const { return decodedEnd; }
+    const char32_t* Decode(const char32_t* pos);
+    void DecodeAll();
+    std::u32string& Text() { DecodeAll(); return text; }
+private:
+    const char* next;
+    const char* end;
+    std::u32string text;
+    char32_t* decodedEnd;
+};
+
+std::u32string ToUtf32(const char* begin, const char* end);
 std::u32string ToUtf32(const std::string& utf8Str);
 std::u32string ToUtf32(const std::u16string& utf16Str);
 std::u16string ToUtf16(const std::u32string& utf32Str);
@@ -1011,6 +1036,7 @@ public:
     void AllocatePages(int numExtendedPages);
     void Write(BinaryWriter& writer);
     void Read(BinaryReader& reader);
+    int NumPages() const { return static_cast<int>(extendedPageStarts.size()); }
     uint32_t GetPageStart(int pageIndex) const;
     void SetPageStart(int pageIndex, uint32_t extendedPageStart);
 private:
@@ -1020,27 +1046,50 @@ private:
 const uint8_t gendoc_ucd_version_1 = '1';
 const uint8_t current_gendoc_ucd_version = gendoc_ucd_version_1;
 
+constexpr int numCharacterInfoPages = 0x110000 / numInfosInPage;
+
 class CharacterTable
 {
 public:
     static void Init();
     static void Done();
     static CharacterTable& Instance() { return *instance; }
-    const CharacterInfo& GetCharacterInfo(char32_t codePoint);
+    ~CharacterTable();
+    const CharacterInfo& GetCharacterInfo(char32_t codePoint)
+    {
+        if (codePoint > 0x10FFFF)
+        {
+            throw UnicodeException("invalid Unicode code point " + std::to_string(codePoint));
+        }
+        int pageIndex = codePoint / numInfosInPage;
+        CharacterInfoPage* page = pages[pageIndex].load(std::memory_order_acquire);
+        if (!page)
+        {
+            page = LoadPage(pageIndex);
+        }
+        return page->GetCharacterInfo(codePoint % numInfosInPage);
+    }
     CharacterInfo& CreateCharacterInfo(char32_t codePoint);
     const ExtendedCharacterInfo& GetExtendedCharacterInfo(char32_t codePoint);
     ExtendedCharacterInfo& CreateExtendedCharacterInfo(char32_t codePoint);
+    void LoadAll();
     void Write();
 private:
     static std::unique_ptr<CharacterTable> instance;
     CharacterTable();
-    bool headerRead;
-    std::vector<std::unique_ptr<CharacterInfoPage>> pages;
+    std::string ucdFilePath;
+    std::unique_ptr<MappedInputFile> ucdFile;
+    std::once_flag ucdFileOpened;
+    int numPages;
+    std::atomic<CharacterInfoPage*> pages[numCharacterInfoPages];
     uint32_t extendedHeaderStart;
     uint32_t extendedHeaderEnd;
-    bool extendedHeaderRead;
     ExtendedCharacterInfoHeader extendedHeader;
-    std::vector<std::unique_ptr<ExtendedCharacterInfoPage>> extendedPages;
+    int numExtendedPages;
+    std::atomic<ExtendedCharacterInfoPage*> extendedPages[numCharacterInfoPages];
+    void OpenUcdFile();
+    CharacterInfoPage* LoadPage(int pageIndex);
+    ExtendedCharacterInfoPage* LoadExtendedPage(int pageIndex);
     void WriteHeader(BinaryWriter& writer);
     void ReadHeader(BinaryReader& reader);
     void ReadExtendedHeader(BinaryReader& reader);
@@ -1052,8 +1101,101 @@ inline CharacterInfo& CreateCharacterInfo(char32_t codePoint) { return Character
 inline const ExtendedCharacterInfo& GetExtendedCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().GetExtendedCharacterInfo(codePoint); }
 inline ExtendedCharacterInfo& CreateExtendedCharacterInfo(char32_t codePoint) { return CharacterTable::Instance().CreateExtendedCharacterInfo(codePoint); }
 
-inline GeneralCategoryId GetGeneralCategory(char32_t c) { return GetCharacterInfo(c).GetGeneralCategory(); }
-inline bool HasGeneralCategory(char32_t c, GeneralCategoryId generalCategory) { return GetCharacterInfo(c).HasGeneralCategory(generalCategory);  }
+// Properties of the Latin-1 range are computed at compile time, so that the predicates below do not touch the character table for these characters.
+
+constexpr GeneralCategoryId Latin1GeneralCategory(int c)
+{
+    if (c < 0x20 || (c >= 0x7F && c < 0xA0)) return GeneralCategoryId::Cc;
+    if (c == 0x20 || c == 0xA0) return GeneralCategoryId::Zs;
+    if (c >= '0' && c <= '9') return GeneralCategoryId::Nd;
+    if ((c >= 'A' && c <= 'Z') || (c >= 0xC0 && c <= 0xDE && c != 0xD7)) return GeneralCategoryId::Lu;
+    if ((c >= 'a' && c <= 'z') || c == 0xB5 || (c >= 0xDF && c != 0xF7)) return GeneralCategoryId::Ll;
+    switch (c)
+    {
+        case '(': case '[': case '{': return GeneralCategoryId::Ps;
+        case ')': case ']': case '}': return GeneralCategoryId::Pe;
+        case '-': return GeneralCategoryId::Pd;
+        case '_': return GeneralCategoryId::Pc;
+        case 0xAB: return GeneralCategoryId::Pi;
+        case 0xBB: return GeneralCategoryId::Pf;
+        case '+': case '<': case '=': case '>': case '|': case '~': case 0xAC: case 0xB1: case 0xD7: case 0xF7: return GeneralCategoryId::Sm;
+        case '$': case 0xA2: case 0xA3: case 0xA4: case 0xA5: return GeneralCategoryId::Sc;
+        case '^': case '`': case 0xA8: case 0xAF: case 0xB4: case 0xB8: return GeneralCategoryId::Sk;
+        case 0xA6: case 0xA9: case 0xAE: case 0xB0: return GeneralCategoryId::So;
+        case 0xAA: case 0xBA: return GeneralCategoryId::Lo;
+        case 0xB2: case 0xB3: case 0xB9: case 0xBC: case 0xBD: case 0xBE: return GeneralCategoryId::No;
+        case 0xAD: return GeneralCategoryId::Cf;
+    }
+    return GeneralCategoryId::Po;
+}
+
+constexpr uint64_t BinaryPropertyBit(BinaryPropertyId binaryPropertyId)
+{
+    return static_cast<uint64_t>(1) << static_cast<uint64_t>(binaryPropertyId);
+}
+
+constexpr uint64_t Latin1BinaryProperties(int c)
+{
+    uint64_t properties = 0;
+    GeneralCategoryId generalCategory = Latin1GeneralCategory(c);
+    bool letter = generalCategory == GeneralCategoryId::Lu || generalCategory == GeneralCategoryId::Ll || generalCategory == GeneralCategoryId::Lo;
+    if (letter)
+    {
+        properties |= BinaryPropertyBit(BinaryPropertyId::alphabetic) | BinaryPropertyBit(BinaryPropertyId::idStart) | BinaryPropertyBit(BinaryPropertyId::idContinue);
+    }
+    if (generalCategory == GeneralCategoryId::Nd || c == '_' || c == 0xB7)
+    {
+        properties |= BinaryPropertyBit(BinaryPropertyId::idContinue);
+    }
+    if (generalCategory == GeneralCategoryId::Lu)
+    {
+        properties |= BinaryPropertyBit(BinaryPropertyId::uppercase);
+    }
+    if (generalCategory == GeneralCategoryId::Ll || c == 0xAA || c == 0xBA)
+    {
+        properties |= BinaryPropertyBit(BinaryPropertyId::lowercase);
+    }
+    if ((c >= 0x09 && c <= 0x0D) || c == 0x20 || c == 0x85 || c == 0xA0)
+    {
+        properties |= BinaryPropertyBit(BinaryPropertyId::whiteSpace);
+    }
+    if ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'))
+    {
+        properties |= BinaryPropertyBit(BinaryPropertyId::asciiHexDigit);
+    }
+    return properties;
+}
+
+class Latin1PropertyTable
+{
+public:
+    constexpr Latin1PropertyTable() : generalCategories(), binaryProperties()
+    {
+        for (int c = 0; c < 256; ++c)
+        {
+            generalCategories[c] = Latin1GeneralCategory(c);
+            binaryProperties[c] = Latin1BinaryProperties(c);
+        }
+    }
+    constexpr GeneralCategoryId GetGeneralCategory(char32_t c) const { return generalCategories[c]; }
+    constexpr bool GetBinaryProperty(char32_t c, BinaryPropertyId binaryPropertyId) const { return (binaryProperties[c] & BinaryPropertyBit(binaryPropertyId)) != 0; }
+private:
+    GeneralCategoryId generalCategories[256];
+    uint64_t binaryProperties[256];
+};
+
+constexpr Latin1PropertyTable latin1PropertyTable;
+
+inline GeneralCategoryId GetGeneralCategory(char32_t c) 
+{ 
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetGeneralCategory(c);
+    }
+    return GetCharacterInfo(c).GetGeneralCategory(); 
+}
+
+inline bool HasGeneralCategory(char32_t c, GeneralCategoryId generalCategory) { return (GetGeneralCategory(c) & generalCategory) != GeneralCategoryId::none; }
 
 inline bool IsUpperLetter(char32_t c)
 {
@@ -1302,16 +1444,28 @@ inline const std::u32string& FullFolding(char32_t c)
 
 inline bool IsWhiteSpace(char32_t c)
 {
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::whiteSpace);
+    }
     return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::whiteSpace);
 }
 
 inline bool IsAlphabetic(char32_t c)
 {
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::alphabetic);
+    }
     return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::alphabetic);
 }
 
 inline bool IsAsciiHexDigit(char32_t c)
 {
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::asciiHexDigit);
+    }
     return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::asciiHexDigit);
 }
 
@@ -1319,21 +1473,37 @@ bool IsAsciiDigit(char32_t c);
 
 inline bool IsUppercase(char32_t c)
 {
-    GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::uppercase);
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::uppercase);
+    }
+    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::uppercase);
 }
 
 inline bool IsLowercase(char32_t c)
 {
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::lowercase);
+    }
     return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::lowercase);
 }
 
 inline bool IsIdStart(char32_t c)
 {
-    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idStart); 
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::idStart);
+    }
+    return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idStart);
 }
 
 inline bool IsIdCont(char32_t c)
 {
+    if (c < 256)
+    {
+        return latin1PropertyTable.GetBinaryProperty(c, BinaryPropertyId::idContinue);
+    }
     return GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idContinue);
 }
 
@@ -0,0 +1,291 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/util/InitDone.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/MappedInputFile.hpp>
+#include <gendoc/util/Path.hpp>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Micro-benchmarks of the util library run over a set of source files, typically the sources of this repository.
+// Each benchmark times the current implementation against the path it replaced and checks that both give the same results.
+
+using namespace gendoc::util;
+using namespace gendoc::unicode;
+
+struct InitDone
+{
+    InitDone()
+    {
+        gendoc::util::Init();
+    }
+    ~InitDone()
+    {
+        gendoc::util::Done();
+    }
+};
+
+void CollectSourceFiles(const std::string& path, std::vector<std::string>& sourceFilePaths)
+{
+    if (boost::filesystem::is_directory(path))
+    {
+        for (boost::filesystem::recursive_directory_iterator it(path), end; it != end; ++it)
+        {
+            std::string extension = it->path().extension().generic_string();
+            if (boost::filesystem::is_regular_file(it->path()) && (extension == ".cpp" || extension == ".hpp"))
+            {
+                sourceFilePaths.push_back(GetFullPath(it->path().generic_string()));
+            }
+        }
+    }
+    else
+    {
+        sourceFilePaths.push_back(GetFullPath(path));
+    }
+}
+
+double Milliseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+}
+
+// Counts the characters that satisfy the predicates the C++ and XML scanners use most: the table versions below U+0100 and
+// the same predicates read from the paged character table for every character.
+
+struct ClassifyCounts
+{
+    ClassifyCounts() : idStart(0), idCont(0), whiteSpace(0), letter(0), lowerLetter(0), upper(0), lower(0), hexDigit(0) {}
+    bool operator==(const ClassifyCounts& that) const
+    {
+        return idStart == that.idStart && idCont == that.idCont && whiteSpace == that.whiteSpace && letter == that.letter && lowerLetter == that.lowerLetter && upper == that.upper && lower == that.lower &&
+            hexDigit == that.hexDigit;
+    }
+    int64_t idStart;
+    int64_t idCont;
+    int64_t whiteSpace;
+    int64_t letter;
+    int64_t lowerLetter;
+    int64_t upper;
+    int64_t lower;
+    int64_t hexDigit;
+};
+
+ClassifyCounts ClassifyWithLatin1Table(const std::u32string& text)
+{
+    ClassifyCounts counts;
+    for (char32_t c : text)
+    {
+        if (IsIdStart(c)) ++counts.idStart;
+        if (IsIdCont(c)) ++counts.idCont;
+        if (IsWhiteSpace(c)) ++counts.whiteSpace;
+        if (IsLetter(c)) ++counts.letter;
+        if (IsLowerLetter(c)) ++counts.lowerLetter;
+        if (IsUppercase(c)) ++counts.upper;
+        if (IsLowercase(c)) ++counts.lower;
+        if (IsAsciiHexDigit(c)) ++counts.hexDigit;
+    }
+    return counts;
+}
+
+ClassifyCounts ClassifyWithCharacterTable(const std::u32string& text)
+{
+    ClassifyCounts counts;
+    for (char32_t c : text)
+    {
+        if (GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idStart)) ++counts.idStart;
+        if (GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::idContinue)) ++counts.idCont;
+        if (GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::whiteSpace)) ++counts.whiteSpace;
+        if (GetCharacterInfo(c).HasGeneralCategory(GeneralCategoryId::L)) ++counts.letter;
+        if (GetCharacterInfo(c).GetGeneralCategory() == GeneralCategoryId::Ll) ++counts.lowerLetter;
+        if (GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::uppercase)) ++counts.upper;
+        if (GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::lowercase)) ++counts.lower;
+        if (GetCharacterInfo(c).GetBinaryProperty(BinaryPropertyId::asciiHexDigit)) ++counts.hexDigit;
+    }
+    return counts;
+}
+
+bool BenchmarkClassify(const std::u32string& text, int numRounds)
+{
+    ClassifyCounts tableCounts = ClassifyWithLatin1Table(text);
+    ClassifyCounts characterTableCounts = ClassifyWithCharacterTable(text);
+    if (!(tableCounts == characterTableCounts))
+    {
+        std::cout << "classify: the Latin-1 table and the character table disagree" << std::endl;
+        return false;
+    }
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int round = 0; round < numRounds; ++round)
+    {
+        tableCounts = ClassifyWithLatin1Table(text);
+    }
+    std::chrono::steady_clock::time_point tableEnd = std::chrono::steady_clock::now();
+    for (int round = 0; round < numRounds; ++round)
+    {
+        characterTableCounts = ClassifyWithCharacterTable(text);
+    }
+    std::chrono::steady_clock::time_point characterTableEnd = std::chrono::steady_clock::now();
+    std::cout << "classify: " << text.length() << " characters x " << numRounds << " rounds: Latin-1 table " << Milliseconds(start, tableEnd) << " ms, character table " <<
+        Milliseconds(tableEnd, characterTableEnd) << " ms (" << tableCounts.idStart << " identifier start characters)" << std::endl;
+    return true;
+}
+
+// The transcoders before the SSE2 versions: UTF-8 is decoded byte by byte with Utf8ToUtf32Engine and UTF-32 is encoded
+// character by character, appending each byte to the result.
+
+std::u32string EngineToUtf32(const std::string& utf8Str)
+{
+    std::u32string result;
+    Utf8ToUtf32Engine engine;
+    for (char c : utf8Str)
+    {
+        engine.Put(static_cast<uint8_t>(c));
+        if (engine.ResulReady())
+        {
+            result.append(1, engine.Result());
+        }
+    }
+    return result;
+}
+
+std::string ScalarToUtf8(const std::u32string& utf32Str)
+{
+    std::string result;
+    for (char32_t c : utf32Str)
+    {
+        uint32_t x = static_cast<uint32_t>(c);
+        if (x < 0x80u)
+        {
+            result.append(1, static_cast<char>(x));
+        }
+        else if (x < 0x800u)
+        {
+            result.append(1, static_cast<char>(0xC0u | (x >> 6u)));
+            result.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
+        }
+        else if (x < 0x10000u)
+        {
+            result.append(1, static_cast<char>(0xE0u | (x >> 12u)));
+            result.append(1, static_cast<char>(0x80u | ((x >> 6u) & 0x3Fu)));
+            result.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
+        }
+        else if (x < 0x110000u)
+        {
+            result.append(1, static_cast<char>(0xF0u | (x >> 18u)));
+            result.append(1, static_cast<char>(0x80u | ((x >> 12u) & 0x3Fu)));
+            result.append(1, static_cast<char>(0x80u | ((x >> 6u) & 0x3Fu)));
+            result.append(1, static_cast<char>(0x80u | (x & 0x3Fu)));
+        }
+        else
+        {
+            throw UnicodeException("invalid UTF-32 code point");
+        }
+    }
+    return result;
+}
+
+bool BenchmarkTranscode(const std::string& utf8Text, int numRounds)
+{
+    std::u32string utf32Text = ToUtf32(utf8Text);
+    if (utf32Text != EngineToUtf32(utf8Text))
+    {
+        std::cout << "transcode: ToUtf32 and Utf8ToUtf32Engine disagree" << std::endl;
+        return false;
+    }
+    if (ToUtf8(utf32Text) != utf8Text || ScalarToUtf8(utf32Text) != utf8Text)
+    {
+        std::cout << "transcode: UTF-8 text does not survive the round trip" << std::endl;
+        return false;
+    }
+    size_t length = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int round = 0; round < numRounds; ++round)
+    {
+        length += ToUtf32(utf8Text).length();
+    }
+    std::chrono::steady_clock::time_point toUtf32End = std::chrono::steady_clock::now();
+    for (int round = 0; round < numRounds; ++round)
+    {
+        length += EngineToUtf32(utf8Text).length();
+    }
+    std::chrono::steady_clock::time_point engineEnd = std::chrono::steady_clock::now();
+    for (int round = 0; round < numRounds; ++round)
+    {
+        length += ToUtf8(utf32Text).length();
+    }
+    std::chrono::steady_clock::time_point toUtf8End = std::chrono::steady_clock::now();
+    for (int round = 0; round < numRounds; ++round)
+    {
+        length += ScalarToUtf8(utf32Text).length();
+    }
+    std::chrono::steady_clock::time_point scalarEnd = std::chrono::steady_clock::now();
+    std::cout << "transcode: " << utf8Text.length() << " bytes x " << numRounds << " rounds: ToUtf32 " << Milliseconds(start, toUtf32End) << " ms, Utf8ToUtf32Engine " <<
+        Milliseconds(toUtf32End, engineEnd) << " ms, ToUtf8 " << Milliseconds(engineEnd, toUtf8End) << " ms, scalar encoder " << Milliseconds(toUtf8End, scalarEnd) << " ms (" <<
+        length << " units)" << std::endl;
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    InitDone initDone;
+    try
+    {
+        int numRounds = 10;
+        bool prevWasRounds = false;
+        std::vector<std::string> sourceFilePaths;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (prevWasRounds)
+            {
+                numRounds = std::stoi(arg);
+                prevWasRounds = false;
+            }
+            else if (arg == "--rounds" || arg == "-r")
+            {
+                prevWasRounds = true;
+            }
+            else if (!arg.empty() && arg[0] == '-')
+            {
+                throw std::runtime_error("unknown option '" + arg + "'");
+            }
+            else
+            {
+                CollectSourceFiles(arg, sourceFilePaths);
+            }
+        }
+        if (sourceFilePaths.empty() || numRounds < 1)
+        {
+            std::cout << "usage: utilbench [options] (<directory> | <file>)..." << std::endl;
+            std::cout << "Runs the util micro-benchmarks over the given files and the .cpp and .hpp files under the given directories." << std::endl;
+            std::cout << "options:" << std::endl;
+            std::cout << "--rounds N | -r N: repeat each benchmark N times (default 10)" << std::endl;
+            return 1;
+        }
+        std::string utf8Text;
+        for (const std::string& sourceFilePath : sourceFilePaths)
+        {
+            utf8Text.append(ReadFile(sourceFilePath));
+        }
+        std::u32string text = ToUtf32(utf8Text);
+        std::cout << sourceFilePaths.size() << " files, " << utf8Text.length() << " bytes" << std::endl;
+        bool same = BenchmarkClassify(text, numRounds);
+        same = BenchmarkTranscode(utf8Text, numRounds) && same;
+        if (!same)
+        {
+            return 1;
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -49,7 +49,7 @@ void Xml::Parse(const char32_t* start, const char32_t* end, int fileIndex, const
     gendoc::parsing::ObjectStack stack;
     std::unique_ptr<gendoc::parsing::ParsingData> parsingData(new gendoc::parsing::ParsingData(GetParsingDomain()->GetNumRules()));
     scanner.SetParsingData(parsingData.get());
-    stack.push(std::unique_ptr<gendoc::parsing::Object>(new ValueObject<XmlProcessor*>(processor)));
+    stack.Push<XmlProcessor*>(processor);
     gendoc::parsing::Match match = gendoc::parsing::Grammar::Parse(scanner, stack, parsingData.get());
     gendoc::parsing::Span stop = scanner.GetSpan();
     if (Log())
@@ -79,11 +79,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -115,17 +112,17 @@ public:
     void PreProlog(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreElement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreMisc(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -145,15 +142,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -186,18 +182,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -257,22 +250,22 @@ public:
     void Prepr1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Preref1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Prepr2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Preref2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -294,18 +287,15 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -361,12 +351,12 @@ public:
     void Preref1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Preref2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -387,15 +377,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -434,15 +423,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -481,11 +469,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -519,11 +504,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -558,11 +540,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -592,9 +571,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromtarget_value = std::move(stack.top());
-            context->fromtarget = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromtarget_value.get());
-            stack.pop();
+            context->fromtarget = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -617,15 +594,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -646,9 +622,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -670,11 +644,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -697,9 +668,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCData_value = std::move(stack.top());
-            context->fromCData = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromCData_value.get());
-            stack.pop();
+            context->fromCData = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -721,15 +690,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -761,11 +729,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -785,22 +750,22 @@ public:
     void PreXMLDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Prem1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreDocTypeDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Prem2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -820,11 +785,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -842,17 +804,17 @@ public:
     void PreVersionInfo(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreEncodingDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreSDDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -872,11 +834,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -917,11 +876,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -937,12 +893,12 @@ public:
     void PreComment(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PrePI(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -962,11 +918,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -984,15 +937,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromrootElementName_value = std::move(stack.top());
-            context->fromrootElementName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromrootElementName_value.get());
-            stack.pop();
+            context->fromrootElementName = stack.Pop<std::u32string>();
         }
     }
     void PreIntSubset(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1013,11 +964,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1031,7 +979,7 @@ public:
     void PrePEReference(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1051,11 +999,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1071,12 +1016,12 @@ public:
     void PreMarkupDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreDeclSep(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1096,11 +1041,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1124,32 +1066,32 @@ public:
     void PreElementDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreAttlistDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreEntityDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreNotationDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PrePI(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreComment(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1169,11 +1111,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1189,12 +1128,12 @@ public:
     void PreTextDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreExtSubsetDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1214,11 +1153,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1236,17 +1172,17 @@ public:
     void PreMarkupDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreConditionalSect(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreDeclSep(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1267,11 +1203,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1335,11 +1268,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1384,25 +1314,23 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
     void PreAttribute(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreETag(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1424,11 +1352,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1454,24 +1379,20 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromattName_value = std::move(stack.top());
-            context->fromattName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromattName_value.get());
-            stack.pop();
+            context->fromattName = stack.Pop<std::u32string>();
         }
     }
     void PreattValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PostattValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromattValue_value = std::move(stack.top());
-            context->fromattValue = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromattValue_value.get());
-            stack.pop();
+            context->fromattValue = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1494,11 +1415,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1521,9 +1439,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1545,11 +1461,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1575,37 +1488,37 @@ public:
     void Precd1(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreElement(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreReference(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreCDSect(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PrePI(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreComment(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void Precd2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1625,11 +1538,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1645,9 +1555,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromelementName_value = std::move(stack.top());
-            context->fromelementName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromelementName_value.get());
-            stack.pop();
+            context->fromelementName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1669,11 +1577,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1691,15 +1596,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
     void PreAttDef(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1720,11 +1623,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1742,15 +1642,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
     void PreDefaultDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1771,11 +1669,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1790,16 +1685,14 @@ public:
     void PreAttValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PostAttValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAttValue_value = std::move(stack.top());
-            context->fromAttValue = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromAttValue_value.get());
-            stack.pop();
+            context->fromAttValue = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1821,11 +1714,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1839,7 +1729,7 @@ public:
     void PreIncludeSect(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1859,11 +1749,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1877,7 +1764,7 @@ public:
     void PreExtSubsetDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -1897,15 +1784,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<char32_t>(context->value)));
+            stack.Push<char32_t>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1935,9 +1821,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromdcr_value = std::move(stack.top());
-            context->fromdcr = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromdcr_value.get());
-            stack.pop();
+            context->fromdcr = stack.Pop<uint32_t>();
         }
     }
     void Posthcr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1945,9 +1829,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromhcr_value = std::move(stack.top());
-            context->fromhcr = *static_cast<gendoc::parsing::ValueObject<uint32_t>*>(fromhcr_value.get());
-            stack.pop();
+            context->fromhcr = stack.Pop<uint32_t>();
         }
     }
 private:
@@ -1970,11 +1852,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -1997,16 +1876,14 @@ public:
     void PreEntityRef(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PostCharRef(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromCharRef_value = std::move(stack.top());
-            context->fromCharRef = *static_cast<gendoc::parsing::ValueObject<char32_t>*>(fromCharRef_value.get());
-            stack.pop();
+            context->fromCharRef = stack.Pop<char32_t>();
         }
     }
 private:
@@ -2028,11 +1905,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2055,9 +1929,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2079,11 +1951,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2099,9 +1968,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2123,11 +1990,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2143,12 +2007,12 @@ public:
     void PreGEDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PrePEDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -2168,11 +2032,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2190,15 +2051,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromentityName_value = std::move(stack.top());
-            context->fromentityName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromentityName_value.get());
-            stack.pop();
+            context->fromentityName = stack.Pop<std::u32string>();
         }
     }
     void PreentityValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -2219,11 +2078,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2241,15 +2097,13 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frompeName_value = std::move(stack.top());
-            context->frompeName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(frompeName_value.get());
-            stack.pop();
+            context->frompeName = stack.Pop<std::u32string>();
         }
     }
     void PrepeValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -2270,11 +2124,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2289,16 +2140,14 @@ public:
     void PreEntityValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PostEntityValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEntityValue_value = std::move(stack.top());
-            context->fromEntityValue = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromEntityValue_value.get());
-            stack.pop();
+            context->fromEntityValue = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2320,11 +2169,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2339,16 +2185,14 @@ public:
     void PreEntityValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PostEntityValue(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromEntityValue_value = std::move(stack.top());
-            context->fromEntityValue = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromEntityValue_value.get());
-            stack.pop();
+            context->fromEntityValue = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2370,11 +2214,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2390,12 +2231,12 @@ public:
     void PreVersionInfo(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreEncodingDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -2415,11 +2256,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2435,12 +2273,12 @@ public:
     void PreTextDecl(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
     void PreContent(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData)
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XmlProcessor*>(context->processor)));
+        stack.Push<XmlProcessor*>(context->processor);
     }
 private:
     struct Context : gendoc::parsing::Context
@@ -2460,11 +2298,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2496,9 +2331,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromen1_value = std::move(stack.top());
-            context->fromen1 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromen1_value.get());
-            stack.pop();
+            context->fromen1 = stack.Pop<std::u32string>();
         }
     }
     void Posten2(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2506,9 +2339,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromen2_value = std::move(stack.top());
-            context->fromen2 = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromen2_value.get());
-            stack.pop();
+            context->fromen2 = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2531,15 +2362,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2571,11 +2401,8 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
-        std::unique_ptr<gendoc::parsing::Object> processor_value = std::move(stack.top());
-        context->processor = *static_cast<gendoc::parsing::ValueObject<XmlProcessor*>*>(processor_value.get());
-        stack.pop();
+        Context* context = parsingData->PushContext<Context>(Id(), this);
+        context->processor = stack.Pop<XmlProcessor*>();
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
@@ -2591,9 +2418,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromName_value = std::move(stack.top());
-            context->fromName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromName_value.get());
-            stack.pop();
+            context->fromName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -7,34 +7,146 @@
 #include <gendoc/xml/XmlGrammar.hpp>
 #include <gendoc/util/Unicode.hpp>
 #include <gendoc/util/MappedInputFile.hpp>
+#include <mutex>
 
 namespace gendoc { namespace xml {
 
 using namespace gendoc::util;
 using namespace gendoc::unicode;
+using gendoc::parsing::Span;
+
+// Drives an XmlProcessor from the views produced by XmlStreamReader.
+
+class XmlProcessorStreamHandler : public XmlStreamHandler
+{
+public:
+    XmlProcessorStreamHandler(XmlProcessor* processor_, const std::string& systemId_);
+    void StartDocument() override;
+    void EndDocument() override;
+    void Version(const XmlStringView& xmlVersion) override;
+    void Standalone(bool standalone) override;
+    void Encoding(const XmlStringView& encoding) override;
+    void Text(const XmlStringView& text) override;
+    void Comment(const XmlStringView& comment) override;
+    void PI(const XmlStringView& target, const XmlStringView& data) override;
+    void CDataSection(const XmlStringView& cdata) override;
+    void StartElement(const XmlStringView& qualifiedName, const std::vector<XmlStreamAttribute>& attributes, const Span& span) override;
+    void EndElement(const XmlStringView& qualifiedName, const Span& span) override;
+    void SkippedEntity(const XmlStringView& entityName, const Span& span) override;
+private:
+    XmlProcessor* processor;
+    std::string systemId;
+};
+
+XmlProcessorStreamHandler::XmlProcessorStreamHandler(XmlProcessor* processor_, const std::string& systemId_) : processor(processor_), systemId(systemId_)
+{
+}
+
+void XmlProcessorStreamHandler::StartDocument()
+{
+    processor->StartDocument();
+}
+
+void XmlProcessorStreamHandler::EndDocument()
+{
+    processor->EndDocument();
+}
+
+void XmlProcessorStreamHandler::Version(const XmlStringView& xmlVersion)
+{
+    processor->Version(xmlVersion.ToUtf32());
+}
+
+void XmlProcessorStreamHandler::Standalone(bool standalone)
+{
+    processor->Standalone(standalone);
+}
+
+void XmlProcessorStreamHandler::Encoding(const XmlStringView& encoding)
+{
+    processor->Encoding(encoding.ToUtf32());
+}
+
+void XmlProcessorStreamHandler::Text(const XmlStringView& text)
+{
+    processor->Text(text.ToUtf32());
+}
+
+void XmlProcessorStreamHandler::Comment(const XmlStringView& comment)
+{
+    processor->Comment(comment.ToUtf32());
+}
+
+void XmlProcessorStreamHandler::PI(const XmlStringView& target, const XmlStringView& data)
+{
+    processor->PI(target.ToUtf32(), data.ToUtf32());
+}
+
+void XmlProcessorStreamHandler::CDataSection(const XmlStringView& cdata)
+{
+    processor->CDataSection(cdata.ToUtf32());
+}
+
+void XmlProcessorStreamHandler::StartElement(const XmlStringView& qualifiedName, const std::vector<XmlStreamAttribute>& attributes, const Span& span)
+{
+    processor->BeginStartTag(qualifiedName.ToUtf32());
+    for (const XmlStreamAttribute& attribute : attributes)
+    {
+        processor->AddAttribute(attribute.QualifiedName().ToUtf32(), attribute.Value().ToUtf32(), span, systemId);
+    }
+    processor->EndStartTag(span, systemId);
+}
+
+void XmlProcessorStreamHandler::EndElement(const XmlStringView& qualifiedName, const Span& span)
+{
+    processor->EndTag(qualifiedName.ToUtf32(), span, systemId);
+}
+
+void XmlProcessorStreamHandler::SkippedEntity(const XmlStringView& entityName, const Span& span)
+{
+    processor->EntityRef(entityName.ToUtf32(), span, systemId);
+}
 
 void ParseXmlFile(const std::string& xmlFileName, XmlContentHandler* contentHandler)
 {
-    std::string xmlContent = ReadFile(xmlFileName);
-    ParseXmlContent(xmlContent, xmlFileName, contentHandler);
+    MappedInputFile xmlFile(xmlFileName);
+    XmlProcessor xmlProcessor(xmlFile.Begin(), xmlFile.End(), contentHandler);
+    XmlProcessorStreamHandler streamHandler(&xmlProcessor, xmlFileName);
+    XmlStreamReader reader(xmlFile.Begin(), xmlFile.End(), xmlFileName, &streamHandler);
+    reader.Parse();
+}
+
+void ParseXmlFile(const std::string& xmlFileName, XmlStreamHandler* streamHandler)
+{
+    MappedInputFile xmlFile(xmlFileName);
+    XmlStreamReader reader(xmlFile.Begin(), xmlFile.End(), xmlFileName, streamHandler);
+    reader.Parse();
 }
 
 void ParseXmlContent(const std::string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler)
 {
-    ParseXmlContent(ToUtf32(xmlContent), systemId, contentHandler);
+    const char* contentStart = xmlContent.data();
+    const char* contentEnd = xmlContent.data() + xmlContent.length();
+    XmlProcessor xmlProcessor(contentStart, contentEnd, contentHandler);
+    XmlProcessorStreamHandler streamHandler(&xmlProcessor, systemId);
+    XmlStreamReader reader(contentStart, contentEnd, systemId, &streamHandler);
+    reader.Parse();
 }
 
 Xml* xmlGrammar = nullptr;
+std::once_flag xmlGrammarCreated;
+
+void CreateXmlGrammar()
+{
+    xmlGrammar = Xml::Create();
+}
 
 void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler)
 {
     const char32_t* contentStart = &xmlContent[0];
     const char32_t* contentEnd = &xmlContent[0] + xmlContent.length();
     XmlProcessor xmlProcessor(contentStart, contentEnd, contentHandler);
-    if (xmlGrammar == nullptr)
-    {
-        xmlGrammar = Xml::Create();
-    }
+    std::call_once(xmlGrammarCreated, CreateXmlGrammar);
     xmlGrammar->Parse(contentStart, contentEnd, 0, systemId, &xmlProcessor);
 }
 
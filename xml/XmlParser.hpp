@@ -11,6 +11,7 @@
 #ifndef CMINOR_XML_XML_PARSER
 #define CMINOR_XML_XML_PARSER
 #include <gendoc/xml/XmlContentHandler.hpp>
+#include <gendoc/xml/XmlStreamReader.hpp>
 
 namespace gendoc { namespace xml {
 
@@ -20,6 +21,14 @@ namespace gendoc { namespace xml {
 
 void ParseXmlFile(const std::string& xmlFileName, XmlContentHandler* contentHandler);
 
+//  ==================================================================================
+//  ParseXmlFile streams given UTF-8 encoded XML file to given stream handler.
+//  The file is memory mapped and the handler receives views into the mapping, 
+//  so the file is never copied as a whole.
+//  ==================================================================================
+
+void ParseXmlFile(const std::string& xmlFileName, XmlStreamHandler* streamHandler);
+
 //  ==================================================================================
 //  ParseXmlContent parses given UTF-8 encoded XML string using given content handler.
 //  systemId is used for error messages only. It can be for example a file name or URL 
@@ -32,6 +41,8 @@ void ParseXmlContent(const std::string& xmlContent, const std::string& systemId,
 //  ParseXmlContent parses given UTF-32 encoded XML string using given content handler.
 //  systemId is used for error messages only. It can be for example a file name or URL 
 //  that identifies the XML string to parse.
+//  Unlike the other functions that use XmlStreamReader, this one runs the Xml grammar,
+//  which serves as the conformance reference for the reader.
 //  ===================================================================================
 
 void ParseXmlContent(const std::u32string& xmlContent, const std::string& systemId, XmlContentHandler* contentHandler);
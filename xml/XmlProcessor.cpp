@@ -25,7 +25,18 @@ InternalEntity::InternalEntity(const std::u32string& value_) : value(value_)
 }
 
 XmlProcessor::XmlProcessor(const char32_t* contentStart_, const char32_t* contentEnd_, XmlContentHandler* contentHandler_) : 
-    contentStart(contentStart_), contentEnd(contentEnd_), contentHandler(contentHandler_), attValue(nullptr)
+    contentStart(contentStart_), contentEnd(contentEnd_), utf8ContentStart(nullptr), utf8ContentEnd(nullptr), contentHandler(contentHandler_), attValue(nullptr)
+{
+    InitEntityMap();
+}
+
+XmlProcessor::XmlProcessor(const char* utf8ContentStart_, const char* utf8ContentEnd_, XmlContentHandler* contentHandler_) :
+    contentStart(nullptr), contentEnd(nullptr), utf8ContentStart(utf8ContentStart_), utf8ContentEnd(utf8ContentEnd_), contentHandler(contentHandler_), attValue(nullptr)
+{
+    InitEntityMap();
+}
+
+void XmlProcessor::InitEntityMap()
 {
     entityMap[U"quot"] = std::unique_ptr<Entity>(new InternalEntity(U"\""));
     entityMap[U"amp"] = std::unique_ptr<Entity>(new InternalEntity(U"&"));
@@ -243,10 +254,21 @@ void XmlProcessor::ParseQualifiedName(const std::u32string& qualifiedName, std::
 int XmlProcessor::GetErrorColumn(int index) const
 {
     int errorColumn = 0;
-    while (index > 0 && contentStart[index] != '\n' && contentStart[index] != '\r')
+    if (utf8ContentStart)
     {
-        ++errorColumn;
-        --index;
+        while (index > 0 && utf8ContentStart[index] != '\n' && utf8ContentStart[index] != '\r')
+        {
+            ++errorColumn;
+            --index;
+        }
+    }
+    else
+    {
+        while (index > 0 && contentStart[index] != '\n' && contentStart[index] != '\r')
+        {
+            ++errorColumn;
+            --index;
+        }
     }
     if (errorColumn == 0)
     {
@@ -41,6 +41,7 @@ class XmlProcessor
 {
 public:
     XmlProcessor(const char32_t* contentStart_, const char32_t* contentEnd_, XmlContentHandler* contentHandler_);
+    XmlProcessor(const char* utf8ContentStart_, const char* utf8ContentEnd_, XmlContentHandler* contentHandler_);
     const char32_t* ContentStart() const { return contentStart; }
     const char32_t* ContentEnd() const { return contentEnd; }
     void StartDocument();
@@ -62,6 +63,8 @@ public:
 private:
     const char32_t* contentStart;
     const char32_t* contentEnd;
+    const char* utf8ContentStart;
+    const char* utf8ContentEnd;
     XmlContentHandler* contentHandler;
     std::stack<std::u32string> tagStack;
     std::u32string currentTagName;
@@ -74,6 +77,7 @@ private:
     std::unordered_map<std::u32string, std::u32string> namespacePrefixMap;
     Attributes attributes;
     std::unordered_map<std::u32string, std::unique_ptr<Entity>> entityMap;
+    void InitEntityMap();
     int GetErrorColumn(int index) const;
     std::string GetErrorLocationStr(const std::string& systemId, const gendoc::parsing::Span& span) const;
     void ParseQualifiedName(const std::u32string& qualifiedName, std::u32string& localName, std::u32string& prefix, const gendoc::parsing::Span& span, const std::string& systemId);
@@ -0,0 +1,669 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/xml/XmlStreamReader.hpp>
+#include <gendoc/xml/XmlProcessor.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <cctype>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GENDOC_XML_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace gendoc { namespace xml {
+
+using namespace gendoc::unicode;
+using gendoc::parsing::Span;
+
+std::u32string XmlStringView::ToUtf32() const
+{
+    return gendoc::unicode::ToUtf32(begin, end);
+}
+
+bool XmlStringView::Equals(const XmlStringView& that) const
+{
+    return Length() == that.Length() && std::memcmp(begin, that.begin, Length()) == 0;
+}
+
+bool XmlStringView::Equals(const char* s) const
+{
+    size_t n = std::strlen(s);
+    return Length() == n && std::memcmp(begin, s, n) == 0;
+}
+
+XmlStreamHandler::~XmlStreamHandler()
+{
+}
+
+// Every byte is classified once into a table, so the scanning loops below need a single lookup per byte. Bytes of multibyte UTF-8
+// sequences are treated as name characters.
+
+enum XmlCharClass : uint8_t
+{
+    xmlSpace = 1 << 0,
+    xmlNameStart = 1 << 1,
+    xmlName = 1 << 2,
+    xmlTextDelimiter = 1 << 3
+};
+
+class XmlCharClassTable
+{
+public:
+    XmlCharClassTable();
+    uint8_t operator[](char c) const { return classes[static_cast<unsigned char>(c)]; }
+private:
+    uint8_t classes[256];
+};
+
+XmlCharClassTable::XmlCharClassTable()
+{
+    for (int c = 0; c < 256; ++c)
+    {
+        uint8_t charClass = 0;
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        {
+            charClass |= xmlSpace;
+        }
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':' || c >= 0x80)
+        {
+            charClass |= xmlNameStart | xmlName;
+        }
+        if ((c >= '0' && c <= '9') || c == '-' || c == '.')
+        {
+            charClass |= xmlName;
+        }
+        if (c == '<' || c == '&')
+        {
+            charClass |= xmlTextDelimiter;
+        }
+        classes[c] = charClass;
+    }
+}
+
+const XmlCharClassTable xmlCharClass;
+
+inline bool IsXmlSpace(char c)
+{
+    return (xmlCharClass[c] & xmlSpace) != 0;
+}
+
+inline bool IsXmlNameStartChar(char c)
+{
+    return (xmlCharClass[c] & xmlNameStart) != 0;
+}
+
+inline bool IsXmlNameChar(char c)
+{
+    return (xmlCharClass[c] & xmlName) != 0;
+}
+
+// Returns the first '<' or '&' in [begin, end), or end. Character data runs are scanned 16 bytes at a time with SSE2.
+
+const char* FindTextDelimiter(const char* begin, const char* end)
+{
+    const char* p = begin;
+#ifdef GENDOC_XML_SSE2
+    const __m128i lt = _mm_set1_epi8('<');
+    const __m128i amp = _mm_set1_epi8('&');
+    while (end - p >= 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, lt), _mm_cmpeq_epi8(block, amp)));
+        if (mask != 0)
+        {
+            int index = 0;
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                ++index;
+            }
+            return p + index;
+        }
+        p += 16;
+    }
+#endif
+    while (p != end && (xmlCharClass[*p] & xmlTextDelimiter) == 0)
+    {
+        ++p;
+    }
+    return p;
+}
+
+// Returns the first occurrence of the three-character terminator s in [begin, end), or end.
+
+const char* FindTerminator(const char* begin, const char* end, const char* s)
+{
+    const char* p = begin;
+    while (end - p >= 3)
+    {
+        p = static_cast<const char*>(std::memchr(p, s[0], end - p - 2));
+        if (!p)
+        {
+            return end;
+        }
+        if (p[1] == s[1] && p[2] == s[2])
+        {
+            return p;
+        }
+        ++p;
+    }
+    return end;
+}
+
+XmlStreamReader::XmlStreamReader(const char* begin_, const char* end_, const std::string& systemId_, XmlStreamHandler* handler_) :
+    begin(begin_), end(end_), pos(begin_), systemId(systemId_), handler(handler_), lineNumber(1), lineCountPos(begin_)
+{
+}
+
+void XmlStreamReader::Parse()
+{
+    if (end - pos >= 3 && std::memcmp(pos, "\xEF\xBB\xBF", 3) == 0)
+    {
+        pos += 3;
+    }
+    handler->StartDocument();
+    if (StartsWith("<?xml") && end - pos > 5 && IsXmlSpace(pos[5]))
+    {
+        ParseXmlDecl();
+    }
+    ParseMisc();
+    if (StartsWith("<!DOCTYPE"))
+    {
+        SkipDocTypeDecl();
+        ParseMisc();
+    }
+    if (pos == end || *pos != '<')
+    {
+        Error("root element expected");
+    }
+    ParseContent();
+    ParseMisc();
+    if (pos != end)
+    {
+        Error("end of document expected");
+    }
+    handler->EndDocument();
+}
+
+Span XmlStreamReader::GetSpan()
+{
+    while (lineCountPos < pos)
+    {
+        if (*lineCountPos == '\n')
+        {
+            ++lineNumber;
+        }
+        ++lineCountPos;
+    }
+    return Span(0, lineNumber, int(pos - begin));
+}
+
+void XmlStreamReader::Error(const std::string& message)
+{
+    Span span = GetSpan();
+    int errorColumn = 1;
+    const char* p = pos;
+    while (p > begin && p[-1] != '\n' && p[-1] != '\r')
+    {
+        --p;
+        ++errorColumn;
+    }
+    throw XmlProcessingException("error in '" + systemId + "' at line " + std::to_string(span.LineNumber()) + " column " + std::to_string(errorColumn) +
+        " (index " + std::to_string(span.Start()) + "): " + message);
+}
+
+bool XmlStreamReader::StartsWith(const char* s) const
+{
+    size_t n = std::strlen(s);
+    return size_t(end - pos) >= n && std::memcmp(pos, s, n) == 0;
+}
+
+void XmlStreamReader::Expect(const char* s)
+{
+    if (!StartsWith(s))
+    {
+        Error("'" + std::string(s) + "' expected");
+    }
+    pos += std::strlen(s);
+}
+
+bool XmlStreamReader::SkipSpace()
+{
+    const char* start = pos;
+    while (pos != end && IsXmlSpace(*pos))
+    {
+        ++pos;
+    }
+    return pos != start;
+}
+
+XmlStringView XmlStreamReader::ParseName()
+{
+    const char* start = pos;
+    if (pos == end || !IsXmlNameStartChar(*pos))
+    {
+        Error("name expected");
+    }
+    ++pos;
+    while (pos != end && IsXmlNameChar(*pos))
+    {
+        ++pos;
+    }
+    return XmlStringView(start, pos);
+}
+
+XmlStringView XmlStreamReader::ParseQuoted()
+{
+    if (pos == end || (*pos != '"' && *pos != '\''))
+    {
+        Error("quoted value expected");
+    }
+    char quote = *pos++;
+    const char* start = pos;
+    const char* stop = static_cast<const char*>(std::memchr(pos, quote, end - pos));
+    if (!stop)
+    {
+        Error("unterminated quoted value");
+    }
+    pos = stop + 1;
+    return XmlStringView(start, stop);
+}
+
+void XmlStreamReader::ParseXmlDecl()
+{
+    pos += 5;
+    while (true)
+    {
+        bool space = SkipSpace();
+        if (StartsWith("?>"))
+        {
+            pos += 2;
+            break;
+        }
+        if (!space)
+        {
+            Error("white space expected");
+        }
+        XmlStringView name = ParseName();
+        SkipSpace();
+        Expect("=");
+        SkipSpace();
+        XmlStringView value = ParseQuoted();
+        if (name.Equals("version"))
+        {
+            handler->Version(value);
+        }
+        else if (name.Equals("encoding"))
+        {
+            handler->Encoding(value);
+        }
+        else if (name.Equals("standalone"))
+        {
+            if (value.Equals("yes"))
+            {
+                handler->Standalone(true);
+            }
+            else if (value.Equals("no"))
+            {
+                handler->Standalone(false);
+            }
+            else
+            {
+                Error("'yes' or 'no' expected");
+            }
+        }
+        else
+        {
+            Error("'version', 'encoding' or 'standalone' expected");
+        }
+    }
+}
+
+void XmlStreamReader::ParseMisc()
+{
+    while (true)
+    {
+        SkipSpace();
+        if (StartsWith("<!--"))
+        {
+            ParseComment();
+        }
+        else if (StartsWith("<?"))
+        {
+            ParsePI();
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+void XmlStreamReader::SkipDocTypeDecl()
+{
+    pos += 9;
+    int depth = 0;
+    while (pos != end)
+    {
+        char c = *pos;
+        if (c == '"' || c == '\'')
+        {
+            ParseQuoted();
+            continue;
+        }
+        ++pos;
+        if (c == '[')
+        {
+            ++depth;
+        }
+        else if (c == ']')
+        {
+            --depth;
+        }
+        else if (c == '>' && depth == 0)
+        {
+            return;
+        }
+    }
+    Error("unterminated document type declaration");
+}
+
+void XmlStreamReader::ParseContent()
+{
+    ParseStartTag();
+    while (!elementStack.empty())
+    {
+        ParseCharData();
+        if (pos == end)
+        {
+            Error("end tag '" + elementStack.back().ToString() + "' expected");
+        }
+        if (*pos == '&')
+        {
+            ParseReference(nullptr);
+        }
+        else if (StartsWith("</"))
+        {
+            ParseEndTag();
+        }
+        else if (StartsWith("<!--"))
+        {
+            ParseComment();
+        }
+        else if (StartsWith("<![CDATA["))
+        {
+            ParseCDataSection();
+        }
+        else if (StartsWith("<?"))
+        {
+            ParsePI();
+        }
+        else
+        {
+            ParseStartTag();
+        }
+    }
+}
+
+void XmlStreamReader::ParseStartTag()
+{
+    ++pos;
+    XmlStringView qualifiedName = ParseName();
+    attributes.clear();
+    bufferedValues.clear();
+    valueBuffer.clear();
+    while (true)
+    {
+        bool space = SkipSpace();
+        if (pos == end)
+        {
+            Error("'>' expected");
+        }
+        if (*pos == '>' || *pos == '/')
+        {
+            break;
+        }
+        if (!space)
+        {
+            Error("white space expected");
+        }
+        XmlStringView attributeName = ParseName();
+        SkipSpace();
+        Expect("=");
+        SkipSpace();
+        attributes.push_back(XmlStreamAttribute(attributeName, XmlStringView()));
+        ParseAttributeValue();
+    }
+    for (const std::pair<int, std::pair<size_t, size_t>>& bufferedValue : bufferedValues)
+    {
+        const char* valueStart = valueBuffer.data();
+        attributes[bufferedValue.first].SetValue(XmlStringView(valueStart + bufferedValue.second.first, valueStart + bufferedValue.second.second));
+    }
+    Span span = GetSpan();
+    if (*pos == '/')
+    {
+        Expect("/>");
+        handler->StartElement(qualifiedName, attributes, span);
+        handler->EndElement(qualifiedName, span);
+    }
+    else
+    {
+        ++pos;
+        handler->StartElement(qualifiedName, attributes, span);
+        elementStack.push_back(qualifiedName);
+    }
+}
+
+void XmlStreamReader::ParseEndTag()
+{
+    pos += 2;
+    XmlStringView qualifiedName = ParseName();
+    SkipSpace();
+    Expect(">");
+    const XmlStringView& startTagName = elementStack.back();
+    if (!qualifiedName.Equals(startTagName))
+    {
+        Error("end tag '" + qualifiedName.ToString() + "' does not match start tag '" + startTagName.ToString() + "'");
+    }
+    elementStack.pop_back();
+    handler->EndElement(qualifiedName, GetSpan());
+}
+
+void XmlStreamReader::ParseAttributeValue()
+{
+    if (pos == end || (*pos != '"' && *pos != '\''))
+    {
+        Error("attribute value expected");
+    }
+    char quote = *pos++;
+    const char* start = pos;
+    while (pos != end && *pos != quote && (xmlCharClass[*pos] & xmlTextDelimiter) == 0)
+    {
+        ++pos;
+    }
+    if (pos != end && *pos == quote)
+    {
+        attributes.back().SetValue(XmlStringView(start, pos));
+        ++pos;
+        return;
+    }
+    size_t valueStart = valueBuffer.length();
+    valueBuffer.append(start, pos);
+    while (pos != end && *pos != quote)
+    {
+        if (*pos == '&')
+        {
+            ParseReference(&valueBuffer);
+        }
+        else if (*pos == '<')
+        {
+            Error("'<' not allowed in attribute value");
+        }
+        else
+        {
+            valueBuffer.append(1, *pos++);
+        }
+    }
+    if (pos == end)
+    {
+        Error("unterminated attribute value");
+    }
+    ++pos;
+    bufferedValues.push_back(std::make_pair(int(attributes.size()) - 1, std::make_pair(valueStart, valueBuffer.length())));
+}
+
+void XmlStreamReader::ParseCharData()
+{
+    const char* start = pos;
+    pos = FindTextDelimiter(pos, end);
+    if (pos != start)
+    {
+        handler->Text(XmlStringView(start, pos));
+    }
+}
+
+const char* predefinedEntityValues[] = { "<", ">", "&", "\"", "'" };
+const char* predefinedEntityNames[] = { "lt", "gt", "amp", "quot", "apos" };
+
+void XmlStreamReader::ParseReference(std::string* value)
+{
+    ++pos;
+    XmlStringView replacement;
+    if (pos != end && *pos == '#')
+    {
+        ++pos;
+        uint32_t code = 0;
+        const char* digitStart = pos;
+        if (pos != end && *pos == 'x')
+        {
+            digitStart = ++pos;
+            while (pos != end && std::isxdigit(static_cast<unsigned char>(*pos)))
+            {
+                char c = *pos++;
+                code = 16 * code + (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+                if (code > 0x10FFFF)
+                {
+                    Error("invalid character reference");
+                }
+            }
+        }
+        else
+        {
+            while (pos != end && *pos >= '0' && *pos <= '9')
+            {
+                code = 10 * code + (*pos++ - '0');
+                if (code > 0x10FFFF)
+                {
+                    Error("invalid character reference");
+                }
+            }
+        }
+        if (pos == digitStart || code == 0 || (code >= 0xD800 && code <= 0xDFFF))
+        {
+            Error("invalid character reference");
+        }
+        char* q = charRefBuffer;
+        if (code < 0x80)
+        {
+            *q++ = static_cast<char>(code);
+        }
+        else if (code < 0x800)
+        {
+            *q++ = static_cast<char>(0xC0 | (code >> 6));
+            *q++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000)
+        {
+            *q++ = static_cast<char>(0xE0 | (code >> 12));
+            *q++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            *q++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else
+        {
+            *q++ = static_cast<char>(0xF0 | (code >> 18));
+            *q++ = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            *q++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            *q++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        replacement = XmlStringView(charRefBuffer, q);
+        Expect(";");
+    }
+    else
+    {
+        XmlStringView entityName = ParseName();
+        Expect(";");
+        for (int i = 0; i < 5; ++i)
+        {
+            if (entityName.Equals(predefinedEntityNames[i]))
+            {
+                replacement = XmlStringView(predefinedEntityValues[i], predefinedEntityValues[i] + 1);
+                break;
+            }
+        }
+        if (!replacement.Begin())
+        {
+            handler->SkippedEntity(entityName, GetSpan());
+            return;
+        }
+    }
+    if (value)
+    {
+        value->append(replacement.Begin(), replacement.End());
+    }
+    else
+    {
+        handler->Text(replacement);
+    }
+}
+
+void XmlStreamReader::ParseComment()
+{
+    pos += 4;
+    const char* start = pos;
+    pos = FindTerminator(pos, end, "-->");
+    if (pos == end)
+    {
+        Error("'-->' expected");
+    }
+    handler->Comment(XmlStringView(start, pos));
+    pos += 3;
+}
+
+void XmlStreamReader::ParsePI()
+{
+    pos += 2;
+    XmlStringView target = ParseName();
+    const char* dataStart = pos;
+    if (SkipSpace())
+    {
+        dataStart = pos;
+    }
+    while (!StartsWith("?>"))
+    {
+        if (pos == end)
+        {
+            Error("'?>' expected");
+        }
+        ++pos;
+    }
+    handler->PI(target, XmlStringView(dataStart, pos));
+    pos += 2;
+}
+
+void XmlStreamReader::ParseCDataSection()
+{
+    pos += 9;
+    const char* start = pos;
+    pos = FindTerminator(pos, end, "]]>");
+    if (pos == end)
+    {
+        Error("']]>' expected");
+    }
+    handler->CDataSection(XmlStringView(start, pos));
+    pos += 3;
+}
+
+} } // namespace gendoc::xml
@@ -0,0 +1,114 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#ifndef GENDOC_XML_XML_STREAM_READER
+#define GENDOC_XML_XML_STREAM_READER
+#include <gendoc/parsing/Scanner.hpp>
+#include <string>
+#include <vector>
+
+namespace gendoc { namespace xml {
+
+// A range of UTF-8 characters in the document being read, or in a scratch buffer of the reader when the text is the result of expanding
+// a reference. A view is valid only during the callback that receives it.
+
+class XmlStringView
+{
+public:
+    XmlStringView() : begin(nullptr), end(nullptr) {}
+    XmlStringView(const char* begin_, const char* end_) : begin(begin_), end(end_) {}
+    const char* Begin() const { return begin; }
+    const char* End() const { return end; }
+    size_t Length() const { return end - begin; }
+    bool IsEmpty() const { return begin == end; }
+    std::string ToString() const { return std::string(begin, end); }
+    std::u32string ToUtf32() const;
+    bool Equals(const XmlStringView& that) const;
+    bool Equals(const char* s) const;
+private:
+    const char* begin;
+    const char* end;
+};
+
+class XmlStreamAttribute
+{
+public:
+    XmlStreamAttribute(const XmlStringView& qualifiedName_, const XmlStringView& value_) : qualifiedName(qualifiedName_), value(value_) {}
+    const XmlStringView& QualifiedName() const { return qualifiedName; }
+    const XmlStringView& Value() const { return value; }
+    void SetValue(const XmlStringView& value_) { value = value_; }
+private:
+    XmlStringView qualifiedName;
+    XmlStringView value;
+};
+
+// Receives the contents of a document from XmlStreamReader. Names are qualified names as written; namespace prefixes are not resolved.
+// Predefined entity and character references are expanded by the reader; text containing them is delivered in several Text calls.
+
+class XmlStreamHandler
+{
+public:
+    virtual ~XmlStreamHandler();
+    virtual void StartDocument() {}
+    virtual void EndDocument() {}
+    virtual void Version(const XmlStringView& xmlVersion) {}
+    virtual void Standalone(bool standalone) {}
+    virtual void Encoding(const XmlStringView& encoding) {}
+    virtual void Text(const XmlStringView& text) {}
+    virtual void Comment(const XmlStringView& comment) {}
+    virtual void PI(const XmlStringView& target, const XmlStringView& data) {}
+    virtual void CDataSection(const XmlStringView& cdata) {}
+    virtual void StartElement(const XmlStringView& qualifiedName, const std::vector<XmlStreamAttribute>& attributes, const gendoc::parsing::Span& span) {}
+    virtual void EndElement(const XmlStringView& qualifiedName, const gendoc::parsing::Span& span) {}
+    virtual void SkippedEntity(const XmlStringView& entityName, const gendoc::parsing::Span& span) {}
+};
+
+// Reads a UTF-8 encoded document from memory, typically a mapped file, without copying it. Elements are processed iteratively,
+// so the nesting depth of the document is not limited by the call stack.
+
+class XmlStreamReader
+{
+public:
+    XmlStreamReader(const char* begin_, const char* end_, const std::string& systemId_, XmlStreamHandler* handler_);
+    XmlStreamReader(const XmlStreamReader&) = delete;
+    XmlStreamReader& operator=(const XmlStreamReader&) = delete;
+    void Parse();
+private:
+    const char* begin;
+    const char* end;
+    const char* pos;
+    std::string systemId;
+    XmlStreamHandler* handler;
+    int lineNumber;
+    const char* lineCountPos;
+    std::vector<XmlStringView> elementStack;
+    std::vector<XmlStreamAttribute> attributes;
+    std::vector<std::pair<int, std::pair<size_t, size_t>>> bufferedValues;
+    std::string valueBuffer;
+    char charRefBuffer[4];
+    gendoc::parsing::Span GetSpan();
+    void Error(const std::string& message);
+    bool StartsWith(const char* s) const;
+    void Expect(const char* s);
+    bool SkipSpace();
+    XmlStringView ParseName();
+    XmlStringView ParseQuoted();
+    void ParseXmlDecl();
+    void ParseMisc();
+    void SkipDocTypeDecl();
+    void ParseContent();
+    void ParseStartTag();
+    void ParseEndTag();
+    void ParseAttributeValue();
+    void ParseCharData();
+    void ParseReference(std::string* value);
+    void ParseComment();
+    void ParsePI();
+    void ParseCDataSection();
+};
+
+} } // namespace gendoc::xml
+
+#endif // GENDOC_XML_XML_STREAM_READER
@@ -0,0 +1,177 @@
+// =================================
+// Copyright (c) 2018 Seppo Laakko
+// Distributed under the MIT license
+// =================================
+
+#include <gendoc/xml/XmlParser.hpp>
+#include <gendoc/parsing/InitDone.hpp>
+#include <gendoc/parsing/Exception.hpp>
+#include <gendoc/util/InitDone.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <gendoc/util/MappedInputFile.hpp>
+#include <gendoc/util/Path.hpp>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Differential test of the XML front end: each input file is parsed with XmlStreamReader and with the Xml grammar, which is the
+// conformance reference, and the content handler events produced by the two must be identical.
+
+using namespace gendoc::xml;
+using namespace gendoc::parsing;
+using namespace gendoc::util;
+using namespace gendoc::unicode;
+
+struct InitDone
+{
+    InitDone()
+    {
+        gendoc::util::Init();
+        gendoc::parsing::Init();
+    }
+    ~InitDone()
+    {
+        gendoc::parsing::Done();
+        gendoc::util::Done();
+    }
+};
+
+// Records the events as lines of text. XmlStreamReader delivers text containing references in several Text calls, so adjacent
+// text is merged into one event before it is recorded.
+
+class EventRecorder : public XmlContentHandler
+{
+public:
+    const std::vector<std::u32string>& Events() { FlushText(); return events; }
+    void StartDocument() override { Add(U"StartDocument"); }
+    void EndDocument() override { Add(U"EndDocument"); }
+    void Version(const std::u32string& xmlVersion) override { Add(U"Version " + xmlVersion); }
+    void Standalone(bool standalone) override { Add(standalone ? U"Standalone yes" : U"Standalone no"); }
+    void Encoding(const std::u32string& encoding) override { Add(U"Encoding " + encoding); }
+    void Text(const std::u32string& text) override { this->text.append(text); }
+    void Comment(const std::u32string& comment) override { Add(U"Comment " + comment); }
+    void PI(const std::u32string& target, const std::u32string& data) override { Add(U"PI " + target + U" " + data); }
+    void CDataSection(const std::u32string& cdata) override { Add(U"CDataSection " + cdata); }
+    void StartElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName, const Attributes& attributes) override;
+    void EndElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName) override;
+    void SkippedEntity(const std::u32string& entityName) override { Add(U"SkippedEntity " + entityName); }
+private:
+    std::vector<std::u32string> events;
+    std::u32string text;
+    void FlushText();
+    void Add(const std::u32string& event);
+};
+
+void EventRecorder::StartElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName, const Attributes& attributes)
+{
+    std::u32string event = U"StartElement {" + namespaceUri + U"}" + localName + U" " + qualifiedName;
+    for (const Attribute& attribute : attributes)
+    {
+        event.append(U" {" + attribute.NamespaceUri() + U"}" + attribute.LocalName() + U" " + attribute.QualifiedName() + U"=\"" + attribute.Value() + U"\"");
+    }
+    Add(event);
+}
+
+void EventRecorder::EndElement(const std::u32string& namespaceUri, const std::u32string& localName, const std::u32string& qualifiedName)
+{
+    Add(U"EndElement {" + namespaceUri + U"}" + localName + U" " + qualifiedName);
+}
+
+void EventRecorder::FlushText()
+{
+    if (!text.empty())
+    {
+        events.push_back(U"Text " + text);
+        text.clear();
+    }
+}
+
+void EventRecorder::Add(const std::u32string& event)
+{
+    FlushText();
+    events.push_back(event);
+}
+
+bool Compare(const std::string& filePath)
+{
+    std::string content = ReadFile(filePath);
+    EventRecorder readerEvents;
+    ParseXmlContent(content, filePath, &readerEvents);
+    EventRecorder grammarEvents;
+    ParseXmlContent(ToUtf32(content), filePath, &grammarEvents);
+    const std::vector<std::u32string>& readerList = readerEvents.Events();
+    const std::vector<std::u32string>& grammarList = grammarEvents.Events();
+    size_t n = std::min(readerList.size(), grammarList.size());
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (readerList[i] != grammarList[i])
+        {
+            std::cout << filePath << ": event " << i << " differs:" << std::endl;
+            std::cout << "reader : " << ToUtf8(readerList[i]) << std::endl;
+            std::cout << "grammar: " << ToUtf8(grammarList[i]) << std::endl;
+            return false;
+        }
+    }
+    if (readerList.size() != grammarList.size())
+    {
+        std::cout << filePath << ": reader produced " << readerList.size() << " events, grammar produced " << grammarList.size() << " events" << std::endl;
+        return false;
+    }
+    std::cout << filePath << ": " << n << " events, same" << std::endl;
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    InitDone initDone;
+    try
+    {
+        std::vector<std::string> filePaths;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (!arg.empty() && arg[0] == '-')
+            {
+                throw std::runtime_error("unknown option '" + arg + "'");
+            }
+            else
+            {
+                filePaths.push_back(GetFullPath(arg));
+            }
+        }
+        if (filePaths.empty())
+        {
+            std::cout << "usage: xmltest <xml file>..." << std::endl;
+            std::cout << "Parses each file with XmlStreamReader and with the Xml grammar and checks that both produce the same events." << std::endl;
+            std::cout << "Typical inputs are content.xml, solution.xml and the .vcxproj files of the solution." << std::endl;
+            return 1;
+        }
+        int numFailed = 0;
+        for (const std::string& filePath : filePaths)
+        {
+            if (!Compare(filePath))
+            {
+                ++numFailed;
+            }
+        }
+        if (numFailed > 0)
+        {
+            std::cout << numFailed << " of " << filePaths.size() << " files differ" << std::endl;
+            return 1;
+        }
+        std::cout << "all " << filePaths.size() << " files same" << std::endl;
+    }
+    catch (const ParsingException& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
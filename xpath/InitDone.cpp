@@ -6,6 +6,7 @@
 #include <gendoc/xpath/InitDone.hpp>
 #include <gendoc/xpath/XPathFunction.hpp>
 #include <gendoc/xpath/XPathDebug.hpp>
+#include <gendoc/xpath/XPathEvaluate.hpp>
 
 namespace gendoc { namespace xpath {
 
@@ -13,10 +14,12 @@ void Init()
 {
     InitFunction();
     InitDebug();
+    InitEvaluate();
 }
 
 void Done()
 {
+    DoneEvaluate();
     DoneDebug();
     DoneFunction();
 }
@@ -79,9 +79,7 @@ XPathExpr* XPath::Parse(const char32_t* start, const char32_t* end, int fileInde
             throw gendoc::parsing::ParsingException("grammar '" + ToUtf8(Name()) + "' has no start rule", fileName, scanner.GetSpan(), start, end);
         }
     }
-    std::unique_ptr<gendoc::parsing::Object> value = std::move(stack.top());
-    XPathExpr* result = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(value.get());
-    stack.pop();
+    XPathExpr* result = stack.Pop<XPathExpr*>();
     return result;
 }
 
@@ -95,15 +93,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -124,9 +121,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromOrExpr_value = std::move(stack.top());
-            context->fromOrExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromOrExpr_value.get());
-            stack.pop();
+            context->fromOrExpr = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -148,15 +143,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -186,9 +180,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -196,9 +188,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -221,15 +211,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -259,9 +248,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -269,9 +256,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -295,15 +280,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -353,9 +337,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -363,9 +345,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -390,15 +370,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -466,9 +445,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -476,9 +453,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -503,15 +478,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -561,9 +535,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -571,9 +543,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -598,15 +568,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -665,9 +634,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -675,9 +642,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -701,15 +666,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -739,9 +703,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromsubject_value = std::move(stack.top());
-            context->fromsubject = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromsubject_value.get());
-            stack.pop();
+            context->fromsubject = stack.Pop<XPathExpr*>();
         }
     }
     void PostunionExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -749,9 +711,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromunionExpr_value = std::move(stack.top());
-            context->fromunionExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromunionExpr_value.get());
-            stack.pop();
+            context->fromunionExpr = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -774,15 +734,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -812,9 +771,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -822,9 +779,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -849,15 +804,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -925,9 +879,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLocationPath_value = std::move(stack.top());
-            context->fromLocationPath = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromLocationPath_value.get());
-            stack.pop();
+            context->fromLocationPath = stack.Pop<XPathExpr*>();
         }
     }
     void PostFunctionCall(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -935,9 +887,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionCall_value = std::move(stack.top());
-            context->fromFunctionCall = *static_cast<gendoc::parsing::ValueObject<XPathFunctionCall*>*>(fromFunctionCall_value.get());
-            stack.pop();
+            context->fromFunctionCall = stack.Pop<XPathFunctionCall*>();
         }
     }
     void PostFilterExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -945,9 +895,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFilterExpr_value = std::move(stack.top());
-            context->fromFilterExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromFilterExpr_value.get());
-            stack.pop();
+            context->fromFilterExpr = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -955,9 +903,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -984,15 +930,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1022,9 +967,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromprimary_value = std::move(stack.top());
-            context->fromprimary = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromprimary_value.get());
-            stack.pop();
+            context->fromprimary = stack.Pop<XPathExpr*>();
         }
     }
     void Postpredicate(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1032,9 +975,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frompredicate_value = std::move(stack.top());
-            context->frompredicate = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(frompredicate_value.get());
-            stack.pop();
+            context->frompredicate = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -1057,15 +998,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1095,9 +1035,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbsoluteLocationPath_value = std::move(stack.top());
-            context->fromAbsoluteLocationPath = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromAbsoluteLocationPath_value.get());
-            stack.pop();
+            context->fromAbsoluteLocationPath = stack.Pop<XPathExpr*>();
         }
     }
     void PostRelativeLocationPath(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1105,9 +1043,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromRelativeLocationPath_value = std::move(stack.top());
-            context->fromRelativeLocationPath = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromRelativeLocationPath_value.get());
-            stack.pop();
+            context->fromRelativeLocationPath = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -1130,15 +1066,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1175,9 +1110,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbbreviatedAbsoluteLocationPath_value = std::move(stack.top());
-            context->fromAbbreviatedAbsoluteLocationPath = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromAbbreviatedAbsoluteLocationPath_value.get());
-            stack.pop();
+            context->fromAbbreviatedAbsoluteLocationPath = stack.Pop<XPathExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1185,9 +1118,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -1211,15 +1142,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1269,9 +1199,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromleft_value = std::move(stack.top());
-            context->fromleft = *static_cast<gendoc::parsing::ValueObject<XPathLocationStepExpr*>*>(fromleft_value.get());
-            stack.pop();
+            context->fromleft = stack.Pop<XPathLocationStepExpr*>();
         }
     }
     void Postright(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1279,9 +1207,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathLocationStepExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathLocationStepExpr*>();
         }
     }
 private:
@@ -1305,15 +1231,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1334,9 +1259,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromright_value = std::move(stack.top());
-            context->fromright = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromright_value.get());
-            stack.pop();
+            context->fromright = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -1358,15 +1281,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathLocationStepExpr*>(context->value)));
+            stack.Push<XPathLocationStepExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1407,9 +1329,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromaxis_value = std::move(stack.top());
-            context->fromaxis = *static_cast<gendoc::parsing::ValueObject<Axis>*>(fromaxis_value.get());
-            stack.pop();
+            context->fromaxis = stack.Pop<Axis>();
         }
     }
     void PostnodeTest(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1417,9 +1337,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromnodeTest_value = std::move(stack.top());
-            context->fromnodeTest = *static_cast<gendoc::parsing::ValueObject<XPathNodeTestExpr*>*>(fromnodeTest_value.get());
-            stack.pop();
+            context->fromnodeTest = stack.Pop<XPathNodeTestExpr*>();
         }
     }
     void Postpredicate(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1427,9 +1345,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> frompredicate_value = std::move(stack.top());
-            context->frompredicate = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(frompredicate_value.get());
-            stack.pop();
+            context->frompredicate = stack.Pop<XPathExpr*>();
         }
     }
     void PostAbbreviatedStep(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1437,9 +1353,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbbreviatedStep_value = std::move(stack.top());
-            context->fromAbbreviatedStep = *static_cast<gendoc::parsing::ValueObject<XPathLocationStepExpr*>*>(fromAbbreviatedStep_value.get());
-            stack.pop();
+            context->fromAbbreviatedStep = stack.Pop<XPathLocationStepExpr*>();
         }
     }
 private:
@@ -1464,15 +1378,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathLocationStepExpr*>(context->value)));
+            stack.Push<XPathLocationStepExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1511,15 +1424,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Axis>(context->value)));
+            stack.Push<Axis>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1549,9 +1461,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAxisName_value = std::move(stack.top());
-            context->fromAxisName = *static_cast<gendoc::parsing::ValueObject<Axis>*>(fromAxisName_value.get());
-            stack.pop();
+            context->fromAxisName = stack.Pop<Axis>();
         }
     }
     void PostAbbreviatedAxisSpecifier(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1559,9 +1469,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromAbbreviatedAxisSpecifier_value = std::move(stack.top());
-            context->fromAbbreviatedAxisSpecifier = *static_cast<gendoc::parsing::ValueObject<Axis>*>(fromAbbreviatedAxisSpecifier_value.get());
-            stack.pop();
+            context->fromAbbreviatedAxisSpecifier = stack.Pop<Axis>();
         }
     }
 private:
@@ -1584,15 +1492,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Axis>(context->value)));
+            stack.Push<Axis>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1624,15 +1531,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<Axis>(context->value)));
+            stack.Push<Axis>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1671,15 +1577,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1700,9 +1605,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPredicateExpr_value = std::move(stack.top());
-            context->fromPredicateExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromPredicateExpr_value.get());
-            stack.pop();
+            context->fromPredicateExpr = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -1724,15 +1627,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1753,9 +1655,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpr_value = std::move(stack.top());
-            context->fromExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromExpr_value.get());
-            stack.pop();
+            context->fromExpr = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -1777,15 +1677,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathNodeTestExpr*>(context->value)));
+            stack.Push<XPathNodeTestExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1824,9 +1723,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLiteral_value = std::move(stack.top());
-            context->fromLiteral = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromLiteral_value.get());
-            stack.pop();
+            context->fromLiteral = stack.Pop<XPathExpr*>();
         }
     }
     void PostNodeType(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1834,9 +1731,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNodeType_value = std::move(stack.top());
-            context->fromNodeType = *static_cast<gendoc::parsing::ValueObject<XPathNodeTestExpr*>*>(fromNodeType_value.get());
-            stack.pop();
+            context->fromNodeType = stack.Pop<XPathNodeTestExpr*>();
         }
     }
     void PostNameTest(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1844,9 +1739,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNameTest_value = std::move(stack.top());
-            context->fromNameTest = *static_cast<gendoc::parsing::ValueObject<XPathNodeTestExpr*>*>(fromNameTest_value.get());
-            stack.pop();
+            context->fromNameTest = stack.Pop<XPathNodeTestExpr*>();
         }
     }
 private:
@@ -1870,15 +1763,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathNodeTestExpr*>(context->value)));
+            stack.Push<XPathNodeTestExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -1915,9 +1807,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNCName_value = std::move(stack.top());
-            context->fromNCName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromNCName_value.get());
-            stack.pop();
+            context->fromNCName = stack.Pop<std::u32string>();
         }
     }
     void PostQName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -1925,9 +1815,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQName_value = std::move(stack.top());
-            context->fromQName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQName_value.get());
-            stack.pop();
+            context->fromQName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -1950,15 +1838,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathNodeTestExpr*>(context->value)));
+            stack.Push<XPathNodeTestExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2011,15 +1898,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2076,9 +1962,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionCall_value = std::move(stack.top());
-            context->fromFunctionCall = *static_cast<gendoc::parsing::ValueObject<XPathFunctionCall*>*>(fromFunctionCall_value.get());
-            stack.pop();
+            context->fromFunctionCall = stack.Pop<XPathFunctionCall*>();
         }
     }
     void PostVariableReference(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2086,9 +1970,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromVariableReference_value = std::move(stack.top());
-            context->fromVariableReference = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromVariableReference_value.get());
-            stack.pop();
+            context->fromVariableReference = stack.Pop<XPathExpr*>();
         }
     }
     void PostExpr(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2096,9 +1978,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpr_value = std::move(stack.top());
-            context->fromExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromExpr_value.get());
-            stack.pop();
+            context->fromExpr = stack.Pop<XPathExpr*>();
         }
     }
     void PostLiteral(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2106,9 +1986,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLiteral_value = std::move(stack.top());
-            context->fromLiteral = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromLiteral_value.get());
-            stack.pop();
+            context->fromLiteral = stack.Pop<XPathExpr*>();
         }
     }
     void PostNumber(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2116,9 +1994,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNumber_value = std::move(stack.top());
-            context->fromNumber = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromNumber_value.get());
-            stack.pop();
+            context->fromNumber = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -2144,15 +2020,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2173,9 +2048,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQName_value = std::move(stack.top());
-            context->fromQName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQName_value.get());
-            stack.pop();
+            context->fromQName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2197,15 +2070,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2244,15 +2116,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2291,15 +2162,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathFunctionCall*>(context->value)));
+            stack.Push<XPathFunctionCall*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2338,9 +2208,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromFunctionName_value = std::move(stack.top());
-            context->fromFunctionName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromFunctionName_value.get());
-            stack.pop();
+            context->fromFunctionName = stack.Pop<std::u32string>();
         }
     }
     void Postfirst(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2348,9 +2216,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromfirst_value = std::move(stack.top());
-            context->fromfirst = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromfirst_value.get());
-            stack.pop();
+            context->fromfirst = stack.Pop<XPathExpr*>();
         }
     }
     void Postnext(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2358,9 +2224,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromnext_value = std::move(stack.top());
-            context->fromnext = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromnext_value.get());
-            stack.pop();
+            context->fromnext = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -2384,15 +2248,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<XPathExpr*>(context->value)));
+            stack.Push<XPathExpr*>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2413,9 +2276,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromExpr_value = std::move(stack.top());
-            context->fromExpr = *static_cast<gendoc::parsing::ValueObject<XPathExpr*>*>(fromExpr_value.get());
-            stack.pop();
+            context->fromExpr = stack.Pop<XPathExpr*>();
         }
     }
 private:
@@ -2438,15 +2299,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2476,9 +2336,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromQName_value = std::move(stack.top());
-            context->fromQName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromQName_value.get());
-            stack.pop();
+            context->fromQName = stack.Pop<std::u32string>();
         }
     }
     void PostNodeType(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2486,9 +2344,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNodeType_value = std::move(stack.top());
-            context->fromNodeType = *static_cast<gendoc::parsing::ValueObject<XPathNodeTestExpr*>*>(fromNodeType_value.get());
-            stack.pop();
+            context->fromNodeType = stack.Pop<XPathNodeTestExpr*>();
         }
     }
 private:
@@ -2512,15 +2368,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2550,9 +2405,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPrefixedName_value = std::move(stack.top());
-            context->fromPrefixedName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromPrefixedName_value.get());
-            stack.pop();
+            context->fromPrefixedName = stack.Pop<std::u32string>();
         }
     }
     void PostUnprefixedName(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2560,9 +2413,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromUnprefixedName_value = std::move(stack.top());
-            context->fromUnprefixedName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromUnprefixedName_value.get());
-            stack.pop();
+            context->fromUnprefixedName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2585,15 +2436,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2616,9 +2466,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromPrefix_value = std::move(stack.top());
-            context->fromPrefix = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromPrefix_value.get());
-            stack.pop();
+            context->fromPrefix = stack.Pop<std::u32string>();
         }
     }
     void PostLocalPart(gendoc::parsing::ObjectStack& stack, ParsingData* parsingData, bool matched)
@@ -2626,9 +2474,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLocalPart_value = std::move(stack.top());
-            context->fromLocalPart = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromLocalPart_value.get());
-            stack.pop();
+            context->fromLocalPart = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2651,15 +2497,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2680,9 +2525,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromLocalPart_value = std::move(stack.top());
-            context->fromLocalPart = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromLocalPart_value.get());
-            stack.pop();
+            context->fromLocalPart = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2704,15 +2547,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2733,9 +2575,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNCName_value = std::move(stack.top());
-            context->fromNCName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromNCName_value.get());
-            stack.pop();
+            context->fromNCName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2757,15 +2597,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
@@ -2786,9 +2625,7 @@ public:
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            std::unique_ptr<gendoc::parsing::Object> fromNCName_value = std::move(stack.top());
-            context->fromNCName = *static_cast<gendoc::parsing::ValueObject<std::u32string>*>(fromNCName_value.get());
-            stack.pop();
+            context->fromNCName = stack.Pop<std::u32string>();
         }
     }
 private:
@@ -2810,15 +2647,14 @@ public:
     }
     void Enter(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData) override
     {
-        parsingData->PushContext(Id(), new Context());
-        Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
+        parsingData->PushContext<Context>(Id(), this);
     }
     void Leave(gendoc::parsing::ObjectStack& stack, gendoc::parsing::ParsingData* parsingData, bool matched) override
     {
         Context* context = static_cast<Context*>(parsingData->GetContext(Id()));
         if (matched)
         {
-            stack.push(std::unique_ptr<gendoc::parsing::Object>(new gendoc::parsing::ValueObject<std::u32string>(context->value)));
+            stack.Push<std::u32string>(context->value);
         }
         parsingData->PopContext(Id());
     }
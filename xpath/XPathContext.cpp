@@ -4,10 +4,47 @@
 // =================================
 
 #include <gendoc/xpath/XPathContext.hpp>
+#include <gendoc/util/Unicode.hpp>
+#include <stdexcept>
 
 namespace gendoc { namespace xpath {
 
-XPathContext::XPathContext(gendoc::dom::Node* node_, int position_, int size_) : node(node_), position(position_), size(size_)
+using namespace gendoc::unicode;
+
+void XPathVariableBindings::BindString(const std::u32string& name, const std::u32string& value)
+{
+    values[name].reset(new XPathString(value));
+}
+
+void XPathVariableBindings::BindNumber(const std::u32string& name, double value)
+{
+    values[name].reset(new XPathNumber(value));
+}
+
+void XPathVariableBindings::BindBoolean(const std::u32string& name, bool value)
+{
+    values[name].reset(new XPathBoolean(value));
+}
+
+std::unique_ptr<XPathObject> XPathVariableBindings::GetValue(const std::u32string& name) const
+{
+    auto it = values.find(name);
+    if (it != values.cend())
+    {
+        return it->second->Clone();
+    }
+    else
+    {
+        throw std::runtime_error("gendoc::xpath variable '$" + ToUtf8(name) + "' not bound");
+    }
+}
+
+XPathContext::XPathContext(gendoc::dom::Node* node_, int position_, int size_) : node(node_), position(position_), size(size_), bindings(nullptr)
+{
+}
+
+XPathContext::XPathContext(gendoc::dom::Node* node_, int position_, int size_, const XPathVariableBindings* bindings_) :
+    node(node_), position(position_), size(size_), bindings(bindings_)
 {
 }
 
@@ -5,21 +5,39 @@
 
 #ifndef GENDOC_XPATH_XPATH_CONTEXT
 #define GENDOC_XPATH_XPATH_CONTEXT
+#include <gendoc/xpath/XPathObject.hpp>
 #include <gendoc/dom/Node.hpp>
+#include <unordered_map>
 
 namespace gendoc { namespace xpath {
 
+// Values of the variables that an expression refers to as $name.
+
+class XPathVariableBindings
+{
+public:
+    void BindString(const std::u32string& name, const std::u32string& value);
+    void BindNumber(const std::u32string& name, double value);
+    void BindBoolean(const std::u32string& name, bool value);
+    std::unique_ptr<XPathObject> GetValue(const std::u32string& name) const;
+private:
+    std::unordered_map<std::u32string, std::unique_ptr<XPathObject>> values;
+};
+
 class XPathContext
 {
 public:
     XPathContext(gendoc::dom::Node* node_, int position_, int size_);
+    XPathContext(gendoc::dom::Node* node_, int position_, int size_, const XPathVariableBindings* bindings_);
     gendoc::dom::Node* Node() const { return node; }
     int Position() const { return position; }
     int Size() const { return size; }
+    const XPathVariableBindings* Bindings() const { return bindings; }
 private:
     gendoc::dom::Node* node;
     int position;
     int size;
+    const XPathVariableBindings* bindings;
 };
 
 } } // namespace gendoc::xpath
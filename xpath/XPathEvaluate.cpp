@@ -10,33 +10,147 @@
 #include <gendoc/dom/Document.hpp>
 #include <iostream>
 #include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace gendoc { namespace xpath {
 
 XPath* xpathGrammar = nullptr;
+std::once_flag xpathGrammarCreated;
 
-std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Node* node)
+void CreateXPathGrammar()
+{
+    xpathGrammar = XPath::Create();
+    if (XPathDebugParsing())
+    {
+        xpathGrammar->SetLog(&std::cout);
+    }
+}
+
+XPathCompiledExpr::XPathCompiledExpr(const std::u32string& text_, XPathExpr* expr_) : text(text_), expr(expr_)
+{
+}
+
+std::unique_ptr<XPathObject> XPathCompiledExpr::Evaluate(gendoc::dom::Node* node) const
+{
+    XPathContext context(node, 1, 1);
+    return expr->Evaluate(context);
+}
+
+std::unique_ptr<XPathObject> XPathCompiledExpr::Evaluate(gendoc::dom::Node* node, const XPathVariableBindings& bindings) const
+{
+    XPathContext context(node, 1, 1, &bindings);
+    return expr->Evaluate(context);
+}
+
+XPathCompiledExprPtr ParseXPathExpr(const std::u32string& xpathExpression)
+{
+    std::call_once(xpathGrammarCreated, CreateXPathGrammar);
+    XPathExpr* expr = xpathGrammar->Parse(&xpathExpression[0], &xpathExpression[0] + xpathExpression.length(), 0, "");
+    return XPathCompiledExprPtr(new XPathCompiledExpr(xpathExpression, expr));
+}
+
+const int xpathExprCacheCapacity = 256;
+
+// Compiled expressions keyed by their text. The list keeps the expressions in order of use, the most recently used first,
+// and the least recently used expression is dropped when the cache is full.
+// An expression that is dropped stays alive as long as some caller still holds it.
+
+class XPathExprCache
+{
+public:
+    static void Init();
+    static void Done();
+    static XPathExprCache& Instance() { return *instance; }
+    XPathCompiledExprPtr Get(const std::u32string& xpathExpression);
+    XPathCompiledExprPtr Put(const XPathCompiledExprPtr& compiledExpr);
+private:
+    static std::unique_ptr<XPathExprCache> instance;
+    typedef std::list<XPathCompiledExprPtr> ExprList;
+    std::mutex mtx;
+    ExprList exprs;
+    std::unordered_map<std::u32string, ExprList::iterator> exprMap;
+};
+
+std::unique_ptr<XPathExprCache> XPathExprCache::instance;
+
+void XPathExprCache::Init()
+{
+    instance.reset(new XPathExprCache());
+}
+
+void XPathExprCache::Done()
+{
+    instance.reset();
+}
+
+XPathCompiledExprPtr XPathExprCache::Get(const std::u32string& xpathExpression)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = exprMap.find(xpathExpression);
+    if (it != exprMap.cend())
+    {
+        exprs.splice(exprs.begin(), exprs, it->second);
+        return exprs.front();
+    }
+    return XPathCompiledExprPtr();
+}
+
+XPathCompiledExprPtr XPathExprCache::Put(const XPathCompiledExprPtr& compiledExpr)
 {
-    if (!xpathGrammar)
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = exprMap.find(compiledExpr->Text());
+    if (it != exprMap.cend())
     {
-        xpathGrammar = XPath::Create();
+        exprs.splice(exprs.begin(), exprs, it->second);
+        return exprs.front();
     }
+    if (int(exprs.size()) >= xpathExprCacheCapacity)
+    {
+        exprMap.erase(exprs.back()->Text());
+        exprs.pop_back();
+    }
+    exprs.push_front(compiledExpr);
+    exprMap[compiledExpr->Text()] = exprs.begin();
+    return compiledExpr;
+}
+
+XPathCompiledExprPtr Compile(const std::u32string& xpathExpression)
+{
     if (XPathDebugParsing())
     {
-        xpathGrammar->SetLog(&std::cout);
+        return ParseXPathExpr(xpathExpression);
+    }
+    XPathCompiledExprPtr compiledExpr = XPathExprCache::Instance().Get(xpathExpression);
+    if (compiledExpr)
+    {
+        return compiledExpr;
     }
+    return XPathExprCache::Instance().Put(ParseXPathExpr(xpathExpression));
+}
+
+std::unique_ptr<XPathObject> EvaluateXPathExpr(const std::u32string& xpathExpression, gendoc::dom::Node* node, const XPathVariableBindings* bindings)
+{
     std::chrono::time_point<std::chrono::steady_clock> startQuery = std::chrono::steady_clock::now();
-    std::unique_ptr<XPathExpr> xpathExpr(xpathGrammar->Parse(&xpathExpression[0], &xpathExpression[0] + xpathExpression.length(), 0, ""));
+    XPathCompiledExprPtr compiledExpr = Compile(xpathExpression);
     std::chrono::time_point<std::chrono::steady_clock> endQuery = std::chrono::steady_clock::now();
     if (XPathDebugQuery())
     {
-        std::unique_ptr<dom::Node> queryDom = xpathExpr->ToDom();
+        std::unique_ptr<dom::Node> queryDom = compiledExpr->Expr()->ToDom();
         SetXPathQueryDom(std::move(queryDom));
         SetXPathQueryDuration(std::chrono::nanoseconds(endQuery - startQuery));
     }
     std::chrono::time_point<std::chrono::steady_clock> startEvaluate = std::chrono::steady_clock::now();
-    XPathContext context(node, 1, 1);
-    std::unique_ptr<XPathObject> result = xpathExpr->Evaluate(context);
+    std::unique_ptr<XPathObject> result;
+    if (bindings)
+    {
+        result = compiledExpr->Evaluate(node, *bindings);
+    }
+    else
+    {
+        result = compiledExpr->Evaluate(node);
+    }
     std::chrono::time_point<std::chrono::steady_clock> endEvaluate = std::chrono::steady_clock::now();
     if (XPathDebugQuery())
     {
@@ -45,9 +159,29 @@ std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gen
     return result;
 }
 
+std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Node* node)
+{
+    return EvaluateXPathExpr(xpathExpression, node, nullptr);
+}
+
 std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Document* document)
 {
     return Evaluate(xpathExpression, static_cast<gendoc::dom::Node*>(document));
 }
 
+std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Node* node, const XPathVariableBindings& bindings)
+{
+    return EvaluateXPathExpr(xpathExpression, node, &bindings);
+}
+
+void InitEvaluate()
+{
+    XPathExprCache::Init();
+}
+
+void DoneEvaluate()
+{
+    XPathExprCache::Done();
+}
+
 } } // namespace gendoc::xpath
@@ -6,11 +6,40 @@
 #ifndef GENDOC_XPATH_XPATH_EVALUATE
 #define GENDOC_XPATH_XPATH_EVALUATE
 #include <gendoc/xpath/XPathObject.hpp>
+#include <gendoc/xpath/XPathExpr.hpp>
+#include <memory>
 
 namespace gendoc { namespace xpath {
 
+// An expression that is parsed once and can then be evaluated any number of times, also by several threads at the same time.
+
+class XPathCompiledExpr
+{
+public:
+    XPathCompiledExpr(const std::u32string& text_, XPathExpr* expr_);
+    XPathCompiledExpr(const XPathCompiledExpr&) = delete;
+    XPathCompiledExpr& operator=(const XPathCompiledExpr&) = delete;
+    const std::u32string& Text() const { return text; }
+    const XPathExpr* Expr() const { return expr.get(); }
+    std::unique_ptr<XPathObject> Evaluate(gendoc::dom::Node* node) const;
+    std::unique_ptr<XPathObject> Evaluate(gendoc::dom::Node* node, const XPathVariableBindings& bindings) const;
+private:
+    std::u32string text;
+    std::unique_ptr<XPathExpr> expr;
+};
+
+typedef std::shared_ptr<XPathCompiledExpr> XPathCompiledExprPtr;
+
+// Returns the compiled expression for the given text. The most recently used expressions are cached, so an expression is parsed only when it is not in the cache.
+
+XPathCompiledExprPtr Compile(const std::u32string& xpathExpression);
+
 std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Node* node);
 std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Document* document);
+std::unique_ptr<XPathObject> Evaluate(const std::u32string& xpathExpression, gendoc::dom::Node* node, const XPathVariableBindings& bindings);
+
+void InitEvaluate();
+void DoneEvaluate();
 
 } } // namespace gendoc::xpath
 
@@ -1165,7 +1165,7 @@ std::unique_ptr<XPathObject> XPathCombineStepExpr::Evaluate(XPathContext& contex
     for (int i = 0; i < n; ++i)
     {
         gendoc::dom::Node* node = (*leftNodeSet)[i];
-        XPathContext rightContext(node, i + 1, n);
+        XPathContext rightContext(node, i + 1, n, context.Bindings());
         std::unique_ptr<XPathObject> rightResult = Right()->Evaluate(rightContext);
         if (rightResult->Type() != XPathObjectType::nodeSet)
         {
@@ -1227,11 +1227,12 @@ std::unique_ptr<XPathObject> XPathFilterExpr::Evaluate(XPathContext& context)
     }
     std::unique_ptr<XPathNodeSet> nodeSet(static_cast<XPathNodeSet*>(result.release()));
     std::unique_ptr<XPathNodeSet> filteredNodeSet(new XPathNodeSet());
+    const XPathVariableBindings* bindings = context.Bindings();
     int n = nodeSet->Length();
     for (int i = 0; i < n; ++i)
     {
         gendoc::dom::Node* node = (*nodeSet)[i];
-        XPathContext context(node, i + 1, n);
+        XPathContext context(node, i + 1, n, bindings);
         std::unique_ptr<XPathObject> result = predicate->Evaluate(context);
         bool booleanResult = false;
         if (result->Type() == XPathObjectType::number)
@@ -1308,6 +1309,7 @@ std::unique_ptr<XPathObject> XPathLocationStepExpr::Evaluate(XPathContext& conte
     if (context.Node())
     {
         context.Node()->Walk(selectNodes, axis);
+        const XPathVariableBindings* bindings = context.Bindings();
         for (const std::unique_ptr<XPathExpr>& predicate : predicates)
         {
             std::unique_ptr<XPathNodeSet> filteredNodeSet(new XPathNodeSet());
@@ -1315,7 +1317,7 @@ std::unique_ptr<XPathObject> XPathLocationStepExpr::Evaluate(XPathContext& conte
             for (int i = 0; i < n; ++i)
             {
                 gendoc::dom::Node* node = (*nodeSet)[i];
-                XPathContext context(node, i + 1, n);
+                XPathContext context(node, i + 1, n, bindings);
                 std::unique_ptr<XPathObject> result = predicate->Evaluate(context);
                 bool booleanResult = false;
                 if (result->Type() == XPathObjectType::number)
@@ -1582,6 +1584,15 @@ XPathVariableReference::XPathVariableReference(const std::u32string& name_) : na
 {
 }
 
+std::unique_ptr<XPathObject> XPathVariableReference::Evaluate(XPathContext& context)
+{
+    if (!context.Bindings())
+    {
+        throw std::runtime_error("gendoc::xpath variable '$" + ToUtf8(name) + "' not bound");
+    }
+    return context.Bindings()->GetValue(name);
+}
+
 std::unique_ptr<dom::Node> XPathVariableReference::ToDom() const
 {
     std::unique_ptr<dom::Element> element(new dom::Element(U"variableReference"));
@@ -285,6 +285,7 @@ class XPathVariableReference : public XPathExpr
 {
 public:
     XPathVariableReference(const std::u32string& name_);
+    std::unique_ptr<XPathObject> Evaluate(XPathContext& context) override;
     std::unique_ptr<dom::Node> ToDom() const override;
 private:
     std::u32string name;
@@ -28,6 +28,17 @@ void XPathNodeSet::Add(gendoc::dom::Node* node)
     nodes.InternalAddNode(node);
 }
 
+std::unique_ptr<XPathObject> XPathNodeSet::Clone() const
+{
+    std::unique_ptr<XPathNodeSet> clone(new XPathNodeSet());
+    int n = nodes.Length();
+    for (int i = 0; i < n; ++i)
+    {
+        clone->Add(nodes[i]);
+    }
+    return std::unique_ptr<XPathObject>(clone.release());
+}
+
 std::unique_ptr<dom::Node> XPathNodeSet::ToDom() const
 {
     std::unique_ptr<dom::Element> result(new dom::Element(U"nodeset"));
@@ -92,6 +103,11 @@ XPathBoolean::XPathBoolean(bool value_) : XPathObject(XPathObjectType::boolean),
 {
 }
 
+std::unique_ptr<XPathObject> XPathBoolean::Clone() const
+{
+    return std::unique_ptr<XPathObject>(new XPathBoolean(value));
+}
+
 std::unique_ptr<dom::Node> XPathBoolean::ToDom() const
 {
     std::unique_ptr<dom::Element> result(new dom::Element(U"boolean"));
@@ -103,6 +119,11 @@ XPathNumber::XPathNumber(double value_) : XPathObject(XPathObjectType::number),
 {
 }
 
+std::unique_ptr<XPathObject> XPathNumber::Clone() const
+{
+    return std::unique_ptr<XPathObject>(new XPathNumber(value));
+}
+
 std::unique_ptr<dom::Node> XPathNumber::ToDom() const
 {
     std::unique_ptr<dom::Element> result(new dom::Element(U"number"));
@@ -114,6 +135,11 @@ XPathString::XPathString(const std::u32string& value_) : XPathObject(XPathObject
 {
 }
 
+std::unique_ptr<XPathObject> XPathString::Clone() const
+{
+    return std::unique_ptr<XPathObject>(new XPathString(value));
+}
+
 std::unique_ptr<dom::Node> XPathString::ToDom() const
 {
     std::unique_ptr<dom::Element> result(new dom::Element(U"string"));
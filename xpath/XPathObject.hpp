@@ -20,6 +20,7 @@ public:
     XPathObject(XPathObjectType type_);
     XPathObjectType Type() const { return type; }
     virtual ~XPathObject();
+    virtual std::unique_ptr<XPathObject> Clone() const = 0;
     virtual std::unique_ptr<dom::Node> ToDom() const = 0;
 private:
     XPathObjectType type;
@@ -32,6 +33,7 @@ public:
     gendoc::dom::Node* operator[](int index) const { return nodes[index]; }
     int Length() const { return nodes.Length(); }
     void Add(gendoc::dom::Node* node);
+    std::unique_ptr<XPathObject> Clone() const override;
     std::unique_ptr<dom::Node> ToDom() const override;
 private:
     gendoc::dom::NodeList nodes;
@@ -42,6 +44,7 @@ class XPathBoolean : public XPathObject
 public:
     XPathBoolean(bool value_);
     bool Value() const { return value; }
+    std::unique_ptr<XPathObject> Clone() const override;
     std::unique_ptr<dom::Node> ToDom() const override;
 private:
     bool value;
@@ -52,6 +55,7 @@ class XPathNumber : public XPathObject
 public:
     XPathNumber(double value_);
     double Value() const { return value; }
+    std::unique_ptr<XPathObject> Clone() const override;
     std::unique_ptr<dom::Node> ToDom() const override;
 private:
     double value;
@@ -62,6 +66,7 @@ class XPathString : public XPathObject
 public:    
     XPathString(const std::u32string& value_);
     const std::u32string& Value() const { return value; }
+    std::unique_ptr<XPathObject> Clone() const override;
     std::unique_ptr<dom::Node> ToDom() const override;
 private:
     std::u32string value;